@@ -0,0 +1,160 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "FGlobalType.h"
+
+namespace dy::bench
+{
+
+/// @struct DBenchmarkResult
+/// @brief One reported result row, kept to be written as JSON or CSV after all benchmarks.
+struct DBenchmarkResult final
+{
+  std::string mGroup;
+  std::string mName;
+  TF64        mValue;
+  const char* mUnit;
+};
+
+/// @brief Results reported by `Report` and `ReportThroughput` in order.
+inline std::vector<DBenchmarkResult> gBenchmarkResults;
+
+/// @brief Volatile sink that benchmark results are written to.
+inline volatile char gBenchmarkSink = 0;
+
+/// @brief Prevent compiler from optimizing out calculation of given value.
+template <typename TType>
+void DoNotOptimize(const TType& iValue) noexcept
+{
+  gBenchmarkSink = *reinterpret_cast<const volatile char*>(&iValue);
+}
+
+/// @brief Call `iFunction` `iIterations` times and return the best nanoseconds per call
+/// among 5 trials. Best value is used to reject scheduler and cache noise.
+template <typename TFunctor>
+TF64 MeasureNsPerCall(TU32 iIterations, TFunctor&& iFunction)
+{
+  TF64 best = NumericalMax<TF64>;
+  for (TU32 trial = 0; trial < 5; ++trial)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    for (TU32 i = 0; i < iIterations; ++i) { iFunction(i); }
+    const auto end = std::chrono::steady_clock::now();
+
+    const TF64 ns = std::chrono::duration<TF64, std::nano>(end - start).count();
+    best = std::min(best, ns / iIterations);
+  }
+  return best;
+}
+
+/// @brief Print one result row.
+inline void Report(const char* iGroup, const char* iName, TF64 iNsPerCall)
+{
+  std::printf("%-16s %-32s %10.3f ns\n", iGroup, iName, iNsPerCall);
+  gBenchmarkResults.push_back({iGroup, iName, iNsPerCall, "ns"});
+}
+
+/// @brief Print one throughput result row.
+inline void ReportThroughput(const char* iGroup, const char* iName, TF64 iObjectsPerMs)
+{
+  std::printf("%-16s %-32s %10.1f objects/ms\n", iGroup, iName, iObjectsPerMs);
+  gBenchmarkResults.push_back({iGroup, iName, iObjectsPerMs, "objects/ms"});
+}
+
+/// @brief Print one result row of other unit, such as statistics.
+inline void ReportValue(const char* iGroup, const char* iName, TF64 iValue, const char* iUnit)
+{
+  std::printf("%-16s %-32s %10.3f %s\n", iGroup, iName, iValue, iUnit);
+  gBenchmarkResults.push_back({iGroup, iName, iValue, iUnit});
+}
+
+/// @brief Write `gBenchmarkResults` with build information to `iPath` as JSON.
+/// Return false if file could not be written.
+bool WriteResultsJson(const char* iPath);
+
+/// @brief Write `gBenchmarkResults` to `iPath` as CSV of group, name, value and unit columns.
+/// Return false if file could not be written.
+bool WriteResultsCsv(const char* iPath);
+
+/// @brief Benchmark DVector2, DVector3 and DVector4 construction, operators and glm conversion.
+/// Return false if result is not same to glm.
+bool RunVectorBenchmark();
+
+/// @brief Benchmark DVector3A operations. Return false if result is not same to DVector3.
+bool RunVector3ABenchmark();
+
+/// @brief Benchmark DMatrix4 construction, multiplications, inverse, transpose and glm conversion.
+/// Return false if result is not same to glm.
+bool RunMatrix4Benchmark();
+
+/// @brief Benchmark DMatrix3x4 against DMatrix4. Return false if result is not same to DMatrix4.
+bool RunMatrix3x4Benchmark();
+
+/// @brief Benchmark batched point and direction transforms.
+/// Return false if result is not bit-exact to DMatrix4::MultiplyVector.
+bool RunTransformBenchmark();
+
+/// @brief Benchmark DQuaternion and TRS compose. Return false if result is not same to glm.
+bool RunQuaternionBenchmark();
+
+/// @brief Benchmark frustum culling. Return false if SIMD result is not same to scalar test.
+bool RunFrustumBenchmark();
+
+/// @brief Benchmark vertex deduplication of grid mesh. Return false if results are not same to std::unordered_map.
+bool RunVertexDedupBenchmark();
+
+/// @brief Benchmark mesh optimization passes of shuffled grid mesh. Return false if triangles are not kept.
+bool RunMeshOptimizeBenchmark();
+
+/// @brief Benchmark vertex quantization into DCompactVertex. Return false if vertices restored by
+/// dequantization of shader.vert are not within one UNORM step of mesh extent.
+bool RunQuantizeBenchmark();
+
+/// @brief Benchmark 16-bit index buffer layout of grid meshes. Return false if indices are not same to source.
+bool RunIndexBufferBenchmark();
+
+/// @brief Benchmark meshlet build and culling of sphere mesh. Return false if meshlets or culling are not valid.
+bool RunMeshletBenchmark();
+
+/// @brief Benchmark LOD chain of textured sphere. Return false if LODs are not simplified or have flipped triangles.
+bool RunSimplifyBenchmark();
+
+/// @brief Benchmark add and remove churn of mesh registry. Return false if ranges overlap or are not coalesced.
+bool RunMeshRegistryBenchmark();
+
+/// @brief Check mesh cache refuses payload read out of bounds and keeps new time of touched source,
+/// and benchmark its validation. Return false if invalid cache is accepted.
+bool RunMeshCacheBenchmark();
+
+/// @brief Benchmark streaming OBJ reader against tinyobj and its scaling with threads.
+/// Return false if results differ or memory ceiling is ignored.
+bool RunObjStreamBenchmark();
+
+/// @brief Benchmark CPU mip chain of each SIMD level and filter.
+/// Return false if box filter is not same to sRGB reference or threads change result.
+bool RunMipmapBenchmark();
+
+/// @brief Check image decoding into caller memory and on decode pool, and benchmark it against buffer and copy.
+/// Return false if pixels, row order, fallback copy or size check are wrong.
+bool RunImageDecodeBenchmark();
+
+/// @brief Benchmark span operations of each SIMD level. Return false if result is not same to DVector3.
+bool RunVectorSpanBenchmark();
+
+} /// ::dy::bench namespace
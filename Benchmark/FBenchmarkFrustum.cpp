@@ -0,0 +1,119 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <random>
+#include <vector>
+#include "FBenchmark.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include "Type/DFrustum.h"
+
+namespace
+{
+
+/// Not multiple of 8, to exercise remainder path.
+constexpr TU32 kObjectCount = 50003;
+constexpr TU32 kIterations  = 64;
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunFrustumBenchmark()
+{
+  // Same camera to MVulkanRenderer::UpdateUniformBuffer, but objects are scattered around origin.
+  auto projection = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 10.0f);
+  projection[1][1] *= -1;
+  const auto view = glm::lookAt(glm::vec3(2.0f), glm::vec3(0.0f), glm::vec3(.0f, .0f, 1.f));
+  const DFrustum frustum{DMatrix4{projection * view}};
+
+  std::mt19937 engine{0x5EED};
+  std::uniform_real_distribution<TF32> position{-8.0f, 8.0f};
+  std::uniform_real_distribution<TF32> size{0.01f, 0.5f};
+  std::vector<DSphere> spheres(kObjectCount);
+  std::vector<DAabb> boxes(kObjectCount);
+  for (TU32 i = 0; i < kObjectCount; ++i)
+  {
+    const DVector3 center{position(engine), position(engine), position(engine)};
+    const DVector3 extent{size(engine), size(engine), size(engine)};
+    spheres[i] = DSphere{center, size(engine)};
+    boxes[i] = DAabb{center - extent, center + extent};
+  }
+
+  // Verify results before measuring.
+  bool isSucceeded = true;
+  std::vector<TU32> visibleIndices(kObjectCount), expectedIndices;
+  for (TU32 i = 0; i < kObjectCount; ++i)
+  {
+    if (frustum.IsVisible(spheres[i]) == true) { expectedIndices.push_back(i); }
+  }
+  visibleIndices.resize(frustum.CullSpheres(spheres.data(), kObjectCount, visibleIndices.data()));
+  if (visibleIndices != expectedIndices)
+  {
+    std::printf("DFrustum::CullSpheres is not same to DFrustum::IsVisible.\n");
+    isSucceeded = false;
+  }
+  const auto visibleSphereCount = visibleIndices.size();
+
+  expectedIndices.clear();
+  visibleIndices.resize(kObjectCount);
+  for (TU32 i = 0; i < kObjectCount; ++i)
+  {
+    if (frustum.IsVisible(boxes[i]) == true) { expectedIndices.push_back(i); }
+  }
+  visibleIndices.resize(frustum.CullAabbs(boxes.data(), kObjectCount, visibleIndices.data()));
+  if (visibleIndices != expectedIndices)
+  {
+    std::printf("DFrustum::CullAabbs is not same to DFrustum::IsVisible.\n");
+    isSucceeded = false;
+  }
+  if (visibleSphereCount == 0 || visibleSphereCount == kObjectCount || visibleIndices.empty())
+  {
+    std::printf("DFrustum culling test scene is degenerated.\n");
+    isSucceeded = false;
+  }
+
+  visibleIndices.resize(kObjectCount);
+  const auto ToObjectsPerMs = [](TF64 iNsPerCall) { return kObjectCount / (iNsPerCall * 1e-6); };
+  ReportThroughput("DFrustum", "IsVisible (sphere)", ToObjectsPerMs(MeasureNsPerCall(kIterations, [&](TU32)
+  {
+    std::size_t count = 0;
+    for (TU32 i = 0; i < kObjectCount; ++i)
+    {
+      if (frustum.IsVisible(spheres[i]) == true) { visibleIndices[count++] = i; }
+    }
+    DoNotOptimize(count);
+  })));
+  ReportThroughput("DFrustum", "CullSpheres", ToObjectsPerMs(MeasureNsPerCall(kIterations, [&](TU32)
+  {
+    DoNotOptimize(frustum.CullSpheres(spheres.data(), kObjectCount, visibleIndices.data()));
+  })));
+  ReportThroughput("DFrustum", "IsVisible (aabb)", ToObjectsPerMs(MeasureNsPerCall(kIterations, [&](TU32)
+  {
+    std::size_t count = 0;
+    for (TU32 i = 0; i < kObjectCount; ++i)
+    {
+      if (frustum.IsVisible(boxes[i]) == true) { visibleIndices[count++] = i; }
+    }
+    DoNotOptimize(count);
+  })));
+  ReportThroughput("DFrustum", "CullAabbs", ToObjectsPerMs(MeasureNsPerCall(kIterations, [&](TU32)
+  {
+    DoNotOptimize(frustum.CullAabbs(boxes.data(), kObjectCount, visibleIndices.data()));
+  })));
+
+  DoNotOptimize(visibleIndices[0]);
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
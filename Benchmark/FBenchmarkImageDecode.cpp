@@ -0,0 +1,274 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <string>
+#include <vector>
+#include "FBenchmark.h"
+#include "Library/DImageBuffer.h"
+#include "Library/FImageDecodePool.h"
+
+namespace
+{
+
+/// Odd size not to hide row order mistakes of flipping.
+constexpr TU32 kImageWidth  = 61;
+constexpr TU32 kImageHeight = 37;
+/// Width 1 RGB PNG makes inflated rows (1 filter byte + 3 bytes) same size as RGBA output,
+/// so stb_image takes caller memory for inflated data and output must be copied.
+constexpr TU32 kStripHeight = 64;
+constexpr TU32 kBenchmarkSize = 1024;
+constexpr TU32 kPoolRequestCount = 16;
+
+/// @brief RGB of texel (x, y) of test images.
+void GetTexel(TU32 iX, TU32 iY, TU08* outRgb) noexcept
+{
+  outRgb[0] = static_cast<TU08>(iX * 7 + iY * 3);
+  outRgb[1] = static_cast<TU08>(iX * 5 + iY * 11);
+  outRgb[2] = static_cast<TU08>(iX + iY * 13);
+}
+
+/// @brief Get RGBA8 pixels that decoder must return for test image, top-down or bottom-up.
+std::vector<TU08> GetExpectedPixels(TU32 iWidth, TU32 iHeight, bool iIsFlipVertically)
+{
+  std::vector<TU08> pixels(std::size_t(iWidth) * iHeight * 4);
+  for (TU32 y = 0; y < iHeight; ++y)
+  {
+    const TU32 row = iIsFlipVertically == true ? iHeight - 1 - y : y;
+    for (TU32 x = 0; x < iWidth; ++x)
+    {
+      TU08* texel = pixels.data() + (std::size_t(row) * iWidth + x) * 4;
+      GetTexel(x, y, texel);
+      texel[3] = 255;
+    }
+  }
+  return pixels;
+}
+
+/// @brief Write test image as binary PPM (P6).
+bool WritePpm(const std::string& iPath, TU32 iWidth, TU32 iHeight)
+{
+  std::ofstream file{iPath, std::ios::binary | std::ios::trunc};
+  file << "P6\n" << iWidth << ' ' << iHeight << "\n255\n";
+  for (TU32 y = 0; y < iHeight; ++y)
+  {
+    for (TU32 x = 0; x < iWidth; ++x)
+    {
+      TU08 rgb[3];
+      GetTexel(x, y, rgb);
+      file.write(reinterpret_cast<const char*>(rgb), 3);
+    }
+  }
+  return file.good();
+}
+
+TU32 GetCrc32(const TU08* iBytes, std::size_t iSize, TU32 iCrc = 0xFFFFFFFFu) noexcept
+{
+  for (std::size_t i = 0; i < iSize; ++i)
+  {
+    iCrc ^= iBytes[i];
+    for (TU32 bit = 0; bit < 8; ++bit) { iCrc = (iCrc >> 1) ^ (0xEDB88320u & (0u - (iCrc & 1))); }
+  }
+  return iCrc;
+}
+
+void AppendBigEndian(std::vector<TU08>& ioBytes, TU32 iValue)
+{
+  for (TI32 shift = 24; shift >= 0; shift -= 8) { ioBytes.push_back(static_cast<TU08>(iValue >> shift)); }
+}
+
+void AppendChunk(std::vector<TU08>& ioFile, const char (&iType)[5], const std::vector<TU08>& iData)
+{
+  AppendBigEndian(ioFile, static_cast<TU32>(iData.size()));
+  const std::size_t typeOffset = ioFile.size();
+  ioFile.insert(ioFile.end(), iType, iType + 4);
+  ioFile.insert(ioFile.end(), iData.begin(), iData.end());
+  AppendBigEndian(ioFile, GetCrc32(ioFile.data() + typeOffset, ioFile.size() - typeOffset) ^ 0xFFFFFFFFu);
+}
+
+/// @brief Write test image as 8-bit RGB PNG, of which zlib stream has only stored blocks.
+bool WritePng(const std::string& iPath, TU32 iWidth, TU32 iHeight)
+{
+  std::vector<TU08> rows;
+  for (TU32 y = 0; y < iHeight; ++y)
+  {
+    rows.push_back(0); // No filter.
+    for (TU32 x = 0; x < iWidth; ++x)
+    {
+      TU08 rgb[3];
+      GetTexel(x, y, rgb);
+      rows.insert(rows.end(), rgb, rgb + 3);
+    }
+  }
+
+  std::vector<TU08> zlib = {0x78, 0x01};
+  for (std::size_t offset = 0; offset < rows.size(); offset += 65535)
+  {
+    const std::size_t size = std::min<std::size_t>(rows.size() - offset, 65535);
+    zlib.push_back(offset + size == rows.size() ? 1 : 0);
+    zlib.push_back(static_cast<TU08>(size));
+    zlib.push_back(static_cast<TU08>(size >> 8));
+    zlib.push_back(static_cast<TU08>(~size));
+    zlib.push_back(static_cast<TU08>(~size >> 8));
+    zlib.insert(zlib.end(), rows.begin() + offset, rows.begin() + offset + size);
+  }
+  TU32 a = 1, b = 0;
+  for (const TU08 byte : rows) { a = (a + byte) % 65521; b = (b + a) % 65521; }
+  AppendBigEndian(zlib, (b << 16) | a);
+
+  std::vector<TU08> header;
+  AppendBigEndian(header, iWidth);
+  AppendBigEndian(header, iHeight);
+  header.insert(header.end(), {8, 2, 0, 0, 0}); // 8-bit, RGB, deflate, no filter set, no interlace.
+
+  std::vector<TU08> bytes = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  AppendChunk(bytes, "IHDR", header);
+  AppendChunk(bytes, "IDAT", zlib);
+  AppendChunk(bytes, "IEND", {});
+
+  std::ofstream file{iPath, std::ios::binary | std::ios::trunc};
+  file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+  return file.good();
+}
+
+/// @struct DTestImage
+/// @brief Test image file and whether DecodeImageInto is expected to decode it into caller memory directly.
+struct DTestImage final
+{
+  std::string mPath;
+  TU32        mWidth;
+  TU32        mHeight;
+  bool        mIsDirect;
+};
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunImageDecodeBenchmark()
+{
+  bool isSucceeded = true;
+  const auto directory = std::filesystem::temp_directory_path();
+  const DTestImage images[] = {
+      {(directory / "DyBenchmarkImage.ppm").string(), kImageWidth, kImageHeight, true},
+      {(directory / "DyBenchmarkImageStrip.png").string(), 1, kStripHeight, false}};
+  const std::string largePath = (directory / "DyBenchmarkImageLarge.ppm").string();
+  if (WritePpm(images[0].mPath, kImageWidth, kImageHeight) == false
+  ||  WritePng(images[1].mPath, 1, kStripHeight) == false
+  ||  WritePpm(largePath, kBenchmarkSize, kBenchmarkSize) == false)
+  {
+    std::printf("Failed to write test images.\n");
+    return false;
+  }
+
+  for (const auto& image : images)
+  {
+    const std::size_t size = std::size_t(image.mWidth) * image.mHeight * 4;
+    for (const bool isFlip : {false, true})
+    {
+      // PPM is converted into allocation of output size, which is caller memory.
+      // PNG strip is inflated into caller memory first, so output is allocated on heap and copied.
+      std::vector<TU08> pixels(size);
+      bool isDirect = !image.mIsDirect;
+      if (DecodeImageInto(image.mPath, isFlip, pixels.data(), size, &isDirect) == false
+      ||  pixels != GetExpectedPixels(image.mWidth, image.mHeight, isFlip))
+      {
+        std::printf("DecodeImageInto does not decode %s (flip %d).\n", image.mPath.c_str(), int(isFlip));
+        isSucceeded = false;
+      }
+      if (isDirect != image.mIsDirect)
+      {
+        std::printf("DecodeImageInto %s %s.\n", image.mPath.c_str(),
+            image.mIsDirect == true ? "does not decode into caller memory" : "does not take fallback copy");
+        isSucceeded = false;
+      }
+    }
+
+    // Size mismatch is refused and caller memory is not written.
+    for (const std::size_t wrongSize : {size - 4, size + 4})
+    {
+      std::vector<TU08> pixels(size + 4, 0xCD);
+      if (DecodeImageInto(image.mPath, true, pixels.data(), wrongSize) == true
+      ||  std::count(pixels.begin(), pixels.end(), TU08(0xCD)) != std::ptrdiff_t(pixels.size()))
+      {
+        std::printf("DecodeImageInto accepts %s into %zu bytes.\n", image.mPath.c_str(), wrongSize);
+        isSucceeded = false;
+      }
+    }
+  }
+  {
+    std::vector<TU08> pixels(16);
+    if (DecodeImageInto((directory / "DyBenchmarkImageMissing.png").string(), true, pixels.data(), pixels.size()) == true)
+    {
+      std::printf("DecodeImageInto accepts missing image.\n");
+      isSucceeded = false;
+    }
+  }
+
+  // Requests of different flip flags and images run at once on workers, and each keeps its own flag.
+  {
+    FImageDecodePool pool{4};
+    std::vector<std::vector<TU08>> outputs(kPoolRequestCount);
+    std::vector<std::future<bool>> decodes;
+    std::vector<std::future<DDyImageBinaryDataBuffer>> buffers;
+    for (TU32 i = 0; i < kPoolRequestCount; ++i)
+    {
+      const auto& image = images[(i / 2) % 2];
+      const DImageDecodeRequest request = {image.mPath, (i % 2) == 1};
+      outputs[i].resize(std::size_t(image.mWidth) * image.mHeight * 4);
+      decodes.emplace_back(pool.DecodeInto(request, outputs[i].data(), outputs[i].size()));
+      buffers.emplace_back(pool.Decode(request));
+    }
+    for (TU32 i = 0; i < kPoolRequestCount; ++i)
+    {
+      const auto& image = images[(i / 2) % 2];
+      const auto expected = GetExpectedPixels(image.mWidth, image.mHeight, (i % 2) == 1);
+      const auto buffer = buffers[i].get();
+      if (decodes[i].get() == false || outputs[i] != expected
+      ||  buffer.IsBufferCreatedProperly() == false || buffer.GetBufferSize() != expected.size()
+      ||  std::memcmp(buffer.GetBufferStartPoint(), expected.data(), expected.size()) != 0)
+      {
+        std::printf("FImageDecodePool request %u does not keep its flip flag.\n", i);
+        isSucceeded = false;
+      }
+    }
+  }
+
+  // Decoding into caller memory skips one copy of whole image. Divide ns by 1e6 to get ms.
+  {
+    std::vector<TU08> pixels(std::size_t(kBenchmarkSize) * kBenchmarkSize * 4);
+    ReportValue("ImageDecode", "Buffer + copy (1024^2 PPM)", MeasureNsPerCall(4, [&](TU32)
+    {
+      const DDyImageBinaryDataBuffer buffer{largePath, false};
+      std::memcpy(pixels.data(), buffer.GetBufferStartPoint(), pixels.size());
+    }) / 1e6, "ms");
+    ReportValue("ImageDecode", "DecodeImageInto (1024^2 PPM)", MeasureNsPerCall(4, [&](TU32)
+    {
+      DoNotOptimize(DecodeImageInto(largePath, false, pixels.data(), pixels.size()));
+    }) / 1e6, "ms");
+    DoNotOptimize(pixels[0]);
+  }
+
+  std::error_code error;
+  for (const auto& image : images) { std::filesystem::remove(image.mPath, error); }
+  std::filesystem::remove(largePath, error);
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
@@ -0,0 +1,127 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "FBenchmark.h"
+#include "Type/DVector3.h"
+#include "Type/FHelperIndexBuffer.h"
+#include "Type/FHelperMeshOptimize.h"
+
+namespace
+{
+
+/// @brief Create grid of `iGridSize` x `iGridSize` quads, optimized in order of LoadModel.
+void CreateOptimizedGrid(TU32 iGridSize, std::vector<dy::DVector3>& outPositions, std::vector<TU32>& outIndices)
+{
+  const TU32 rowCount = iGridSize + 1;
+  outPositions.clear();
+  outIndices.clear();
+  for (TU32 z = 0; z < rowCount; ++z)
+  {
+    for (TU32 x = 0; x < rowCount; ++x) { outPositions.emplace_back(float(x), 0.0f, float(z)); }
+  }
+  for (TU32 z = 0; z < iGridSize; ++z)
+  {
+    for (TU32 x = 0; x < iGridSize; ++x)
+    {
+      const TU32 v0 = z * rowCount + x;
+      outIndices.insert(outIndices.end(), {v0, v0 + 1, v0 + rowCount + 1, v0 + rowCount + 1, v0 + rowCount, v0});
+    }
+  }
+
+  const auto vertexCount = static_cast<TU32>(outPositions.size());
+  dy::OptimizeVertexCache(outIndices.data(), outIndices.size(), vertexCount, outIndices.data());
+  dy::OptimizeVertexFetch(outPositions.data(), vertexCount, sizeof(dy::DVector3), outIndices.data(), outIndices.size());
+}
+
+/// @brief Check that GPU would fetch same source vertices by index plus vertex offset of submesh.
+bool IsSameToSource(const std::vector<TU32>& iIndices, const dy::DIndexBufferLayout& iLayout, const std::vector<unsigned char>& iBuffer)
+{
+  std::size_t drawnCount = 0;
+  for (const auto& submesh : iLayout.mSubmeshes)
+  {
+    if (submesh.mFirstIndex != drawnCount) { return false; }
+    for (TU32 i = submesh.mFirstIndex; i < submesh.mFirstIndex + submesh.mIndexCount; ++i)
+    {
+      const TU32 vertex = iLayout.mIs16Bit == true
+          ? reinterpret_cast<const TU16*>(iBuffer.data())[i] + submesh.mVertexOffset
+          : reinterpret_cast<const TU32*>(iBuffer.data())[i] + submesh.mVertexOffset;
+      if (vertex >= iLayout.GetVertexCount()) { return false; }
+      const TU32 sourceVertex = iLayout.mVertexRemap.empty() == true ? vertex : iLayout.mVertexRemap[vertex];
+      if (sourceVertex != iIndices[i]) { return false; }
+    }
+    drawnCount += submesh.mIndexCount;
+  }
+  return drawnCount == iIndices.size();
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunIndexBufferBenchmark()
+{
+  // 128 x 128 grid fits in one 16-bit submesh, and larger grids must be split.
+  bool isSucceeded = true;
+  for (const TU32 gridSize : {128u, 256u, 1024u})
+  {
+    std::vector<DVector3> positions;
+    std::vector<TU32> indices;
+    CreateOptimizedGrid(gridSize, positions, indices);
+    const auto vertexCount = static_cast<TU32>(positions.size());
+
+    const auto layout = CreateIndexBufferLayout(indices.data(), indices.size(), vertexCount, sizeof(DVector3));
+    std::vector<unsigned char> buffer(layout.GetIndexSize() * indices.size());
+    WriteIndexBuffer(indices.data(), indices.size(), layout, buffer.data());
+    if (layout.mIs16Bit == false || IsSameToSource(indices, layout, buffer) == false)
+    {
+      std::printf("Index buffer of %u x %u grid is not 16-bit or not same to source indices.\n", gridSize, gridSize);
+      isSucceeded = false;
+    }
+
+    const std::string suffix = " (" + std::to_string(gridSize) + " grid)";
+    ReportValue("IndexBuffer", ("Submeshes" + suffix).c_str(), TF64(layout.mSubmeshes.size()), "draws");
+    ReportValue("IndexBuffer", ("Index bytes" + suffix).c_str(), TF64(buffer.size()), "bytes");
+    ReportValue("IndexBuffer", ("32-bit index bytes" + suffix).c_str(), TF64(sizeof(TU32) * indices.size()), "bytes");
+    ReportValue("IndexBuffer", ("Vertex buffer vertices" + suffix).c_str(), TF64(layout.GetVertexCount()), "vertices");
+    ReportValue("IndexBuffer", ("Source vertices" + suffix).c_str(), TF64(vertexCount), "vertices");
+
+    const auto indexCount = TF64(indices.size());
+    Report("IndexBuffer", ("CreateIndexBufferLayout (index)" + suffix).c_str(), MeasureNsPerCall(1, [&](TU32)
+    {
+      DoNotOptimize(CreateIndexBufferLayout(indices.data(), indices.size(), vertexCount, sizeof(DVector3)));
+    }) / indexCount);
+    Report("IndexBuffer", ("WriteIndexBuffer (index)" + suffix).c_str(), MeasureNsPerCall(1, [&](TU32)
+    {
+      WriteIndexBuffer(indices.data(), indices.size(), layout, buffer.data());
+    }) / indexCount);
+    DoNotOptimize(buffer[0]);
+  }
+
+  // Triangle which spans more than 16 bits is drawn with own vertices of submesh.
+  const std::vector<TU32> farIndices = {0, 1, 70000, 70000, 1, 2};
+  const auto farLayout = CreateIndexBufferLayout(farIndices.data(), farIndices.size(), 70001, sizeof(DVector3), 0);
+  std::vector<unsigned char> farBuffer(farLayout.GetIndexSize() * farIndices.size());
+  WriteIndexBuffer(farIndices.data(), farIndices.size(), farLayout, farBuffer.data());
+  if (farLayout.mIs16Bit == false || farLayout.GetVertexCount() != 4 || IsSameToSource(farIndices, farLayout, farBuffer) == false)
+  {
+    std::printf("Index buffer of triangle which spans more than 16 bits is not same to source indices.\n");
+    isSucceeded = false;
+  }
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
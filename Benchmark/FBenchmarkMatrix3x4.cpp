@@ -0,0 +1,153 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include "FBenchmark.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include "Type/DMatrix3x4.h"
+#include "Type/FHelperTransform.h"
+
+namespace
+{
+
+/// Not multiple of 4, to exercise remainder path.
+constexpr TU32 kInstanceCount = 1027;
+constexpr TU32 kIterations    = 1 << 20;
+
+/// @brief Check given float arrays are nearly same with relative tolerance.
+bool IsNearlyEqual(const float* lhs, const float* rhs, std::size_t iCount) noexcept
+{
+  for (std::size_t i = 0; i < iCount; ++i)
+  {
+    if (std::abs(lhs[i] - rhs[i]) > 1e-4f * std::max(1.0f, std::abs(rhs[i]))) { return false; }
+  }
+  return true;
+}
+
+bool IsNearlyEqual(const dy::DMatrix4& lhs, const dy::DMatrix4& rhs) noexcept
+{
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    if (IsNearlyEqual(lhs[i].Data(), rhs[i].Data(), 4) == false) { return false; }
+  }
+  return true;
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunMatrix3x4Benchmark()
+{
+  std::mt19937 engine{0x5EED};
+  std::uniform_real_distribution<TF32> distribution{-180.0f, 180.0f};
+
+  std::vector<DVector3> positions(kInstanceCount), scales(kInstanceCount);
+  std::vector<DQuaternion> rotations(kInstanceCount);
+  for (TU32 i = 0; i < kInstanceCount; ++i)
+  {
+    positions[i] = DVector3{distribution(engine), distribution(engine), distribution(engine)};
+    rotations[i] = DQuaternion{DVector3{distribution(engine), distribution(engine), distribution(engine)}};
+    scales[i] = DVector3{
+        1.0f + std::abs(distribution(engine)) / 90.0f, 0.5f, 1.0f + std::abs(distribution(engine)) / 180.0f};
+  }
+  std::vector<DMatrix4> matrices4(kInstanceCount), outMatrices4(kInstanceCount);
+  std::vector<DMatrix3x4> matrices(kInstanceCount), outMatrices(kInstanceCount);
+  ComposeTransforms(positions.data(), rotations.data(), scales.data(), kInstanceCount, matrices4.data());
+  ComposeTransforms(positions.data(), rotations.data(), scales.data(), kInstanceCount, matrices.data());
+
+  // Verify results with DMatrix4 before measuring.
+  bool isSucceeded = true;
+  for (TU32 i = 0; i < kInstanceCount; ++i)
+  {
+    const auto& matrix = matrices[i];
+    const auto& rhs = matrices[(i + 1) % kInstanceCount];
+    const auto& matrix4 = matrices4[i];
+    const auto& rhs4 = matrices4[(i + 1) % kInstanceCount];
+    const auto point = matrix.MultiplyPoint(positions[i]);
+    const auto point4 = matrix4.MultiplyVector(DVector4{positions[i].X, positions[i].Y, positions[i].Z, 1.0f});
+    const auto direction = matrix.MultiplyDirection(positions[i]);
+    const auto direction4 = matrix4.MultiplyVector(DVector4{positions[i].X, positions[i].Y, positions[i].Z, 0.0f});
+
+    DVector3 translation, scale;
+    DQuaternion rotation;
+    const bool isDecomposed = matrix.Decompose(translation, rotation, scale);
+    const auto recomposed = DMatrix3x4::CreateWithTransform(translation, rotation, scale);
+
+    if (IsNearlyEqual(static_cast<DMatrix4>(matrix), matrix4) == false
+    ||  static_cast<DMatrix4>(DMatrix3x4{matrix4}) != matrix4
+    ||  IsNearlyEqual(static_cast<DMatrix4>(matrix.Multiply(rhs)), matrix4.Multiply(rhs4)) == false
+    ||  IsNearlyEqual(static_cast<DMatrix4>(matrix.Inverse()), matrix4.Inverse()) == false
+    ||  IsNearlyEqual(static_cast<DMatrix4>(matrix.Multiply(matrix.Inverse())), DMatrix4::Identity()) == false
+    ||  IsNearlyEqual(point.Data(), point4.Data(), 3) == false
+    ||  IsNearlyEqual(direction.Data(), direction4.Data(), 3) == false
+    ||  isDecomposed == false
+    ||  IsNearlyEqual(recomposed.Data(), matrix.Data(), 12) == false)
+    {
+      std::printf("DMatrix3x4 is not same to DMatrix4 at %u.\n", i);
+      isSucceeded = false; break;
+    }
+  }
+
+  // Mirrored matrix must be decomposed to negative scale.
+  {
+    const auto mirrored = DMatrix3x4::CreateWithTransform(positions[0], rotations[0], DVector3{-2.0f, 1.0f, 3.0f});
+    DVector3 translation, scale;
+    DQuaternion rotation;
+    mirrored.Decompose(translation, rotation, scale);
+    const auto recomposed = DMatrix3x4::CreateWithTransform(translation, rotation, scale);
+    if (IsNearlyEqual(recomposed.Data(), mirrored.Data(), 12) == false)
+    {
+      std::printf("DMatrix3x4 mirrored decomposition is not same.\n");
+      isSucceeded = false;
+    }
+  }
+
+  constexpr TU32 mask = 1023;
+  Report("DMatrix3x4", "Multiply", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outMatrices[i & mask] = matrices[i & mask].Multiply(matrices[(i + 1) & mask]);
+  }));
+  Report("DMatrix3x4", "Multiply (DMatrix4)", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outMatrices4[i & mask] = matrices4[i & mask].Multiply(matrices4[(i + 1) & mask]);
+  }));
+  Report("DMatrix3x4", "Inverse", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outMatrices[i & mask] = matrices[i & mask].Inverse();
+  }));
+  Report("DMatrix3x4", "InverseAffine (DMatrix4)", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outMatrices4[i & mask] = matrices4[i & mask].InverseAffine();
+  }));
+  // Compose is called per kInstanceCount instances, so divide by kInstanceCount.
+  Report("DMatrix3x4", "ComposeTransforms (per instance)", MeasureNsPerCall(kIterations / kInstanceCount, [&](TU32)
+  {
+    ComposeTransforms(positions.data(), rotations.data(), scales.data(), kInstanceCount, matrices.data());
+  }) / kInstanceCount);
+  Report("DMatrix3x4", "ComposeTransforms (DMatrix4)", MeasureNsPerCall(kIterations / kInstanceCount, [&](TU32)
+  {
+    ComposeTransforms(positions.data(), rotations.data(), scales.data(), kInstanceCount, matrices4.data());
+  }) / kInstanceCount);
+
+  DoNotOptimize(outMatrices[0]);
+  DoNotOptimize(outMatrices4[0]);
+  DoNotOptimize(matrices[0]);
+  DoNotOptimize(matrices4[0]);
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
@@ -0,0 +1,259 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "FBenchmark.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include "Type/DMatrix4.h"
+
+namespace
+{
+
+// Math types must be folded in constant evaluation without touching SIMD paths.
+static_assert(dy::DVector3::Cross(dy::DVector3::RightX(), dy::DVector3::UpY()) == dy::DVector3::FrontZ());
+static_assert(dy::DMatrix4::Identity().Transpose()[3] == dy::DVector4{0, 0, 0, 1});
+static_assert(dy::DMatrix4::CreateWithTranslation({1, 2, 3})
+    .Multiply(dy::DMatrix4::CreateWithScale(dy::DVector3{2}))
+    .MultiplyVector({1, 1, 1, 1}) == dy::DVector4{3, 4, 5, 1});
+
+constexpr TU32 kMatrixCount = 1024;
+constexpr TU32 kIterations  = 1 << 20;
+
+/// @brief Previous scalar implementation of DMatrix4::Multiply, kept as reference.
+dy::DMatrix4 MultiplyScalar(const dy::DMatrix4& lhs, const dy::DMatrix4& rhs) noexcept
+{
+  dy::DMatrix4 result;
+  for (std::size_t c = 0; c < 4; ++c)
+  {
+    for (std::size_t r = 0; r < 4; ++r)
+    {
+      result[c][r] = lhs[0][r] * rhs[c][0] + lhs[1][r] * rhs[c][1]
+                   + lhs[2][r] * rhs[c][2] + lhs[3][r] * rhs[c][3];
+    }
+  }
+  return result;
+}
+
+/// @brief Previous scalar implementation of DMatrix4::MultiplyVector, kept as reference.
+dy::DVector4 MultiplyVectorScalar(const dy::DMatrix4& lhs, const dy::DVector4& rhs) noexcept
+{
+  dy::DVector4 result;
+  for (std::size_t r = 0; r < 4; ++r)
+  {
+    result[r] = lhs[0][r] * rhs.X + lhs[1][r] * rhs.Y + lhs[2][r] * rhs.Z + lhs[3][r] * rhs.W;
+  }
+  return result;
+}
+
+/// @brief Check given float arrays are same to glm result. \n
+/// Results must be bit-exact, but FMA rounds differently so relative error is allowed for FMA.
+bool IsSameToGlm(const float* lhs, const float* rhs, std::size_t iCount) noexcept
+{
+#if defined(MDY_SIMD_FMA)
+  for (std::size_t i = 0; i < iCount; ++i)
+  {
+    if (std::abs(lhs[i] - rhs[i]) > 1e-5f * std::max(1.0f, std::abs(rhs[i]))) { return false; }
+  }
+  return true;
+#else
+  return std::memcmp(lhs, rhs, sizeof(float) * iCount) == 0;
+#endif
+}
+
+/// @brief Check given float arrays are nearly same with relative tolerance.
+bool IsNearlyEqual(const float* lhs, const float* rhs, std::size_t iCount, float iTolerance) noexcept
+{
+  for (std::size_t i = 0; i < iCount; ++i)
+  {
+    if (std::abs(lhs[i] - rhs[i]) > iTolerance * std::max(1.0f, std::abs(rhs[i]))) { return false; }
+  }
+  return true;
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunMatrix4Benchmark()
+{
+  std::mt19937 engine{0x5EED};
+  std::uniform_real_distribution<TF32> distribution{-10.0f, 10.0f};
+
+  std::vector<DMatrix4> lhsList(kMatrixCount), rhsList(kMatrixCount), outList(kMatrixCount);
+  std::vector<glm::mat4> glmLhsList(kMatrixCount), glmRhsList(kMatrixCount), glmOutList(kMatrixCount);
+  std::vector<DVector4> vectorList(kMatrixCount), outVectorList(kMatrixCount);
+  std::vector<glm::vec4> glmOutVectorList(kMatrixCount);
+  for (TU32 i = 0; i < kMatrixCount; ++i)
+  {
+    for (std::size_t c = 0; c < 4; ++c)
+    {
+      for (std::size_t r = 0; r < 4; ++r)
+      {
+        lhsList[i][c][r] = distribution(engine);
+        rhsList[i][c][r] = distribution(engine);
+      }
+      vectorList[i][c] = distribution(engine);
+    }
+    glmLhsList[i] = static_cast<glm::mat4>(lhsList[i]);
+    glmRhsList[i] = static_cast<glm::mat4>(rhsList[i]);
+  }
+
+  // Verify results before measuring.
+  bool isSucceeded = true;
+  for (TU32 i = 0; i < kMatrixCount; ++i)
+  {
+    const auto matrix = static_cast<glm::mat4>(lhsList[i].Multiply(rhsList[i]));
+    const auto glmMatrix = glmLhsList[i] * glmRhsList[i];
+    if (IsSameToGlm(&matrix[0][0], &glmMatrix[0][0], 16) == false)
+    {
+      std::printf("DMatrix4::Multiply is not bit-exact to glm at %u.\n", i);
+      isSucceeded = false; break;
+    }
+    const auto vector = lhsList[i].MultiplyVector(vectorList[i]);
+    const auto glmVector = glmLhsList[i] * static_cast<glm::vec4>(vectorList[i]);
+    if (IsSameToGlm(vector.Data(), &glmVector[0], 4) == false)
+    {
+      std::printf("DMatrix4::MultiplyVector is not bit-exact to glm at %u.\n", i);
+      isSucceeded = false; break;
+    }
+    const auto transpose = static_cast<glm::mat4>(lhsList[i].Transpose());
+    const auto glmTranspose = glm::transpose(glmLhsList[i]);
+    if (std::memcmp(&transpose[0][0], &glmTranspose[0][0], sizeof(glm::mat4)) != 0)
+    {
+      std::printf("DMatrix4::Transpose is not same to glm at %u.\n", i);
+      isSucceeded = false; break;
+    }
+  }
+
+  // Inverse inputs. General matrices are made diagonally dominant to be well-conditioned,
+  // and affine matrices are composed of translation, rotation and non-uniform scale.
+  std::vector<DMatrix4> generalList(kMatrixCount), affineList(kMatrixCount), inverseList(kMatrixCount);
+  std::vector<glm::mat4> glmGeneralList(kMatrixCount), glmAffineList(kMatrixCount), glmInverseList(kMatrixCount);
+  for (TU32 i = 0; i < kMatrixCount; ++i)
+  {
+    glmGeneralList[i] = glmLhsList[i] + glm::mat4(40.0f);
+    glmAffineList[i] = glm::scale(
+        glm::rotate(
+            glm::translate(glm::mat4(1.0f), glm::vec3{distribution(engine), distribution(engine), distribution(engine)}),
+            distribution(engine),
+            glm::normalize(glm::vec3{distribution(engine), distribution(engine), 1.0f})),
+        glm::vec3{1.5f + std::abs(distribution(engine)), 0.5f, 2.0f});
+    generalList[i] = glmGeneralList[i];
+    affineList[i] = glmAffineList[i];
+  }
+  for (TU32 i = 0; i < kMatrixCount; ++i)
+  {
+    const auto inverse = static_cast<glm::mat4>(generalList[i].Inverse());
+    const auto glmInverse = glm::inverse(glmGeneralList[i]);
+    if (IsNearlyEqual(&inverse[0][0], &glmInverse[0][0], 16, 1e-4f) == false)
+    {
+      std::printf("DMatrix4::Inverse is not same to glm at %u.\n", i);
+      isSucceeded = false; break;
+    }
+    const auto affineInverse = static_cast<glm::mat4>(affineList[i].InverseAffine());
+    const auto glmAffineInverse = glm::inverse(glmAffineList[i]);
+    if (IsNearlyEqual(&affineInverse[0][0], &glmAffineInverse[0][0], 16, 1e-4f) == false)
+    {
+      std::printf("DMatrix4::InverseAffine is not same to glm at %u.\n", i);
+      isSucceeded = false; break;
+    }
+  }
+
+  constexpr TU32 mask = kMatrixCount - 1;
+  Report("DMatrix4", "Construct", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    const auto& v = vectorList[i & mask];
+    outList[i & mask] = DMatrix4{v.X, v.Y, v.Z, v.W, v.Y, v.Z, v.W, v.X, v.Z, v.W, v.X, v.Y, v.W, v.X, v.Y, v.Z};
+  }));
+  Report("DMatrix4", "Construct (glm)", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    const auto& v = vectorList[i & mask];
+    glmOutList[i & mask] = glm::mat4{v.X, v.Y, v.Z, v.W, v.Y, v.Z, v.W, v.X, v.Z, v.W, v.X, v.Y, v.W, v.X, v.Y, v.Z};
+  }));
+  Report("DMatrix4", "FromGlm", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outList[i & mask] = DMatrix4{glmLhsList[i & mask]};
+  }));
+  Report("DMatrix4", "ToGlm", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    glmOutList[i & mask] = static_cast<glm::mat4>(lhsList[i & mask]);
+  }));
+  Report("DMatrix4", "Transpose", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outList[i & mask] = lhsList[i & mask].Transpose();
+  }));
+  Report("DMatrix4", "Transpose (glm)", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    glmOutList[i & mask] = glm::transpose(glmLhsList[i & mask]);
+  }));
+  Report("DMatrix4", "Multiply (scalar)", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outList[i & mask] = MultiplyScalar(lhsList[i & mask], rhsList[(i + 1) & mask]);
+  }));
+  Report("DMatrix4", "Multiply", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outList[i & mask] = lhsList[i & mask].Multiply(rhsList[(i + 1) & mask]);
+  }));
+  Report("DMatrix4", "Multiply (glm)", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    glmOutList[i & mask] = glmLhsList[i & mask] * glmRhsList[(i + 1) & mask];
+  }));
+  Report("DMatrix4", "MultiplyVector (scalar)", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outVectorList[i & mask] = MultiplyVectorScalar(lhsList[i & mask], vectorList[(i + 1) & mask]);
+  }));
+  Report("DMatrix4", "MultiplyVector", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outVectorList[i & mask] = lhsList[i & mask].MultiplyVector(vectorList[(i + 1) & mask]);
+  }));
+  Report("DMatrix4", "MultiplyVector (glm)", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    glmOutVectorList[i & mask] = glmLhsList[i & mask] * static_cast<glm::vec4>(vectorList[(i + 1) & mask]);
+  }));
+
+  Report("DMatrix4", "Inverse", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    inverseList[i & mask] = generalList[i & mask].Inverse();
+  }));
+  Report("DMatrix4", "InverseAffine", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    inverseList[i & mask] = affineList[i & mask].InverseAffine();
+  }));
+  Report("DMatrix4", "Inverse (glm)", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    glmInverseList[i & mask] = glm::inverse(glmGeneralList[i & mask]);
+  }));
+  // Batch functions are called per kMatrixCount matrices, so divide by kMatrixCount.
+  Report("DMatrix4", "InverseBatch (per matrix)", MeasureNsPerCall(kIterations / kMatrixCount, [&](TU32)
+  {
+    DMatrix4::InverseBatch(generalList.data(), kMatrixCount, inverseList.data());
+  }) / kMatrixCount);
+  Report("DMatrix4", "InverseAffineBatch (per matrix)", MeasureNsPerCall(kIterations / kMatrixCount, [&](TU32)
+  {
+    DMatrix4::InverseAffineBatch(affineList.data(), kMatrixCount, inverseList.data());
+  }) / kMatrixCount);
+
+  DoNotOptimize(inverseList[0]);
+  DoNotOptimize(glmInverseList[0]);
+  DoNotOptimize(outList[0]);
+  DoNotOptimize(glmOutList[0]);
+  DoNotOptimize(outVectorList[0]);
+  DoNotOptimize(glmOutVectorList[0]);
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
@@ -0,0 +1,217 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "FBenchmark.h"
+#include "Library/DMeshCache.h"
+
+namespace
+{
+
+constexpr TU32 kVertexStride = 16;
+/// Vertex and index count of large cache, of which open time is dominated by index validation.
+constexpr TU32 kLargeCount = TU32(1) << 20;
+/// Dequantization stored in cache, which must be read back as is.
+const dy::DCompactVertexDequantization kDequantization = {
+    dy::DVector3{-1.0f, 2.0f, 0.5f}, dy::DVector3{4.0f, 1.0f, 0.25f}, dy::DVector2{0.0f, -1.0f}, dy::DVector2{2.0f, 3.0f}};
+
+/// @struct DCacheInput
+/// @brief Arrays of one cache, edited by each case to be written as invalid cache.
+struct DCacheInput final
+{
+  std::vector<float>                mVertices;
+  std::vector<TU32>                 mIndices;
+  /// Indices are written as TU16 when true.
+  bool                              mIs16Bit = false;
+  std::vector<dy::DIndexSubmesh>    mSubmeshes;
+  std::vector<dy::DMeshlet>         mMeshlets;
+  std::vector<dy::DMeshletBounds>   mMeshletBounds;
+  std::vector<dy::DMeshLod>         mLods;
+};
+
+/// @brief Quad of 4 vertices and 2 triangles, as one submesh, one meshlet and one LOD.
+DCacheInput CreateQuad()
+{
+  DCacheInput input;
+  input.mVertices = {0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0};
+  input.mIndices = {0, 1, 2, 0, 2, 3};
+  input.mSubmeshes = {dy::DIndexSubmesh{0, 6, 0}};
+  input.mMeshlets = {dy::DMeshlet{0, 2, 4}};
+  input.mMeshletBounds = {dy::DMeshletBounds{}};
+  input.mLods = {dy::DMeshLod{0, 6, 0, 1, 0.0f}};
+  return input;
+}
+
+bool WriteCache(const std::string& iCachePath, const std::string& iSourcePath, const DCacheInput& iInput)
+{
+  const std::vector<TU16> indices16(iInput.mIndices.begin(), iInput.mIndices.end());
+  return dy::DMeshCache::Write(
+      iCachePath, iSourcePath,
+      iInput.mVertices.data(), kVertexStride, static_cast<TU32>(iInput.mVertices.size() * sizeof(float) / kVertexStride),
+      iInput.mIs16Bit == true ? static_cast<const void*>(indices16.data()) : iInput.mIndices.data(),
+      static_cast<TU32>(iInput.mIs16Bit == true ? sizeof(TU16) : sizeof(TU32)), static_cast<TU32>(iInput.mIndices.size()),
+      iInput.mSubmeshes.data(), static_cast<TU32>(iInput.mSubmeshes.size()),
+      dy::DAabb{}, kDequantization,
+      iInput.mMeshlets.data(), iInput.mMeshletBounds.data(), static_cast<TU32>(iInput.mMeshlets.size()),
+      iInput.mLods.data(), static_cast<TU32>(iInput.mLods.size()));
+}
+
+std::vector<char> ReadFile(const std::string& iPath)
+{
+  std::ifstream file{iPath, std::ios::binary};
+  return std::vector<char>{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+bool WriteFile(const std::string& iPath, const std::vector<char>& iBytes)
+{
+  std::ofstream file{iPath, std::ios::binary | std::ios::trunc};
+  file.write(iBytes.data(), static_cast<std::streamsize>(iBytes.size()));
+  return file.good();
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunMeshCacheBenchmark()
+{
+  namespace fs = std::filesystem;
+  bool isSucceeded = true;
+  const std::string sourcePath = (fs::temp_directory_path() / "DyBenchmarkMeshCache.obj").string();
+  const std::string cachePath = DMeshCache::GetCachePath(sourcePath);
+  if (WriteFile(sourcePath, {'v', ' ', '0', '\n'}) == false)
+  {
+    std::printf("Failed to write mesh cache source.\n");
+    return false;
+  }
+
+  // Valid cache is accepted as written, in both index sizes.
+  const auto quad = CreateQuad();
+  const std::vector<TU16> quadIndices16(quad.mIndices.begin(), quad.mIndices.end());
+  for (const bool is16Bit : {false, true})
+  {
+    auto input = CreateQuad();
+    input.mIs16Bit = is16Bit;
+    const TU32 indexSize = is16Bit == true ? sizeof(TU16) : sizeof(TU32);
+    if (WriteCache(cachePath, sourcePath, input) == false) { isSucceeded = false; continue; }
+
+    const DMeshCache cache{cachePath, sourcePath, kVertexStride};
+    const auto dequantization = cache.IsValid() == true ? cache.GetDequantization() : DCompactVertexDequantization{};
+    if (cache.IsValid() == false
+    ||  cache.GetIndexSize() != indexSize
+    ||  std::memcmp(cache.GetIndices(), is16Bit == true ? static_cast<const void*>(quadIndices16.data()) : quad.mIndices.data(),
+            indexSize * quad.mIndices.size()) != 0
+    ||  cache.GetSubmeshCount() != 1 || cache.GetSubmeshes()[0].mIndexCount != 6
+    ||  dequantization.GetPositionMatrix() != kDequantization.GetPositionMatrix()
+    ||  dequantization.GetUvTransform() != kDequantization.GetUvTransform())
+    {
+      std::printf("Mesh cache of %u-bit indices is not same after it is written.\n", indexSize * 8);
+      isSucceeded = false;
+    }
+  }
+
+  // Payload which would be read out of bounds is refused.
+  const struct { const char* mName; void (*mEdit)(DCacheInput&); } invalidCases[] = {
+      {"index out of vertices",     [](DCacheInput& ioInput) { ioInput.mIndices[4] = 4; }},
+      {"index out of submesh",      [](DCacheInput& ioInput) { ioInput.mSubmeshes[0].mVertexOffset = 1; }},
+      {"submesh out of indices",    [](DCacheInput& ioInput) { ioInput.mSubmeshes[0].mIndexCount = 9; }},
+      {"indices out of submeshes",  [](DCacheInput& ioInput) { ioInput.mSubmeshes[0].mIndexCount = 3; }},
+      {"meshlet out of indices",    [](DCacheInput& ioInput) { ioInput.mMeshlets[0].mFirstIndex = 3; }},
+      {"LOD out of indices",        [](DCacheInput& ioInput) { ioInput.mLods[0].mIndexCount = 9; }},
+      {"LOD out of meshlets",       [](DCacheInput& ioInput) { ioInput.mLods[0].mMeshletCount = 2; }},
+  };
+  for (const auto& invalidCase : invalidCases)
+  {
+    auto input = CreateQuad();
+    invalidCase.mEdit(input);
+    if (WriteCache(cachePath, sourcePath, input) == false
+    ||  DMeshCache(cachePath, sourcePath, kVertexStride).IsValid() == true)
+    {
+      std::printf("Mesh cache accepts %s.\n", invalidCase.mName);
+      isSucceeded = false;
+    }
+  }
+
+  // LOD array is last, so its offset in header is file size - LOD size. Misaligned offset is refused.
+  if (WriteCache(cachePath, sourcePath, quad) == true)
+  {
+    auto bytes = ReadFile(cachePath);
+    const TU64 lodOffset = bytes.size() - sizeof(DMeshLod);
+    bool isTampered = false;
+    for (std::size_t i = 0; i + sizeof(TU64) <= 128 && isTampered == false; i += sizeof(TU64))
+    {
+      TU64 value = 0;
+      std::memcpy(&value, bytes.data() + i, sizeof(value));
+      if (value != lodOffset) { continue; }
+      value -= 2;
+      std::memcpy(bytes.data() + i, &value, sizeof(value));
+      isTampered = true;
+    }
+    if (isTampered == false || WriteFile(cachePath, bytes) == false
+    ||  DMeshCache(cachePath, sourcePath, kVertexStride).IsValid() == true)
+    {
+      std::printf("Mesh cache accepts misaligned LOD offset.\n");
+      isSucceeded = false;
+    }
+  }
+
+  // When source is only touched, cache is valid by hash and takes new time.
+  // Then source of same size and time is not hashed again, so even changed content is accepted.
+  if (WriteCache(cachePath, sourcePath, quad) == true)
+  {
+    const auto touchedTime = fs::last_write_time(sourcePath) + std::chrono::hours(1);
+    fs::last_write_time(sourcePath, touchedTime);
+    const bool isTouchedValid = DMeshCache(cachePath, sourcePath, kVertexStride).IsValid();
+    WriteFile(sourcePath, {'v', ' ', '1', '\n'});
+    fs::last_write_time(sourcePath, touchedTime);
+    if (isTouchedValid == false || DMeshCache(cachePath, sourcePath, kVertexStride).IsValid() == false)
+    {
+      std::printf("Mesh cache does not take new time of touched source.\n");
+      isSucceeded = false;
+    }
+  }
+
+  // Opening cache validates every index. Divide ns by 1e6 to get ms.
+  {
+    DCacheInput input;
+    input.mVertices.resize(std::size_t(kLargeCount) * kVertexStride / sizeof(float));
+    input.mIndices.resize(kLargeCount);
+    for (TU32 i = 0; i < kLargeCount; ++i) { input.mIndices[i] = (i * 7919u) % kLargeCount; }
+    input.mSubmeshes = {DIndexSubmesh{0, kLargeCount, 0}};
+    input.mLods = {DMeshLod{0, kLargeCount, 0, 0, 0.0f}};
+    if (WriteCache(cachePath, sourcePath, input) == false
+    ||  DMeshCache(cachePath, sourcePath, kVertexStride).IsValid() == false)
+    {
+      std::printf("Large mesh cache is not valid after it is written.\n");
+      isSucceeded = false;
+    }
+    ReportValue("MeshCache", "Open (1M vertices, 1M indices)", MeasureNsPerCall(8, [&](TU32)
+    {
+      DoNotOptimize(DMeshCache(cachePath, sourcePath, kVertexStride).IsValid());
+    }) / 1e6, "ms");
+  }
+
+  std::error_code error;
+  fs::remove(cachePath, error);
+  fs::remove(sourcePath, error);
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
@@ -0,0 +1,155 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "FBenchmark.h"
+#include "Type/DVector3.h"
+#include "Type/FHelperMeshOptimize.h"
+
+namespace
+{
+
+/// Grid of kGridSize x kGridSize quads, 2 triangles per quad.
+constexpr TU32 kGridSize = 256;
+
+using TTriangle = std::array<dy::DVector3, 3>;
+
+/// @brief Create grid vertices on XZ plane, and triangles in shuffled order as loaded model may have.
+void CreateShuffledGrid(std::vector<dy::DVector3>& outPositions, std::vector<TU32>& outIndices)
+{
+  constexpr TU32 rowCount = kGridSize + 1;
+  outPositions.clear();
+  for (TU32 z = 0; z < rowCount; ++z)
+  {
+    for (TU32 x = 0; x < rowCount; ++x) { outPositions.emplace_back(float(x), 0.0f, float(z)); }
+  }
+
+  std::vector<std::array<TU32, 3>> triangles;
+  for (TU32 z = 0; z < kGridSize; ++z)
+  {
+    for (TU32 x = 0; x < kGridSize; ++x)
+    {
+      const TU32 v0 = z * rowCount + x;
+      triangles.push_back({v0, v0 + 1, v0 + rowCount + 1});
+      triangles.push_back({v0 + rowCount + 1, v0 + rowCount, v0});
+    }
+  }
+  std::shuffle(triangles.begin(), triangles.end(), std::mt19937{0x5EED});
+
+  outIndices.clear();
+  for (const auto& triangle : triangles) { outIndices.insert(outIndices.end(), triangle.begin(), triangle.end()); }
+}
+
+/// @brief Collect triangles as positions, rotated to start from smallest corner to keep winding.
+std::vector<TTriangle> CollectTriangles(const std::vector<dy::DVector3>& iPositions, const std::vector<TU32>& iIndices)
+{
+  const auto isLess = [](const dy::DVector3& lhs, const dy::DVector3& rhs)
+  {
+    return std::make_tuple(lhs.X, lhs.Y, lhs.Z) < std::make_tuple(rhs.X, rhs.Y, rhs.Z);
+  };
+
+  std::vector<TTriangle> result;
+  for (std::size_t i = 0; i < iIndices.size(); i += 3)
+  {
+    TTriangle triangle = {iPositions[iIndices[i]], iPositions[iIndices[i + 1]], iPositions[iIndices[i + 2]]};
+    std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end(), isLess), triangle.end());
+    result.push_back(triangle);
+  }
+  std::sort(result.begin(), result.end(), [&isLess](const TTriangle& lhs, const TTriangle& rhs)
+  {
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), isLess);
+  });
+  return result;
+}
+
+void ReportCacheStats(const char* iStage, const dy::DVertexCacheStats& iStats)
+{
+  dy::bench::ReportValue("MeshOptimize", (std::string{"ACMR ("} + iStage + ")").c_str(), iStats.mAcmr, "vertices");
+  dy::bench::ReportValue("MeshOptimize", (std::string{"ATVR ("} + iStage + ")").c_str(), iStats.mAtvr, "vertices");
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunMeshOptimizeBenchmark()
+{
+  std::vector<DVector3> sourcePositions;
+  std::vector<TU32> sourceIndices;
+  CreateShuffledGrid(sourcePositions, sourceIndices);
+  const auto vertexCount = static_cast<TU32>(sourcePositions.size());
+  const auto triangleCount = TF64(sourceIndices.size() / 3);
+  const auto expectedTriangles = CollectTriangles(sourcePositions, sourceIndices);
+
+  // Run each stage in order of LoadModel, and verify triangles are kept.
+  auto positions = sourcePositions;
+  auto indices = sourceIndices;
+  ReportCacheStats("input", AnalyzeVertexCache(indices.data(), indices.size(), vertexCount));
+
+  OptimizeVertexCache(indices.data(), indices.size(), vertexCount, indices.data());
+  ReportCacheStats("vertex cache", AnalyzeVertexCache(indices.data(), indices.size(), vertexCount));
+  const bool isCacheSucceeded = CollectTriangles(positions, indices) == expectedTriangles;
+
+  OptimizeOverdraw(indices.data(), indices.size(), positions[0].Data(), sizeof(DVector3), vertexCount, indices.data());
+  ReportCacheStats("overdraw", AnalyzeVertexCache(indices.data(), indices.size(), vertexCount));
+  const bool isOverdrawSucceeded = CollectTriangles(positions, indices) == expectedTriangles;
+
+  const auto referencedCount = OptimizeVertexFetch(positions.data(), vertexCount, sizeof(DVector3), indices.data(), indices.size());
+  ReportCacheStats("vertex fetch", AnalyzeVertexCache(indices.data(), indices.size(), vertexCount));
+  const bool isFetchSucceeded = CollectTriangles(positions, indices) == expectedTriangles && referencedCount == vertexCount;
+
+  // After fetch remap, vertices are numbered in order of first use.
+  TU32 nextVertex = 0;
+  bool isFirstUseOrder = true;
+  for (const TU32 index : indices)
+  {
+    if (index > nextVertex) { isFirstUseOrder = false; break; }
+    if (index == nextVertex) { ++nextVertex; }
+  }
+
+  if (isCacheSucceeded == false)    { std::printf("OptimizeVertexCache does not keep triangles.\n"); }
+  if (isOverdrawSucceeded == false) { std::printf("OptimizeOverdraw does not keep triangles.\n"); }
+  if (isFetchSucceeded == false)    { std::printf("OptimizeVertexFetch does not keep triangles.\n"); }
+  if (isFirstUseOrder == false)     { std::printf("OptimizeVertexFetch does not number vertices in first use order.\n"); }
+
+  // Whole pass is measured, so divide by triangle count.
+  Report("MeshOptimize", "AnalyzeVertexCache (triangle)", MeasureNsPerCall(1, [&](TU32)
+  {
+    DoNotOptimize(AnalyzeVertexCache(sourceIndices.data(), sourceIndices.size(), vertexCount));
+  }) / triangleCount);
+  Report("MeshOptimize", "OptimizeVertexCache (triangle)", MeasureNsPerCall(1, [&](TU32)
+  {
+    OptimizeVertexCache(sourceIndices.data(), sourceIndices.size(), vertexCount, indices.data());
+  }) / triangleCount);
+  Report("MeshOptimize", "OptimizeOverdraw (triangle)", MeasureNsPerCall(1, [&](TU32)
+  {
+    OptimizeOverdraw(indices.data(), indices.size(), positions[0].Data(), sizeof(DVector3), vertexCount, indices.data());
+  }) / triangleCount);
+  Report("MeshOptimize", "OptimizeVertexFetch (triangle)", MeasureNsPerCall(1, [&](TU32)
+  {
+    OptimizeVertexFetch(positions.data(), vertexCount, sizeof(DVector3), indices.data(), indices.size());
+  }) / triangleCount);
+
+  DoNotOptimize(indices[0]);
+  DoNotOptimize(positions[0]);
+  return isCacheSucceeded && isOverdrawSucceeded && isFetchSucceeded && isFirstUseOrder;
+}
+
+} /// ::dy::bench namespace
@@ -0,0 +1,154 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "FBenchmark.h"
+#include "Type/DMeshRegistry.h"
+
+namespace
+{
+
+/// @brief Check ranges of live meshes are inside regions and do not overlap each other.
+bool IsNotOverlapped(const dy::DMeshRegistry& iRegistry, const std::vector<dy::DMeshHandle>& iHandles)
+{
+  std::vector<bool> isVertexUsed(iRegistry.GetVertexCapacity(), false);
+  std::vector<bool> isWordUsed(iRegistry.GetIndexWordCapacity(), false);
+  TU64 vertexCount = 0;
+  TU64 wordCount = 0;
+  for (const auto& handle : iHandles)
+  {
+    const auto* allocation = iRegistry.Get(handle);
+    if (allocation == nullptr) { return false; }
+    if (TU64(allocation->mFirstVertex) + allocation->mVertexCount > isVertexUsed.size()) { return false; }
+    if (TU64(allocation->mIndexWord) + allocation->mIndexWordCount > isWordUsed.size()) { return false; }
+    if (TU64(allocation->mIndexWordCount) * 4 < TU64(allocation->mIndexCount) * allocation->mIndexSize) { return false; }
+
+    for (TU32 i = 0; i < allocation->mVertexCount; ++i)
+    {
+      if (isVertexUsed[allocation->mFirstVertex + i] == true) { return false; }
+      isVertexUsed[allocation->mFirstVertex + i] = true;
+    }
+    for (TU32 i = 0; i < allocation->mIndexWordCount; ++i)
+    {
+      if (isWordUsed[allocation->mIndexWord + i] == true) { return false; }
+      isWordUsed[allocation->mIndexWord + i] = true;
+    }
+    vertexCount += allocation->mVertexCount;
+    wordCount += allocation->mIndexWordCount;
+  }
+  return vertexCount == iRegistry.GetUsedVertexCount() && wordCount == iRegistry.GetUsedIndexWordCount();
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunMeshRegistryBenchmark()
+{
+  bool isSucceeded = true;
+
+  // 16-bit mesh of odd index count takes half of its last word, and first index is counted in its index type.
+  {
+    DMeshRegistry registry(16, 16);
+    const auto mesh16 = registry.Add(4, 3, sizeof(TU16));
+    const auto mesh32 = registry.Add(4, 3, sizeof(TU32));
+    const auto* allocation16 = registry.Get(mesh16);
+    const auto* allocation32 = registry.Get(mesh32);
+    if (allocation16 == nullptr || allocation32 == nullptr
+    ||  allocation16->mIndexWordCount != 2 || allocation32->mIndexWord != 2 || allocation32->GetFirstIndex() != 2
+    ||  allocation32->mFirstVertex != 4)
+    {
+      std::printf("Mesh registry does not pack 16-bit and 32-bit indices into 4-byte words.\n");
+      isSucceeded = false;
+    }
+
+    // Removed handle is stale even when its slot is reused, and full registry refuses mesh.
+    registry.Remove(mesh16);
+    const auto reused = registry.Add(2, 2, sizeof(TU16));
+    if (registry.Get(mesh16) != nullptr || reused.mSlot != mesh16.mSlot || registry.Remove(mesh16) == true
+    ||  registry.Add(32, 0, sizeof(TU16)).IsValid() == true || registry.Add(0, 0, 3).IsValid() == true)
+    {
+      std::printf("Mesh registry accepts stale handle or mesh which does not fit.\n");
+      isSucceeded = false;
+    }
+  }
+
+  // Random churn of meshes of 1 to 4096 vertices, while about half of registry is used.
+  constexpr TU32 kVertexCapacity = 1 << 20;
+  constexpr TU32 kIndexWordCapacity = 1 << 21;
+  DMeshRegistry registry(kVertexCapacity, kIndexWordCapacity);
+  std::mt19937 random(20190301);
+  std::uniform_int_distribution<TU32> vertexDistribution(1, 4096);
+
+  std::vector<DMeshHandle> handles;
+  TU32 failedCount = 0;
+  const auto addRandomMesh = [&]
+  {
+    const TU32 vertexCount = vertexDistribution(random);
+    const TU32 indexSize = (random() & 1) == 0 ? sizeof(TU16) : sizeof(TU32);
+    const auto handle = registry.Add(vertexCount, vertexCount * 3, indexSize);
+    if (handle.IsValid() == true) { handles.push_back(handle); } else { ++failedCount; }
+  };
+  const auto removeRandomMesh = [&]
+  {
+    if (handles.empty() == true) { return; }
+    const std::size_t i = random() % handles.size();
+    registry.Remove(handles[i]);
+    handles[i] = handles.back();
+    handles.pop_back();
+  };
+
+  while (registry.GetUsedVertexCount() < kVertexCapacity / 2) { addRandomMesh(); }
+  for (TU32 round = 0; round < 8; ++round)
+  {
+    for (TU32 i = 0; i < 4096; ++i)
+    {
+      if ((random() & 1) == 0) { addRandomMesh(); } else { removeRandomMesh(); }
+    }
+    if (IsNotOverlapped(registry, handles) == false)
+    {
+      std::printf("Ranges of mesh registry overlap after %u rounds of churn.\n", round + 1);
+      isSucceeded = false;
+      break;
+    }
+  }
+
+  ReportValue("MeshRegistry", "Meshes after churn", TF64(registry.GetMeshCount()), "meshes");
+  ReportValue("MeshRegistry", "Failed adds during churn", TF64(failedCount), "meshes");
+  ReportValue("MeshRegistry", "Used vertices", 100.0 * registry.GetUsedVertexCount() / kVertexCapacity, "%");
+  ReportValue("MeshRegistry", "Largest free vertex range", 100.0 * registry.GetLargestFreeVertexCount() / kVertexCapacity, "%");
+  ReportValue("MeshRegistry", "Largest free index range", 100.0 * registry.GetLargestFreeIndexWordCount() / kIndexWordCapacity, "%");
+
+  // Add and remove one mesh in fragmented registry, which is cost of streaming mesh in and out per frame.
+  Report("MeshRegistry", "Add + Remove (fragmented)", MeasureNsPerCall(1 << 16, [&](TU32 i)
+  {
+    const auto handle = registry.Add(64 + (i & 1023), 192 + 3 * (i & 1023), sizeof(TU16));
+    DoNotOptimize(handle);
+    registry.Remove(handle);
+  }));
+
+  // Every range is coalesced back when all meshes are removed.
+  while (handles.empty() == false) { removeRandomMesh(); }
+  if (registry.GetMeshCount() != 0
+  ||  registry.GetLargestFreeVertexCount() != kVertexCapacity || registry.GetLargestFreeIndexWordCount() != kIndexWordCapacity)
+  {
+    std::printf("Free ranges of mesh registry are not coalesced after all meshes are removed.\n");
+    isSucceeded = false;
+  }
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
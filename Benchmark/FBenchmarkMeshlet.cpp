@@ -0,0 +1,234 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "FBenchmark.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include "Type/FHelperIndexBuffer.h"
+#include "Type/FHelperMeshOptimize.h"
+#include "Type/FHelperMeshlet.h"
+
+namespace
+{
+
+constexpr TU32 kSliceCount = 512;
+constexpr TU32 kStackCount = 256;
+constexpr TU32 kCameraCount = 64;
+
+/// @brief Create unit sphere of counter-clockwise triangles seen from outside, optimized in order of LoadModel.
+void CreateOptimizedSphere(std::vector<dy::DVector3>& outPositions, std::vector<TU32>& outIndices)
+{
+  constexpr float kPi = 3.14159265358979f;
+  for (TU32 stack = 0; stack <= kStackCount; ++stack)
+  {
+    const float theta = kPi * float(stack) / float(kStackCount);
+    for (TU32 slice = 0; slice <= kSliceCount; ++slice)
+    {
+      const float phi = 2.0f * kPi * float(slice) / float(kSliceCount);
+      outPositions.emplace_back(std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta));
+    }
+  }
+  const TU32 rowCount = kSliceCount + 1;
+  for (TU32 stack = 0; stack < kStackCount; ++stack)
+  {
+    for (TU32 slice = 0; slice < kSliceCount; ++slice)
+    {
+      const TU32 v0 = stack * rowCount + slice;
+      if (stack > 0)              { outIndices.insert(outIndices.end(), {v0, v0 + rowCount, v0 + 1}); }
+      if (stack + 1 < kStackCount){ outIndices.insert(outIndices.end(), {v0 + 1, v0 + rowCount, v0 + rowCount + 1}); }
+    }
+  }
+
+  const auto vertexCount = static_cast<TU32>(outPositions.size());
+  dy::OptimizeVertexCache(outIndices.data(), outIndices.size(), vertexCount, outIndices.data());
+  dy::OptimizeVertexFetch(outPositions.data(), vertexCount, sizeof(dy::DVector3), outIndices.data(), outIndices.size());
+}
+
+/// @brief Check meshlets cover all triangles in order within limits, and bounds contain their vertices.
+bool IsValidMeshlets(
+    const std::vector<dy::DMeshlet>& iMeshlets, const std::vector<dy::DMeshletBounds>& iBounds,
+    const std::vector<dy::DVector3>& iPositions, const std::vector<TU32>& iIndices)
+{
+  std::vector<TU32> lastMeshlets(iPositions.size(), 0xFFFFFFFF);
+  TU32 nextIndex = 0;
+  for (TU32 meshletId = 0; meshletId < iMeshlets.size(); ++meshletId)
+  {
+    const auto& meshlet = iMeshlets[meshletId];
+    const auto& sphere = iBounds[meshletId].mSphere;
+    if (meshlet.mFirstIndex != nextIndex
+    ||  meshlet.mTriangleCount == 0
+    ||  meshlet.mTriangleCount > dy::kDefaultMeshletMaxTriangleCount
+    ||  meshlet.mVertexCount > dy::kDefaultMeshletMaxVertexCount) { return false; }
+
+    TU32 vertexCount = 0;
+    for (TU32 i = meshlet.mFirstIndex; i < meshlet.mFirstIndex + meshlet.mTriangleCount * 3; ++i)
+    {
+      if ((iPositions[iIndices[i]] - sphere.mCenter).GetLength() > sphere.mRadius * 1.0001f) { return false; }
+      if (lastMeshlets[iIndices[i]] == meshletId) { continue; }
+      lastMeshlets[iIndices[i]] = meshletId;
+      ++vertexCount;
+    }
+    if (vertexCount != meshlet.mVertexCount) { return false; }
+    nextIndex += meshlet.mTriangleCount * 3;
+  }
+  return nextIndex == iIndices.size();
+}
+
+/// @brief Check no front-facing triangle is in meshlet which is culled as back-facing.
+bool IsConservativeCone(
+    const dy::DMeshlet& iMeshlet, const std::vector<dy::DVector3>& iPositions, const std::vector<TU32>& iIndices,
+    const dy::DVector3& iCameraPosition)
+{
+  for (TU32 i = iMeshlet.mFirstIndex; i < iMeshlet.mFirstIndex + iMeshlet.mTriangleCount * 3; i += 3)
+  {
+    const auto& p0 = iPositions[iIndices[i + 0]];
+    const auto normal = dy::DVector3::Cross(iPositions[iIndices[i + 1]] - p0, iPositions[iIndices[i + 2]] - p0);
+    if (dy::DVector3::Dot(p0 - iCameraPosition, normal) < -1e-6f * normal.GetLength()) { return false; }
+  }
+  return true;
+}
+
+/// @brief Check draws cover same indices to ranges, and each draw is in one submesh with its vertex offset.
+bool IsSameToRanges(
+    const std::vector<dy::DIndexSubmesh>& iRanges, const dy::DIndexBufferLayout& iLayout,
+    const std::vector<dy::DIndexSubmesh>& iDraws)
+{
+  std::vector<bool> isRanged(iLayout.mSubmeshes.back().mFirstIndex + iLayout.mSubmeshes.back().mIndexCount, false);
+  for (const auto& range : iRanges)
+  {
+    for (TU32 i = range.mFirstIndex; i < range.mFirstIndex + range.mIndexCount; ++i) { isRanged[i] = true; }
+  }
+  for (const auto& draw : iDraws)
+  {
+    bool isInSubmesh = false;
+    for (const auto& submesh : iLayout.mSubmeshes)
+    {
+      isInSubmesh |= draw.mFirstIndex >= submesh.mFirstIndex
+          && draw.mFirstIndex + draw.mIndexCount <= submesh.mFirstIndex + submesh.mIndexCount
+          && draw.mVertexOffset == submesh.mVertexOffset;
+    }
+    if (isInSubmesh == false) { return false; }
+    for (TU32 i = draw.mFirstIndex; i < draw.mFirstIndex + draw.mIndexCount; ++i)
+    {
+      if (isRanged[i] == false) { return false; }
+      isRanged[i] = false;
+    }
+  }
+  for (const bool isLeft : isRanged) { if (isLeft == true) { return false; } }
+  return true;
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunMeshletBenchmark()
+{
+  std::vector<DVector3> positions;
+  std::vector<TU32> indices;
+  CreateOptimizedSphere(positions, indices);
+  const auto vertexCount = static_cast<TU32>(positions.size());
+
+  const auto meshlets = BuildMeshlets(indices.data(), indices.size(), vertexCount);
+  std::vector<DMeshletBounds> bounds(meshlets.size());
+  ComputeMeshletBounds(meshlets.data(), meshlets.size(), indices.data(), positions[0].Data(), sizeof(DVector3), bounds.data());
+
+  bool isSucceeded = true;
+  if (IsValidMeshlets(meshlets, bounds, positions, indices) == false)
+  {
+    std::printf("Meshlets of sphere do not cover triangles within limits.\n");
+    isSucceeded = false;
+  }
+
+  // Same camera to MVulkanRenderer::UpdateUniformBuffer, and model is rotated around z axis.
+  auto projection = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 10.0f);
+  projection[1][1] *= -1;
+  const DVector3 cameraPosition{2.0f, 2.0f, 2.0f};
+  const auto view = glm::lookAt(static_cast<glm::vec3>(cameraPosition), glm::vec3(0.0f), glm::vec3(.0f, .0f, 1.f));
+  const DFrustum frustum{DMatrix4{projection * view}};
+
+  const auto layout = CreateIndexBufferLayout(indices.data(), indices.size(), vertexCount, sizeof(DVector3), 0);
+  std::vector<DIndexSubmesh> ranges, draws;
+  DMeshletCullStats stats;
+  CullMeshlets(meshlets.data(), bounds.data(), meshlets.size(), frustum, cameraPosition, ranges, &stats);
+  SplitRangesBySubmesh(ranges, layout, draws);
+  if (IsSameToRanges(ranges, layout, draws) == false)
+  {
+    std::printf("Draws of culled meshlets are not same to visible ranges.\n");
+    isSucceeded = false;
+  }
+
+  // Cone test must never cull front-facing triangle, from any camera outside of sphere.
+  std::mt19937 engine{0x5EED};
+  std::uniform_real_distribution<TF32> direction{-1.0f, 1.0f};
+  std::uniform_real_distribution<TF32> distance{1.05f, 8.0f};
+  const DFrustum everything{DMatrix4{glm::ortho(-16.0f, 16.0f, -16.0f, 16.0f, -16.0f, 16.0f)}};
+  TU32 backfaceCulledCount = 0;
+  for (TU32 camera = 0; camera < kCameraCount; ++camera)
+  {
+    DVector3 position{direction(engine), direction(engine), direction(engine) + 1e-3f};
+    position = position * (distance(engine) / position.GetLength());
+
+    DMeshletCullStats cameraStats;
+    std::vector<DIndexSubmesh> cameraRanges;
+    CullMeshlets(meshlets.data(), bounds.data(), meshlets.size(), everything, position, cameraRanges, &cameraStats);
+    backfaceCulledCount += cameraStats.mBackfaceCulledCount;
+
+    // Meshlets between visible ranges are culled.
+    std::size_t meshletId = 0;
+    for (std::size_t rangeId = 0; rangeId <= cameraRanges.size(); ++rangeId)
+    {
+      const TU32 rangeFirst = rangeId < cameraRanges.size() ? cameraRanges[rangeId].mFirstIndex : TU32(indices.size());
+      for (; meshletId < meshlets.size() && meshlets[meshletId].mFirstIndex < rangeFirst; ++meshletId)
+      {
+        if (IsConservativeCone(meshlets[meshletId], positions, indices, position) == false) { isSucceeded = false; }
+      }
+      if (rangeId == cameraRanges.size()) { break; }
+
+      const TU32 rangeEnd = rangeFirst + cameraRanges[rangeId].mIndexCount;
+      while (meshletId < meshlets.size() && meshlets[meshletId].mFirstIndex < rangeEnd) { ++meshletId; }
+    }
+  }
+  if (isSucceeded == false) { std::printf("Meshlet culling is not conservative.\n"); }
+
+  const auto meshletCount = TF64(meshlets.size());
+  ReportValue("Meshlet", "Triangles", TF64(indices.size() / 3), "triangles");
+  ReportValue("Meshlet", "Meshlets", meshletCount, "meshlets");
+  ReportValue("Meshlet", "Average triangles", TF64(indices.size() / 3) / meshletCount, "triangles");
+  ReportValue("Meshlet", "Frustum culled (renderer camera)", 100.0 * stats.mFrustumCulledCount / meshletCount, "%");
+  ReportValue("Meshlet", "Backface culled (renderer camera)", 100.0 * stats.mBackfaceCulledCount / meshletCount, "%");
+  ReportValue("Meshlet", "Visible ranges (renderer camera)", TF64(stats.mRangeCount), "ranges");
+  ReportValue("Meshlet", "Draws (renderer camera)", TF64(draws.size()), "draws");
+  ReportValue("Meshlet", "Backface culled (random cameras)", 100.0 * backfaceCulledCount / (meshletCount * kCameraCount), "%");
+
+  Report("Meshlet", "BuildMeshlets (triangle)", MeasureNsPerCall(1, [&](TU32)
+  {
+    DoNotOptimize(BuildMeshlets(indices.data(), indices.size(), vertexCount));
+  }) / TF64(indices.size() / 3));
+  Report("Meshlet", "ComputeMeshletBounds (meshlet)", MeasureNsPerCall(1, [&](TU32)
+  {
+    ComputeMeshletBounds(meshlets.data(), meshlets.size(), indices.data(), positions[0].Data(), sizeof(DVector3), bounds.data());
+  }) / meshletCount);
+  Report("Meshlet", "CullMeshlets (meshlet)", MeasureNsPerCall(16, [&](TU32)
+  {
+    CullMeshlets(meshlets.data(), bounds.data(), meshlets.size(), frustum, cameraPosition, ranges, &stats);
+  }) / meshletCount);
+  DoNotOptimize(bounds[0]);
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
@@ -0,0 +1,203 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "FBenchmark.h"
+#include "Type/FHelperMipmap.h"
+
+namespace
+{
+
+/// Odd sizes to exercise texels which cover 3 source texels, and remainder of AVX2 pixel pairs.
+constexpr TU32 kOddWidth  = 509;
+constexpr TU32 kOddHeight = 251;
+constexpr TU32 kBenchmarkSize = 1024;
+
+double SrgbToLinear(double iValue)
+{
+  return iValue <= 0.04045 ? iValue / 12.92 : std::pow((iValue + 0.055) / 1.055, 2.4);
+}
+
+double LinearToSrgb(double iValue)
+{
+  return iValue <= 0.0031308 ? iValue * 12.92 : 1.055 * std::pow(iValue, 1.0 / 2.4) - 0.055;
+}
+
+/// @brief Create RGBA8 chain buffer whose level 0 is random texels.
+std::vector<TU08> CreateRandomChain(TU32 iWidth, TU32 iHeight, TU32 iSeed)
+{
+  std::mt19937 engine{iSeed};
+  std::vector<TU08> pixels(dy::GetMipChainSize(iWidth, iHeight, dy::GetMipLevelCount(iWidth, iHeight)));
+  for (std::size_t i = 0; i < std::size_t(iWidth) * iHeight * 4; ++i) { pixels[i] = static_cast<TU08>(engine()); }
+  return pixels;
+}
+
+/// @brief Check each level of `iPixels` is area weighted average of its previous level in linear space,
+/// within 1 of byte. Previous level is taken from `iPixels`, so error of each level is checked alone.
+bool IsSrgbBoxChain(const std::vector<TU08>& iPixels, TU32 iWidth, TU32 iHeight)
+{
+  const TU32 levelCount = dy::GetMipLevelCount(iWidth, iHeight);
+  for (TU32 level = 1; level < levelCount; ++level)
+  {
+    const TU08* source = iPixels.data() + dy::GetMipLevelOffset(iWidth, iHeight, level - 1);
+    const TU08* destination = iPixels.data() + dy::GetMipLevelOffset(iWidth, iHeight, level);
+    const TU32 sourceWidth = std::max(iWidth >> (level - 1), 1u), sourceHeight = std::max(iHeight >> (level - 1), 1u);
+    const TU32 width = std::max(iWidth >> level, 1u), height = std::max(iHeight >> level, 1u);
+    const double ratioX = double(sourceWidth) / width, ratioY = double(sourceHeight) / height;
+
+    for (TU32 y = 0; y < height; ++y)
+    {
+      for (TU32 x = 0; x < width; ++x)
+      {
+        double sum[4] = {};
+        for (TU32 sy = TU32(y * ratioY); sy < std::min(TU32(std::ceil((y + 1) * ratioY)), sourceHeight); ++sy)
+        {
+          const double coverY = std::min(sy + 1.0, (y + 1) * ratioY) - std::max(double(sy), y * ratioY);
+          for (TU32 sx = TU32(x * ratioX); sx < std::min(TU32(std::ceil((x + 1) * ratioX)), sourceWidth); ++sx)
+          {
+            const double cover = coverY * (std::min(sx + 1.0, (x + 1) * ratioX) - std::max(double(sx), x * ratioX));
+            const TU08* texel = source + (std::size_t(sy) * sourceWidth + sx) * 4;
+            for (TU32 c = 0; c < 3; ++c) { sum[c] += cover * SrgbToLinear(texel[c] / 255.0); }
+            sum[3] += cover * (texel[3] / 255.0);
+          }
+        }
+
+        const TU08* texel = destination + (std::size_t(y) * width + x) * 4;
+        for (TU32 c = 0; c < 4; ++c)
+        {
+          const double average = sum[c] / (ratioX * ratioY);
+          const double expected = 255.0 * (c < 3 ? LinearToSrgb(average) : average);
+          if (std::abs(expected - texel[c]) > 1.0) { return false; }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunMipmapBenchmark()
+{
+  bool isSucceeded = true;
+  const auto supportedLevel = GetSupportedSimdLevel();
+
+  // Invalid chains are refused.
+  {
+    std::vector<TU08> pixels(GetMipChainSize(4, 4, 3));
+    if (GenerateMipChain(pixels.data(), 4, 4, 4) == true || GenerateMipChain(pixels.data(), 0, 4, 1) == true
+    ||  GetMipLevelCount(4096, 1) != 13 || GetMipLevelOffset(4, 2, 2) != (4 * 2 + 2 * 1) * 4)
+    {
+      std::printf("Mipmap accepts invalid chain or computes wrong chain layout.\n");
+      isSucceeded = false;
+    }
+  }
+
+  for (auto level : {ESimdLevel::Sse2, ESimdLevel::Avx2})
+  {
+    if (level > supportedLevel) { break; }
+    SetMipmapSimdLevel(level);
+    const char* name = ToString(GetMipmapSimdLevel());
+
+    // Black and white texels average to 188 in sRGB, not 128 of gamma space average.
+    std::vector<TU08> checker(GetMipChainSize(2, 2, 2), 255);
+    for (TU32 c = 0; c < 3; ++c) { checker[c] = 0; checker[12 + c] = 0; }
+    if (GenerateMipChain(checker.data(), 2, 2, 2) == false
+    ||  std::abs(int(checker[16]) - 188) > 1 || checker[19] != 255)
+    {
+      std::printf("%s mipmap does not average sRGB texels in linear space.\n", name);
+      isSucceeded = false;
+    }
+
+    // Box filter of odd size image is same to area weighted reference.
+    auto pixels = CreateRandomChain(kOddWidth, kOddHeight, 20190302);
+    if (GenerateMipChain(pixels.data(), kOddWidth, kOddHeight, GetMipLevelCount(kOddWidth, kOddHeight)) == false
+    ||  IsSrgbBoxChain(pixels, kOddWidth, kOddHeight) == false)
+    {
+      std::printf("%s box mipmap is not same to area weighted sRGB reference.\n", name);
+      isSucceeded = false;
+    }
+
+    // Kaiser weights are normalized, so constant image stays constant at every level.
+    std::vector<TU08> constant(GetMipChainSize(kOddWidth, kOddHeight, GetMipLevelCount(kOddWidth, kOddHeight)));
+    for (std::size_t i = 0; i < std::size_t(kOddWidth) * kOddHeight * 4; i += 4)
+    {
+      constant[i] = 77; constant[i + 1] = 150; constant[i + 2] = 200; constant[i + 3] = 90;
+    }
+    DMipmapOptions kaiser;
+    kaiser.mFilter = EMipmapFilter::Kaiser;
+    bool isConstant = GenerateMipChain(constant.data(), kOddWidth, kOddHeight, GetMipLevelCount(kOddWidth, kOddHeight), kaiser);
+    for (std::size_t i = 0; i < constant.size(); ++i)
+    {
+      const int expected = (i & 3) == 0 ? 77 : (i & 3) == 1 ? 150 : (i & 3) == 2 ? 200 : 90;
+      if (std::abs(int(constant[i]) - expected) > 1) { isConstant = false; }
+    }
+    if (isConstant == false)
+    {
+      std::printf("%s Kaiser mipmap does not keep constant image.\n", name);
+      isSucceeded = false;
+    }
+
+    // Whole chain of one image, single thread. Divide ns by 1e6 to get ms.
+    for (auto filter : {EMipmapFilter::Box, EMipmapFilter::Kaiser})
+    {
+      auto chain = CreateRandomChain(kBenchmarkSize, kBenchmarkSize, 7);
+      DMipmapOptions options;
+      options.mFilter = filter;
+      options.mThreadCount = 1;
+      char label[64];
+      std::snprintf(label, sizeof(label), "%s 1024^2 chain (%s)", filter == EMipmapFilter::Box ? "Box" : "Kaiser", name);
+      ReportValue("Mipmap", label, MeasureNsPerCall(2, [&](TU32)
+      {
+        DoNotOptimize(GenerateMipChain(chain.data(), kBenchmarkSize, kBenchmarkSize, GetMipLevelCount(kBenchmarkSize, kBenchmarkSize), options));
+      }) / 1e6, "ms");
+    }
+  }
+  SetMipmapSimdLevel(supportedLevel);
+
+  // Rows of large levels are split to threads, and result is same to single thread.
+  {
+    auto single = CreateRandomChain(kBenchmarkSize, kBenchmarkSize, 11);
+    auto parallel = single;
+    DMipmapOptions options;
+    options.mFilter = EMipmapFilter::Kaiser;
+    options.mThreadCount = 1;
+    const TU32 levelCount = GetMipLevelCount(kBenchmarkSize, kBenchmarkSize);
+    const bool isSingleGenerated = GenerateMipChain(single.data(), kBenchmarkSize, kBenchmarkSize, levelCount, options);
+    options.mThreadCount = 4;
+    const bool isParallelGenerated = GenerateMipChain(parallel.data(), kBenchmarkSize, kBenchmarkSize, levelCount, options);
+    if (isSingleGenerated == false || isParallelGenerated == false || single != parallel)
+    {
+      std::printf("Mipmap of 4 threads is not same to single thread.\n");
+      isSucceeded = false;
+    }
+
+    options.mThreadCount = 0;
+    ReportValue("Mipmap", "Kaiser 1024^2 chain (threads)", MeasureNsPerCall(2, [&](TU32)
+    {
+      DoNotOptimize(GenerateMipChain(parallel.data(), kBenchmarkSize, kBenchmarkSize, levelCount, options));
+    }) / 1e6, "ms");
+  }
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
@@ -0,0 +1,274 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#define TINYOBJLOADER_IMPLEMENTATION
+#include <tiny_obj_loader.h>
+#include "FBenchmark.h"
+#include "Type/FHelperObjStream.h"
+#include "Type/FHelperVertexDedup.h"
+
+namespace
+{
+
+constexpr TU32 kSliceCount = 256;
+constexpr TU32 kStackCount = 256;
+/// Sphere of about 300 MB to measure scaling of parallel reader.
+constexpr TU32 kLargeSliceCount = 1536;
+constexpr TU32 kLargeStackCount = 1024;
+
+/// @class FVectorSink
+/// @brief Sink which appends vertices and indices to vectors.
+class FVectorSink final : public dy::IObjStreamSink
+{
+public:
+  bool WriteVertices(const dy::DObjVertex* iVertices, std::size_t iCount) override
+  {
+    this->mVertices.insert(this->mVertices.end(), iVertices, iVertices + iCount);
+    return true;
+  }
+
+  bool WriteIndices(const TU32* iIndices, std::size_t iCount) override
+  {
+    // Indices must only reference vertices written before.
+    for (std::size_t i = 0; i < iCount; ++i) { this->mIsOrdered &= iIndices[i] < this->mVertices.size(); }
+    this->mIndices.insert(this->mIndices.end(), iIndices, iIndices + iCount);
+    return true;
+  }
+
+  std::vector<dy::DObjVertex> mVertices;
+  std::vector<TU32> mIndices;
+  bool mIsOrdered = true;
+};
+
+/// @brief Write textured sphere of triangles with normals, groups and comments like exported model.
+void WriteSphereObj(const std::string& iPath, TU32 iSliceCount, TU32 iStackCount)
+{
+  constexpr float kPi = 3.14159265358979f;
+  std::ofstream file{iPath, std::ios::binary};
+  file << "# Benchmark sphere\nmtllib sphere.mtl\no Sphere\n";
+  char line[256];
+  for (TU32 stack = 0; stack <= iStackCount; ++stack)
+  {
+    for (TU32 slice = 0; slice <= iSliceCount; ++slice)
+    {
+      const float theta = kPi * float(stack) / float(iStackCount);
+      const float phi = 2.0f * kPi * float(slice) / float(iSliceCount);
+      std::snprintf(line, sizeof(line), "v %.6f %.6f %.6f\nvt %.6f %.6f\nvn %.4f %.4f %.4f\n",
+          std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta),
+          float(slice) / float(iSliceCount), float(stack) / float(iStackCount),
+          std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta));
+      file << line;
+    }
+  }
+  file << "g Sphere\nusemtl Default\ns 1\n";
+  const TU32 rowCount = iSliceCount + 1;
+  for (TU32 stack = 0; stack < iStackCount; ++stack)
+  {
+    for (TU32 slice = 0; slice < iSliceCount; ++slice)
+    {
+      const TU32 v0 = stack * rowCount + slice + 1;
+      const TU32 v1 = v0 + rowCount;
+      std::snprintf(line, sizeof(line), "f %u/%u/%u %u/%u/%u %u/%u/%u\nf %u/%u/%u %u/%u/%u %u/%u/%u\n",
+          v0, v0, v0, v1, v1, v1, v0 + 1, v0 + 1, v0 + 1,
+          v0 + 1, v0 + 1, v0 + 1, v1, v1, v1, v1 + 1, v1 + 1, v1 + 1);
+      file << line;
+    }
+  }
+}
+
+/// @brief Load OBJ in order of previous LoadModel, which is tinyobj, corner expansion and deduplication.
+/// Return peak byte size of buffers.
+std::size_t LoadWithTinyObj(
+    const std::string& iPath, std::vector<dy::DObjVertex>& outCorners,
+    std::vector<dy::DObjVertex>& outVertices, std::vector<TU32>& outIndices)
+{
+  tinyobj::attrib_t attrib;
+  std::vector<tinyobj::shape_t> shapes;
+  std::vector<tinyobj::material_t> materials;
+  std::string warn, err;
+  if (tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, iPath.c_str()) == false) { return 0; }
+
+  outCorners.clear();
+  for (const auto& shape : shapes)
+  {
+    for (const auto& index : shape.mesh.indices)
+    {
+      outCorners.push_back(dy::DObjVertex{
+          dy::DVector3{
+              attrib.vertices[3 * index.vertex_index + 0],
+              attrib.vertices[3 * index.vertex_index + 1],
+              attrib.vertices[3 * index.vertex_index + 2]},
+          dy::DVector2{attrib.texcoords[2 * index.texcoord_index + 0], attrib.texcoords[2 * index.texcoord_index + 1]}});
+    }
+  }
+  dy::DeduplicateVertices(outCorners.data(), outCorners.size(), outVertices, outIndices);
+
+  std::size_t size = (attrib.vertices.capacity() + attrib.normals.capacity() + attrib.texcoords.capacity()) * sizeof(float)
+      + outCorners.capacity() * sizeof(dy::DObjVertex)
+      + outVertices.capacity() * sizeof(dy::DObjVertex) + outIndices.capacity() * sizeof(TU32);
+  for (const auto& shape : shapes) { size += shape.mesh.indices.capacity() * sizeof(tinyobj::index_t); }
+  return size;
+}
+
+/// @brief Check sink of `iThreadCount` threads has same result to `iSink`.
+bool IsSameToParallel(const std::string& iPath, const FVectorSink& iSink, TU32 iThreadCount)
+{
+  dy::DObjStreamOptions options;
+  // Small chunk makes many ranges, which have relative indices to previous ranges.
+  options.mChunkSize = 4096;
+  FVectorSink sink;
+  return dy::ReadObjStreamParallel(iPath, iThreadCount, sink, options) == true
+      && sink.mIsOrdered == true && sink.mIndices == iSink.mIndices && sink.mVertices.size() == iSink.mVertices.size()
+      && std::memcmp(sink.mVertices.data(), iSink.mVertices.data(), sizeof(dy::DObjVertex) * sink.mVertices.size()) == 0;
+}
+
+/// @brief Check floats of fast path, long mantissa, exponent and special forms are same to std::strtof.
+bool CheckObjFloats(const std::string& iPath)
+{
+  const std::vector<std::string> numbers = {
+      "0.123456", "-0.707107", "-0", "16777217", "0.1234567890123456789", "1e-3", "-2.5E+2", "3.4e38", "1e-45",
+      "123456789012345678901234567890", ".5", "5.", "+7.25", "0.000000000000000000000000000000000000001", "inf"};
+  std::ofstream file{iPath, std::ios::binary};
+  for (const auto& number : numbers) { file << "v " << number << ' ' << number << ' ' << number << '\n'; }
+  file << "f";
+  for (std::size_t i = 0; i < numbers.size(); ++i) { file << ' ' << i + 1; }
+  file.close();
+
+  FVectorSink sink;
+  if (dy::ReadObjStream(iPath, sink) == false || sink.mVertices.size() != numbers.size()) { return false; }
+  for (std::size_t i = 0; i < numbers.size(); ++i)
+  {
+    const float expected = std::strtof(numbers[i].c_str(), nullptr);
+    if (std::memcmp(&sink.mVertices[i].mPosition.X, &expected, sizeof(float)) != 0) { return false; }
+  }
+  return true;
+}
+
+/// @brief Check polygon, negative index, missing texture coordinate and malformed face of small OBJ.
+bool CheckObjSyntax(const std::string& iPath)
+{
+  std::ofstream{iPath, std::ios::binary}
+      << "v 0 0 0\r\nv 1 0 0\nv 1 1 0\nv 0 1 0\nvt 0.5 0.5\n"
+      << "  f 1 2 3 4\nf -4/1 -2/1 -1/1\nf 1//1 2//1 3//1\nvn 0 0 1\n# f 9 9 9\n";
+  FVectorSink sink;
+  dy::DObjStreamStats stats;
+  if (dy::ReadObjStream(iPath, sink, {}, &stats) == false) { return false; }
+
+  const std::vector<TU32> expectedIndices = {0, 1, 2, 0, 2, 3, 4, 5, 6, 0, 1, 2};
+  const bool isValid = sink.mIndices == expectedIndices
+      && sink.mVertices.size() == 7 && sink.mVertices[4].mTextureUv0 == dy::DVector2{0.5f, 0.5f}
+      && stats.mCornerCount == 10 && stats.mBounds.mMax == dy::DVector3{1.0f, 1.0f, 0.0f};
+
+  // Parallel reader must resolve negative indices of each range with counts of previous ranges.
+  const bool isSameToParallel = IsSameToParallel(iPath, sink, 3);
+
+  // Parallel reader must report same error of first invalid face.
+  std::ofstream{iPath, std::ios::binary} << "v 0 0 0\nv 1 0 0\nf 1 2 3\n";
+  FVectorSink invalidSink, invalidParallelSink;
+  std::string error, parallelError;
+  return isValid == true && isSameToParallel == true
+      && dy::ReadObjStream(iPath, invalidSink, {}, nullptr, &error) == false && error.empty() == false
+      && dy::ReadObjStreamParallel(iPath, 3, invalidParallelSink, {}, nullptr, &parallelError) == false
+      && parallelError == error;
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunObjStreamBenchmark()
+{
+  const auto path = (std::filesystem::temp_directory_path() / "DyBenchmarkObjStream.obj").string();
+  bool isSucceeded = CheckObjSyntax(path) && CheckObjFloats(path);
+
+  WriteSphereObj(path, kSliceCount, kStackCount);
+  const auto fileSize = std::filesystem::file_size(path);
+
+  FVectorSink sink;
+  DObjStreamStats stats;
+  std::string error;
+  if (ReadObjStream(path, sink, {}, &stats, &error) == false)
+  {
+    std::printf("%s\n", error.c_str());
+    isSucceeded = false;
+  }
+
+  // Stream must produce same corners to tinyobj, and same vertex count to value deduplication.
+  std::vector<DObjVertex> corners, vertices;
+  std::vector<TU32> indices;
+  const std::size_t tinyObjSize = LoadWithTinyObj(path, corners, vertices, indices);
+  bool isSameCorners = sink.mIsOrdered == true && corners.size() == sink.mIndices.size()
+      && vertices.size() == sink.mVertices.size();
+  for (std::size_t i = 0; i < corners.size() && isSameCorners == true; ++i)
+  {
+    isSameCorners = std::memcmp(&corners[i], &sink.mVertices[sink.mIndices[i]], sizeof(DObjVertex)) == 0;
+  }
+  isSucceeded &= isSameCorners && IsSameToParallel(path, sink, 4);
+
+  // Reading must fail when it needs more memory than ceiling.
+  DObjStreamOptions boundedOptions;
+  boundedOptions.mMaxMemorySize = stats.mPeakMemorySize / 2;
+  FVectorSink boundedSink;
+  isSucceeded &= ReadObjStream(path, boundedSink, boundedOptions) == false;
+
+  ReportValue("ObjStream", "File size", TF64(fileSize) / 1024.0, "KiB");
+  ReportValue("ObjStream", "Vertices", TF64(stats.mVertexCount), "vertices");
+  ReportValue("ObjStream", "Peak memory (stream)", TF64(stats.mPeakMemorySize) / 1024.0, "KiB");
+  ReportValue("ObjStream", "Peak memory (tinyobj)", TF64(tinyObjSize) / 1024.0, "KiB");
+
+  const auto triangleCount = TF64(stats.mIndexCount / 3);
+  Report("ObjStream", "ReadObjStream (triangle)", MeasureNsPerCall(1, [&](TU32)
+  {
+    FVectorSink timedSink;
+    DoNotOptimize(ReadObjStream(path, timedSink));
+  }) / triangleCount);
+  Report("ObjStream", "tinyobj + dedup (triangle)", MeasureNsPerCall(1, [&](TU32)
+  {
+    DoNotOptimize(LoadWithTinyObj(path, corners, vertices, indices));
+  }) / triangleCount);
+
+
+  // Parallel reader parses ranges and deduplicates hash shards of corners on threads.
+  // Reading file and writing sink stay on calling thread. Threads over hardware threads only add switching.
+  WriteSphereObj(path, kLargeSliceCount, kLargeStackCount);
+  const auto largeFileSize = TF64(std::filesystem::file_size(path));
+  ReportValue("ObjStream", "Large file size", largeFileSize / (1024.0 * 1024.0), "MiB");
+  const TU32 hardwareThreadCount = std::max(1u, std::thread::hardware_concurrency());
+  for (TU32 threadCount = 1; ; threadCount = std::min(threadCount * 2, std::max(hardwareThreadCount, 4u)))
+  {
+    const TF64 ns = MeasureNsPerCall(1, [&](TU32)
+    {
+      FVectorSink timedSink;
+      DoNotOptimize(ReadObjStreamParallel(path, threadCount, timedSink));
+    });
+    const std::string name = "ReadObjStreamParallel (" + std::to_string(threadCount) + " threads)";
+    ReportValue("ObjStream", name.c_str(), largeFileSize / (1024.0 * 1024.0) / (ns * 1e-9), "MiB/s");
+    if (threadCount >= std::max(hardwareThreadCount, 4u)) { break; }
+  }
+  ReportValue("ObjStream", "Hardware threads", TF64(hardwareThreadCount), "threads");
+
+  std::filesystem::remove(path);
+  if (isSucceeded == false) { std::printf("Streaming OBJ reader does not match tinyobj or ignores memory ceiling.\n"); }
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
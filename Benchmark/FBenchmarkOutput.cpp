@@ -0,0 +1,114 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <fstream>
+#include "FBenchmark.h"
+#include "Type/ASimdInclude.h"
+#include "Type/FHelperCpuFeature.h"
+
+namespace
+{
+
+/// @brief Get instruction set math headers are compiled with.
+constexpr const char* GetCompiledSimd() noexcept
+{
+#if defined(MDY_SIMD_AVX) && defined(MDY_SIMD_FMA)
+  return "AVX+FMA";
+#elif defined(MDY_SIMD_AVX)
+  return "AVX";
+#else
+  return "SSE2";
+#endif
+}
+
+/// @brief Get compiler name and version.
+std::string GetCompiler()
+{
+#if defined(__clang__)
+  return "Clang " __clang_version__;
+#elif defined(__GNUC__)
+  return "GCC " __VERSION__;
+#elif defined(_MSC_VER)
+  return "MSVC " + std::to_string(_MSC_VER);
+#else
+  return "Unknown";
+#endif
+}
+
+/// @brief Escape `"` and `\` of JSON string.
+std::string EscapeJson(const std::string& iString)
+{
+  std::string result;
+  for (const char character : iString)
+  {
+    if (character == '"' || character == '\\') { result += '\\'; }
+    result += character;
+  }
+  return result;
+}
+
+/// @brief Quote CSV field, because names may have comma like "Cross (SSE2, per vector)".
+std::string QuoteCsv(const std::string& iString)
+{
+  std::string result = "\"";
+  for (const char character : iString)
+  {
+    if (character == '"') { result += '"'; }
+    result += character;
+  }
+  return result + "\"";
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool WriteResultsJson(const char* iPath)
+{
+  std::ofstream file{iPath};
+  if (file.is_open() == false) { return false; }
+
+  file << "{\n";
+  file << "  \"compiler\": \"" << EscapeJson(GetCompiler()) << "\",\n";
+  file << "  \"compiledSimd\": \"" << GetCompiledSimd() << "\",\n";
+  file << "  \"supportedSimd\": \"" << ToString(GetSupportedSimdLevel()) << "\",\n";
+  file << "  \"results\": [";
+  for (std::size_t i = 0; i < gBenchmarkResults.size(); ++i)
+  {
+    const auto& result = gBenchmarkResults[i];
+    file << (i == 0 ? "\n" : ",\n")
+         << "    {\"group\": \"" << EscapeJson(result.mGroup)
+         << "\", \"name\": \"" << EscapeJson(result.mName)
+         << "\", \"value\": " << result.mValue
+         << ", \"unit\": \"" << result.mUnit << "\"}";
+  }
+  file << "\n  ]\n}\n";
+  return file.good();
+}
+
+bool WriteResultsCsv(const char* iPath)
+{
+  std::ofstream file{iPath};
+  if (file.is_open() == false) { return false; }
+
+  file << "group,name,value,unit\n";
+  for (const auto& result : gBenchmarkResults)
+  {
+    file << QuoteCsv(result.mGroup) << ',' << QuoteCsv(result.mName) << ','
+         << result.mValue << ',' << result.mUnit << '\n';
+  }
+  return file.good();
+}
+
+} /// ::dy::bench namespace
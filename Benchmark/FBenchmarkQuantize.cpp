@@ -0,0 +1,193 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "FBenchmark.h"
+#include "Type/DQuaternion.h"
+#include "Type/FHelperQuantize.h"
+#include "Type/FHelperQuantizeVertex.h"
+
+namespace
+{
+
+constexpr TU32 kVertexCount = 1 << 16;
+
+/// @struct DVertex
+/// @brief Same layout to DDefaultVertex, which can not be used here because it depends on Vulkan.
+struct DVertex final
+{
+  dy::DVector3 mPosition;
+  dy::DVector3 mBaseColor;
+  dy::DVector2 mTextureUv0;
+};
+
+dy::DCompactVertexDequantization Quantize(const std::vector<DVertex>& iVertices, std::vector<dy::DCompactVertex>& outVertices)
+{
+  outVertices.resize(iVertices.size());
+  return dy::QuantizeVertices(
+      iVertices[0].mPosition.Data(), iVertices[0].mBaseColor.Data(), iVertices[0].mTextureUv0.Data(),
+      sizeof(DVertex), static_cast<TU32>(iVertices.size()), outVertices.data());
+}
+
+/// @brief Same to `vec4(inPosition, 1.0) * uModel` of shader.vert. \n
+/// Rows of DMatrix3x4 are uploaded as columns of `mat3x4`, so each component is dot of row and (p, 1).
+/// Input assembly converts UNORM position to float by DequantizeUnorm16, and W of attribute is not read.
+dy::DVector3 ApplyShaderModel(const dy::DMatrix3x4& iModel, const dy::DCompactVertex& iVertex)
+{
+  const float p[4] = {
+      dy::DequantizeUnorm16(iVertex.mPosition[0]),
+      dy::DequantizeUnorm16(iVertex.mPosition[1]),
+      dy::DequantizeUnorm16(iVertex.mPosition[2]),
+      1.0f};
+  float result[3];
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    const auto& row = iModel.GetRow(i);
+    result[i] = p[0] * row.X + p[1] * row.Y + p[2] * row.Z + p[3] * row.W;
+  }
+  return dy::DVector3{result[0], result[1], result[2]};
+}
+
+/// @brief Same to `inTextureUv0 * uTextureUvTransform.xy + uTextureUvTransform.zw` of shader.vert.
+dy::DVector2 ApplyShaderUvTransform(const dy::DVector4& iTransform, const dy::DCompactVertex& iVertex)
+{
+  return dy::DVector2{
+      dy::DequantizeUnorm16(iVertex.mTextureUv0[0]) * iTransform.X + iTransform.Z,
+      dy::DequantizeUnorm16(iVertex.mTextureUv0[1]) * iTransform.Y + iTransform.W};
+}
+
+/// @brief Check positions and texture coordinates restored by shader are within one UNORM step of extent,
+/// and colors within half step. Zero extent must be given as zero, and its axis must be restored exactly.
+bool IsRestored(
+    const std::vector<DVertex>& iVertices, const std::vector<dy::DCompactVertex>& iCompacts,
+    const dy::DCompactVertexDequantization& iDequantization, const dy::DVector3& iPositionExtent, const dy::DVector2& iUvExtent)
+{
+  const auto positionMatrix = iDequantization.GetPositionMatrix();
+  const auto uvTransform = iDequantization.GetUvTransform();
+  for (std::size_t i = 0; i < iVertices.size(); ++i)
+  {
+    const auto& source = iVertices[i];
+    const auto position = ApplyShaderModel(positionMatrix, iCompacts[i]);
+    const auto uv = ApplyShaderUvTransform(uvTransform, iCompacts[i]);
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+      if (std::abs(position[axis] - source.mPosition[axis]) > iPositionExtent[axis] / 65535.0f) { return false; }
+      const float color = iCompacts[i].mBaseColor[axis] / 255.0f;
+      if (std::abs(color - source.mBaseColor[axis]) > 0.5f / 255.0f + 1e-6f) { return false; }
+    }
+    for (std::size_t axis = 0; axis < 2; ++axis)
+    {
+      if (std::abs(uv[axis] - source.mTextureUv0[axis]) > iUvExtent[axis] / 65535.0f) { return false; }
+    }
+    if (iCompacts[i].mBaseColor[3] != 0xFF) { return false; }
+  }
+  return true;
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunQuantizeBenchmark()
+{
+  bool isSucceeded = true;
+
+  // Mesh of which bounds do not start at zero, and are not same per axis.
+  std::mt19937 engine{0x5EED};
+  std::uniform_real_distribution<TF32> unit{0.0f, 1.0f};
+  const DVector3 minPosition{-3.0f, 0.5f, 120.0f}, positionExtent{8.0f, 2.0f, 40.0f};
+  const DVector2 minUv{-1.0f, 0.25f}, uvExtent{3.0f, 0.5f};
+  std::vector<DVertex> vertices(kVertexCount);
+  for (auto& vertex : vertices)
+  {
+    vertex.mPosition = DVector3{
+        minPosition.X + positionExtent.X * unit(engine),
+        minPosition.Y + positionExtent.Y * unit(engine),
+        minPosition.Z + positionExtent.Z * unit(engine)};
+    vertex.mBaseColor = DVector3{unit(engine), unit(engine), unit(engine)};
+    vertex.mTextureUv0 = DVector2{minUv.X + uvExtent.X * unit(engine), minUv.Y + uvExtent.Y * unit(engine)};
+  }
+
+  std::vector<DCompactVertex> compacts;
+  const auto dequantization = Quantize(vertices, compacts);
+  if (IsRestored(vertices, compacts, dequantization, positionExtent, uvExtent) == false)
+  {
+    std::printf("Dequantized vertices are not within one UNORM step of mesh extent.\n");
+    isSucceeded = false;
+  }
+
+  // Renderer uploads model matrix multiplied by position matrix on the right,
+  // which must place vertices same to model matrix applied to source positions.
+  const float halfAngle = 0.3f;
+  const auto model = DMatrix3x4::CreateWithTransform(
+      DVector3{1.0f, -2.0f, 0.5f}, DQuaternion{0.0f, 0.0f, std::sin(halfAngle), std::cos(halfAngle)}, DVector3{2.0f});
+  const auto uploadedModel = model.Multiply(dequantization.GetPositionMatrix());
+  for (std::size_t i = 0; i < vertices.size() && isSucceeded == true; ++i)
+  {
+    const auto expected = model.MultiplyPoint(vertices[i].mPosition);
+    const auto position = ApplyShaderModel(uploadedModel, compacts[i]);
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+      // Error of each axis is scaled by model matrix, and translation adds rounding of its magnitude.
+      const auto& row = model.GetRow(axis);
+      const float tolerance =
+          (std::abs(row.X) * positionExtent.X + std::abs(row.Y) * positionExtent.Y + std::abs(row.Z) * positionExtent.Z)
+          / 65535.0f + std::abs(expected[axis]) * 1e-6f;
+      if (std::abs(position[axis] - expected[axis]) > tolerance)
+      {
+        std::printf("Model matrix multiplied by position matrix does not place dequantized vertex.\n");
+        isSucceeded = false;
+        break;
+      }
+    }
+  }
+
+  // Flat mesh of constant z and texture v, and mesh of one vertex, have zero extent axes.
+  std::vector<DVertex> flatVertices(vertices.begin(), vertices.begin() + 256);
+  for (auto& vertex : flatVertices)
+  {
+    vertex.mPosition.Z = 2.5f;
+    vertex.mTextureUv0.Y = 0.75f;
+  }
+  const auto flatDequantization = Quantize(flatVertices, compacts);
+  if (flatDequantization.mPositionScale.Z != 1.0f || flatDequantization.mUvScale.Y != 1.0f
+  ||  IsRestored(flatVertices, compacts, flatDequantization, DVector3{positionExtent.X, positionExtent.Y, 0.0f},
+                 DVector2{uvExtent.X, 0.0f}) == false)
+  {
+    std::printf("Zero extent axis of flat mesh is not restored exactly.\n");
+    isSucceeded = false;
+  }
+  const std::vector<DVertex> pointVertices(vertices.begin(), vertices.begin() + 1);
+  const auto pointDequantization = Quantize(pointVertices, compacts);
+  if (IsRestored(pointVertices, compacts, pointDequantization, DVector3{0.0f}, DVector2{0.0f}) == false)
+  {
+    std::printf("Mesh of one vertex is not restored exactly.\n");
+    isSucceeded = false;
+  }
+
+  compacts.resize(vertices.size());
+  Report("Quantize", "QuantizeVertices (vertex)", MeasureNsPerCall(4, [&](TU32)
+  {
+    DoNotOptimize(QuantizeVertices(
+        vertices[0].mPosition.Data(), vertices[0].mBaseColor.Data(), vertices[0].mTextureUv0.Data(),
+        sizeof(DVertex), kVertexCount, compacts.data()));
+  }) / TF64(kVertexCount));
+  DoNotOptimize(compacts[0]);
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
@@ -0,0 +1,138 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include "FBenchmark.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include "Type/FHelperTransform.h"
+
+namespace
+{
+
+/// Not multiple of 4, to exercise remainder path.
+constexpr TU32 kInstanceCount = 1027;
+constexpr TU32 kIterations    = 1 << 20;
+
+/// @brief Check given float arrays are nearly same with absolute tolerance.
+bool IsNearlyEqual(const float* lhs, const float* rhs, std::size_t iCount) noexcept
+{
+  for (std::size_t i = 0; i < iCount; ++i)
+  {
+    if (std::abs(lhs[i] - rhs[i]) > 1e-4f * std::max(1.0f, std::abs(rhs[i]))) { return false; }
+  }
+  return true;
+}
+
+bool IsNearlyEqual(const dy::DQuaternion& lhs, const glm::quat& rhs) noexcept
+{
+  const float expected[] = {rhs.x, rhs.y, rhs.z, rhs.w};
+  return IsNearlyEqual(lhs.Data(), expected, 4);
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunQuaternionBenchmark()
+{
+  std::mt19937 engine{0x5EED};
+  std::uniform_real_distribution<TF32> distribution{-180.0f, 180.0f};
+
+  std::vector<DQuaternion> rotations(kInstanceCount), outRotations(kInstanceCount);
+  std::vector<glm::quat> glmRotations(kInstanceCount), glmOutRotations(kInstanceCount);
+  std::vector<DVector3> positions(kInstanceCount), scales(kInstanceCount);
+  std::vector<DMatrix4> matrices(kInstanceCount);
+  for (TU32 i = 0; i < kInstanceCount; ++i)
+  {
+    const DVector3 euler{distribution(engine), distribution(engine), distribution(engine)};
+    rotations[i] = DQuaternion{euler};
+    glmRotations[i] = glm::quat{glm::radians(static_cast<glm::vec3>(euler))};
+    positions[i] = DVector3{distribution(engine), distribution(engine), distribution(engine)};
+    scales[i] = DVector3{
+        1.0f + std::abs(distribution(engine)) / 90.0f, 0.5f, 1.0f + std::abs(distribution(engine)) / 180.0f};
+  }
+
+  // Verify results before measuring.
+  bool isSucceeded = true;
+  ComposeTransforms(positions.data(), rotations.data(), scales.data(), kInstanceCount, matrices.data());
+  for (TU32 i = 0; i < kInstanceCount; ++i)
+  {
+    const auto& lhs = rotations[i];
+    const auto& rhs = rotations[(i + 1) % kInstanceCount];
+    const auto& glmLhs = glmRotations[i];
+    const auto& glmRhs = glmRotations[(i + 1) % kInstanceCount];
+    const float offset = float(i) / kInstanceCount;
+    const auto matrix = static_cast<glm::mat4>(lhs.GetRotationMatrix4x4());
+    const auto glmMatrix = glm::mat4_cast(glmLhs);
+    const auto world = static_cast<glm::mat4>(matrices[i]);
+    const auto glmWorld = glm::scale(
+        glm::translate(glm::mat4(1.0f), static_cast<glm::vec3>(positions[i])) * glmMatrix,
+        static_cast<glm::vec3>(scales[i]));
+    const auto rotated = lhs.RotateVector(positions[i]);
+    const auto glmRotated = glmLhs * static_cast<glm::vec3>(positions[i]);
+    auto rotatedMatrix = DMatrix4::CreateWithTranslation(positions[i]);
+    rotatedMatrix.Rotate(DVector3{30.0f, 45.0f, 60.0f});
+    const auto glmRotatedMatrix = glm::translate(glm::mat4(1.0f), static_cast<glm::vec3>(positions[i]))
+        * glm::mat4_cast(glm::quat{glm::radians(glm::vec3{30.0f, 45.0f, 60.0f})});
+
+    if (IsNearlyEqual(lhs, glmLhs) == false
+    ||  IsNearlyEqual(lhs * rhs, glmLhs * glmRhs) == false
+    ||  IsNearlyEqual((lhs * rhs).Normalize(), glm::normalize(glmLhs * glmRhs)) == false
+    ||  IsNearlyEqual(DQuaternion::Slerp(lhs, rhs, offset), glm::slerp(glmLhs, glmRhs, offset)) == false
+    ||  IsNearlyEqual(&matrix[0][0], &glmMatrix[0][0], 16) == false
+    ||  IsNearlyEqual(&world[0][0], &glmWorld[0][0], 16) == false
+    ||  IsNearlyEqual(rotated.Data(), &glmRotated[0], 3) == false
+    ||  IsNearlyEqual(&static_cast<glm::mat4>(rotatedMatrix)[0][0], &glmRotatedMatrix[0][0], 16) == false)
+    {
+      std::printf("DQuaternion is not same to glm at %u.\n", i);
+      isSucceeded = false; break;
+    }
+  }
+
+  constexpr TU32 mask = 1023;
+  Report("DQuaternion", "Multiply", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outRotations[i & mask] = rotations[i & mask] * rotations[(i + 1) & mask];
+  }));
+  Report("DQuaternion", "Multiply (glm)", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    glmOutRotations[i & mask] = glmRotations[i & mask] * glmRotations[(i + 1) & mask];
+  }));
+  Report("DQuaternion", "Nlerp", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outRotations[i & mask] = DQuaternion::Nlerp(rotations[i & mask], rotations[(i + 1) & mask], 0.3f);
+  }));
+  Report("DQuaternion", "Slerp", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outRotations[i & mask] = DQuaternion::Slerp(rotations[i & mask], rotations[(i + 1) & mask], 0.3f);
+  }));
+  Report("DQuaternion", "Slerp (glm)", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    glmOutRotations[i & mask] = glm::slerp(glmRotations[i & mask], glmRotations[(i + 1) & mask], 0.3f);
+  }));
+  // Compose is called per kInstanceCount instances, so divide by kInstanceCount.
+  Report("DQuaternion", "ComposeTransforms (per instance)", MeasureNsPerCall(kIterations / kInstanceCount, [&](TU32)
+  {
+    ComposeTransforms(positions.data(), rotations.data(), scales.data(), kInstanceCount, matrices.data());
+  }) / kInstanceCount);
+
+  DoNotOptimize(outRotations[0]);
+  DoNotOptimize(glmOutRotations[0]);
+  DoNotOptimize(matrices[0]);
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
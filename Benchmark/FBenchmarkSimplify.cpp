@@ -0,0 +1,150 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "FBenchmark.h"
+#include "Type/DVector2.h"
+#include "Type/DVector3.h"
+#include "Type/FHelperMeshOptimize.h"
+#include "Type/FHelperSimplify.h"
+
+namespace
+{
+
+constexpr TU32 kSliceCount = 256;
+constexpr TU32 kStackCount = 128;
+
+/// @struct DSphereVertex
+/// @brief Position and texture coordinate, like DDefaultVertex without color.
+struct DSphereVertex final
+{
+  dy::DVector3 mPosition;
+  dy::DVector2 mTextureUv0;
+};
+
+/// @brief Create unit sphere of counter-clockwise triangles with UV seam at longitude 0, optimized in order of LoadModel.
+void CreateTexturedSphere(std::vector<DSphereVertex>& outVertices, std::vector<TU32>& outIndices)
+{
+  constexpr float kPi = 3.14159265358979f;
+  for (TU32 stack = 0; stack <= kStackCount; ++stack)
+  {
+    const float theta = kPi * float(stack) / float(kStackCount);
+    // Vertices of each pole must have same position, but sin(pi) of float is not 0.
+    const float ringRadius = stack == kStackCount ? 0.0f : std::sin(theta);
+    for (TU32 slice = 0; slice <= kSliceCount; ++slice)
+    {
+      const float phi = 2.0f * kPi * float(slice) / float(kSliceCount);
+      outVertices.push_back(DSphereVertex{
+          dy::DVector3{ringRadius * std::cos(phi), ringRadius * std::sin(phi), std::cos(theta)},
+          dy::DVector2{float(slice) / float(kSliceCount), float(stack) / float(kStackCount)}});
+    }
+  }
+  const TU32 rowCount = kSliceCount + 1;
+  for (TU32 stack = 0; stack < kStackCount; ++stack)
+  {
+    for (TU32 slice = 0; slice < kSliceCount; ++slice)
+    {
+      const TU32 v0 = stack * rowCount + slice;
+      if (stack > 0)              { outIndices.insert(outIndices.end(), {v0, v0 + rowCount, v0 + 1}); }
+      if (stack + 1 < kStackCount){ outIndices.insert(outIndices.end(), {v0 + 1, v0 + rowCount, v0 + rowCount + 1}); }
+    }
+  }
+
+  const auto vertexCount = static_cast<TU32>(outVertices.size());
+  dy::OptimizeVertexCache(outIndices.data(), outIndices.size(), vertexCount, outIndices.data());
+  dy::OptimizeVertexFetch(outVertices.data(), vertexCount, sizeof(DSphereVertex), outIndices.data(), outIndices.size());
+}
+
+/// @brief Check no triangle of LOD faces inward, and get largest distance of triangle center from sphere.
+bool IsOutwardLod(
+    const std::vector<DSphereVertex>& iVertices, const TU32* iIndices, std::size_t iIndexCount, float& outMaxDistance)
+{
+  outMaxDistance = 0.0f;
+  for (std::size_t i = 0; i < iIndexCount; i += 3)
+  {
+    if (iIndices[i + 0] >= iVertices.size() || iIndices[i + 1] >= iVertices.size() || iIndices[i + 2] >= iVertices.size())
+    {
+      return false;
+    }
+    const auto& p0 = iVertices[iIndices[i + 0]].mPosition;
+    const auto& p1 = iVertices[iIndices[i + 1]].mPosition;
+    const auto& p2 = iVertices[iIndices[i + 2]].mPosition;
+    const auto center = (p0 + p1 + p2) * (1.0f / 3.0f);
+    // Collapse onto collinear vertex may leave zero-area triangle, which is not flipped.
+    const auto normal = dy::DVector3::Cross(p1 - p0, p2 - p0);
+    if (dy::DVector3::Dot(normal, center) < -0.01f * normal.GetLength() * center.GetLength()) { return false; }
+    outMaxDistance = std::max(outMaxDistance, 1.0f - center.GetLength());
+  }
+  return true;
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunSimplifyBenchmark()
+{
+  std::vector<DSphereVertex> vertices;
+  std::vector<TU32> indices;
+  CreateTexturedSphere(vertices, indices);
+  const auto vertexCount = static_cast<TU32>(vertices.size());
+
+  std::vector<TU32> lodIndices;
+  std::vector<DMeshLod> lods;
+  BuildLodChain(indices.data(), indices.size(), vertices[0].mPosition.Data(), vertices[0].mTextureUv0.Data(),
+      sizeof(DSphereVertex), vertexCount, 2.0f, lodIndices, lods);
+
+  bool isSucceeded = lods.size() == kDefaultMaxLodCount;
+  for (std::size_t lodId = 0; lodId < lods.size(); ++lodId)
+  {
+    const auto& lod = lods[lodId];
+    float maxDistance = 0.0f;
+    if (IsOutwardLod(vertices, lodIndices.data() + lod.mFirstIndex, lod.mIndexCount, maxDistance) == false
+    ||  (lodId > 0 && (lod.mError < lods[lodId - 1].mError || lod.mIndexCount > lods[lodId - 1].mIndexCount * 0.6f)))
+    {
+      isSucceeded = false;
+    }
+
+    const std::string suffix = " (LOD " + std::to_string(lodId) + ")";
+    ReportValue("Simplify", ("Triangles" + suffix).c_str(), TF64(lod.mIndexCount / 3), "triangles");
+    ReportValue("Simplify", ("Quadric error" + suffix).c_str(), TF64(lod.mError), "units");
+    ReportValue("Simplify", ("Sphere distance" + suffix).c_str(), TF64(maxDistance), "units");
+  }
+  if (SelectLod(lods.data(), lods.size(), 0.0f) != 0
+  ||  SelectLod(lods.data(), lods.size(), NumericalMax<float>) != lods.size() - 1)
+  {
+    isSucceeded = false;
+  }
+  if (isSucceeded == false) { std::printf("LOD chain of sphere is not simplified or has flipped triangles.\n"); }
+
+  const auto triangleCount = TF64(indices.size() / 3);
+  Report("Simplify", "SimplifyMesh to half (triangle)", MeasureNsPerCall(1, [&](TU32)
+  {
+    DoNotOptimize(SimplifyMesh(indices.data(), indices.size(), vertices[0].mPosition.Data(), vertices[0].mTextureUv0.Data(),
+        sizeof(DSphereVertex), vertexCount, indices.size() / 6 * 3, NumericalMax<float>, 2.0f));
+  }) / triangleCount);
+  Report("Simplify", "BuildLodChain (source triangle)", MeasureNsPerCall(1, [&](TU32)
+  {
+    BuildLodChain(indices.data(), indices.size(), vertices[0].mPosition.Data(), vertices[0].mTextureUv0.Data(),
+        sizeof(DSphereVertex), vertexCount, 2.0f, lodIndices, lods);
+  }) / triangleCount);
+  DoNotOptimize(lodIndices[0]);
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
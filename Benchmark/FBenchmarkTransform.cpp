@@ -0,0 +1,112 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "FBenchmark.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include "Type/FHelperTransform.h"
+
+namespace
+{
+
+/// Not multiple of 8, to exercise remainder path.
+constexpr TU32 kPointCount  = 10007;
+constexpr TU32 kIterations  = 256;
+
+/// @brief Check (x, y, z) is bit-exact to result of DMatrix4::MultiplyVector, which is bit-exact to glm.
+bool IsSameToMultiplyVector(float x, float y, float z, const dy::DVector4& iExpected) noexcept
+{
+  const float values[] = {x, y, z};
+  return std::memcmp(values, iExpected.Data(), sizeof(values)) == 0;
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunTransformBenchmark()
+{
+  std::mt19937 engine{0x5EED};
+  std::uniform_real_distribution<TF32> distribution{-10.0f, 10.0f};
+
+  const auto glmMatrix = glm::scale(
+      glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3{1.0f, -2.0f, 3.0f}), 0.7f, glm::normalize(glm::vec3{1, 2, 3})),
+      glm::vec3{2.0f, 0.5f, 1.5f});
+  const DMatrix4 matrix = glmMatrix;
+
+  std::vector<DVector3> points(kPointCount), outPoints(kPointCount);
+  std::vector<TF32> xList(kPointCount), yList(kPointCount), zList(kPointCount);
+  std::vector<TF32> outXList(kPointCount), outYList(kPointCount), outZList(kPointCount);
+  for (TU32 i = 0; i < kPointCount; ++i)
+  {
+    points[i] = DVector3{distribution(engine), distribution(engine), distribution(engine)};
+    xList[i] = points[i].X; yList[i] = points[i].Y; zList[i] = points[i].Z;
+  }
+  const DConstVector3Stream input{xList.data(), yList.data(), zList.data()};
+  const DVector3Stream output{outXList.data(), outYList.data(), outZList.data()};
+
+  // Verify results before measuring.
+  bool isSucceeded = true;
+  for (TF32 w : {1.0f, 0.0f})
+  {
+    if (w == 1.0f)
+    {
+      TransformPoints(matrix, input, kPointCount, output);
+      TransformPoints(matrix, points.data(), kPointCount, outPoints.data());
+    }
+    else
+    {
+      TransformDirections(matrix, input, kPointCount, output);
+      TransformDirections(matrix, points.data(), kPointCount, outPoints.data());
+    }
+    for (TU32 i = 0; i < kPointCount; ++i)
+    {
+      const auto expected = matrix.MultiplyVector(DVector4{xList[i], yList[i], zList[i], w});
+      if (IsSameToMultiplyVector(outXList[i], outYList[i], outZList[i], expected) == false
+      ||  IsSameToMultiplyVector(outPoints[i].X, outPoints[i].Y, outPoints[i].Z, expected) == false)
+      {
+        std::printf("Transform%s is not bit-exact to MultiplyVector at %u.\n", w == 1.0f ? "Points" : "Directions", i);
+        isSucceeded = false; break;
+      }
+    }
+  }
+
+  // Functions are called per kPointCount points, so divide by kPointCount.
+  Report("Transform", "MultiplyVector (per point)", MeasureNsPerCall(kIterations, [&](TU32)
+  {
+    for (TU32 i = 0; i < kPointCount; ++i)
+    {
+      const auto& point = points[i];
+      const auto result = matrix.MultiplyVector(DVector4{point.X, point.Y, point.Z, 1.0f});
+      outPoints[i] = DVector3{result.X, result.Y, result.Z};
+    }
+  }) / kPointCount);
+  Report("Transform", "TransformPoints SoA (per point)", MeasureNsPerCall(kIterations, [&](TU32)
+  {
+    TransformPoints(matrix, input, kPointCount, output);
+  }) / kPointCount);
+  Report("Transform", "TransformPoints AoS (per point)", MeasureNsPerCall(kIterations, [&](TU32)
+  {
+    TransformPoints(matrix, points.data(), kPointCount, outPoints.data());
+  }) / kPointCount);
+
+  DoNotOptimize(outPoints[0]);
+  DoNotOptimize(outXList[0]);
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
@@ -0,0 +1,149 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cstring>
+#include <random>
+#include <vector>
+#include "FBenchmark.h"
+#include "Type/DVector2.h"
+#include "Type/DVector3.h"
+#include "Type/DVector4.h"
+
+namespace
+{
+
+constexpr TU32 kVectorCount = 1024;
+constexpr TU32 kIterations  = 1 << 20;
+
+/// @brief Construct `TVector` of `TCount` elements from packed floats.
+/// DVector and glm vector have same element-wise constructor.
+template <typename TVector, std::size_t TCount>
+TVector Construct(const float* iValues) noexcept
+{
+  if constexpr (TCount == 2)      { return TVector{iValues[0], iValues[1]}; }
+  else if constexpr (TCount == 3) { return TVector{iValues[0], iValues[1], iValues[2]}; }
+  else                            { return TVector{iValues[0], iValues[1], iValues[2], iValues[3]}; }
+}
+
+/// @brief Benchmark `TVector` against `TGlmVector`. Element-wise operators are exact in IEEE 754,
+/// so results must be bit-exact to glm.
+template <typename TVector, typename TGlmVector, std::size_t TCount>
+bool RunVectorTypeBenchmark(const char* iGroup, std::mt19937& ioEngine)
+{
+  std::uniform_real_distribution<TF32> distribution{-100.0f, 100.0f};
+
+  std::vector<float> floatList(kVectorCount * TCount);
+  for (auto& value : floatList) { value = distribution(ioEngine); }
+
+  std::vector<TVector> lhsList(kVectorCount), rhsList(kVectorCount), outList(kVectorCount);
+  std::vector<TGlmVector> glmLhsList(kVectorCount), glmRhsList(kVectorCount), glmOutList(kVectorCount);
+  for (TU32 i = 0; i < kVectorCount; ++i)
+  {
+    lhsList[i] = Construct<TVector, TCount>(&floatList[i * TCount]);
+    rhsList[i] = Construct<TVector, TCount>(&floatList[((i + 1) % kVectorCount) * TCount]);
+    glmLhsList[i] = static_cast<TGlmVector>(lhsList[i]);
+    glmRhsList[i] = static_cast<TGlmVector>(rhsList[i]);
+  }
+
+  // Verify results before measuring.
+  bool isSucceeded = true;
+  for (TU32 i = 0; i < kVectorCount; ++i)
+  {
+    const auto& lhs = lhsList[i];
+    const auto& rhs = rhsList[i];
+    const auto& glmLhs = glmLhsList[i];
+    const auto& glmRhs = glmRhsList[i];
+    const TGlmVector results[] = {
+        static_cast<TGlmVector>(lhs + rhs), static_cast<TGlmVector>(lhs - rhs),
+        static_cast<TGlmVector>(lhs * rhs), static_cast<TGlmVector>(lhs * 0.5f),
+        static_cast<TGlmVector>(TVector{glmLhs})};
+    const TGlmVector glmResults[] = {glmLhs + glmRhs, glmLhs - glmRhs, glmLhs * glmRhs, glmLhs * 0.5f, glmLhs};
+    if (std::memcmp(results, glmResults, sizeof(results)) != 0)
+    {
+      std::printf("%s is not bit-exact to glm at %u.\n", iGroup, i);
+      isSucceeded = false; break;
+    }
+  }
+
+  constexpr TU32 mask = kVectorCount - 1;
+  dy::bench::Report(iGroup, "Construct", dy::bench::MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outList[i & mask] = Construct<TVector, TCount>(&floatList[(i & mask) * TCount]);
+  }));
+  dy::bench::Report(iGroup, "Construct (glm)", dy::bench::MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    glmOutList[i & mask] = Construct<TGlmVector, TCount>(&floatList[(i & mask) * TCount]);
+  }));
+  dy::bench::Report(iGroup, "operator+", dy::bench::MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outList[i & mask] = lhsList[i & mask] + rhsList[(i + 1) & mask];
+  }));
+  dy::bench::Report(iGroup, "operator+ (glm)", dy::bench::MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    glmOutList[i & mask] = glmLhsList[i & mask] + glmRhsList[(i + 1) & mask];
+  }));
+  dy::bench::Report(iGroup, "operator-", dy::bench::MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outList[i & mask] = lhsList[i & mask] - rhsList[(i + 1) & mask];
+  }));
+  dy::bench::Report(iGroup, "operator- (glm)", dy::bench::MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    glmOutList[i & mask] = glmLhsList[i & mask] - glmRhsList[(i + 1) & mask];
+  }));
+  dy::bench::Report(iGroup, "operator* (element)", dy::bench::MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outList[i & mask] = lhsList[i & mask] * rhsList[(i + 1) & mask];
+  }));
+  dy::bench::Report(iGroup, "operator* (element, glm)", dy::bench::MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    glmOutList[i & mask] = glmLhsList[i & mask] * glmRhsList[(i + 1) & mask];
+  }));
+  dy::bench::Report(iGroup, "operator* (scalar)", dy::bench::MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outList[i & mask] = lhsList[i & mask] * 0.5f;
+  }));
+  dy::bench::Report(iGroup, "operator* (scalar, glm)", dy::bench::MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    glmOutList[i & mask] = glmLhsList[i & mask] * 0.5f;
+  }));
+  dy::bench::Report(iGroup, "FromGlm", dy::bench::MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outList[i & mask] = TVector{glmLhsList[i & mask]};
+  }));
+  dy::bench::Report(iGroup, "ToGlm", dy::bench::MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    glmOutList[i & mask] = static_cast<TGlmVector>(lhsList[i & mask]);
+  }));
+
+  dy::bench::DoNotOptimize(outList[0]);
+  dy::bench::DoNotOptimize(glmOutList[0]);
+  return isSucceeded;
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunVectorBenchmark()
+{
+  std::mt19937 engine{0x5EED};
+
+  bool isSucceeded = true;
+  isSucceeded &= RunVectorTypeBenchmark<DVector2, glm::vec2, 2>("DVector2", engine);
+  isSucceeded &= RunVectorTypeBenchmark<DVector3, glm::vec3, 3>("DVector3", engine);
+  isSucceeded &= RunVectorTypeBenchmark<DVector4, glm::vec4, 4>("DVector4", engine);
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
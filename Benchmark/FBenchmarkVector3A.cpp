@@ -0,0 +1,123 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include "FBenchmark.h"
+#include "Type/DVector3A.h"
+
+namespace
+{
+
+constexpr TU32 kVectorCount = 1024;
+constexpr TU32 kIterations  = 1 << 20;
+/// Vector elements are in [-100, 100], so products are up to 100 * 100.
+constexpr float kProductMagnitude = 100.0f * 100.0f;
+
+/// @brief Check given values are nearly same with relative tolerance. \n
+/// Scalar DVector3 code may be contracted to FMA, so error of dot and cross products is
+/// relative to magnitude of products (`iMagnitude`), not result.
+bool IsNearlyEqual(float lhs, float rhs, float iMagnitude = 1.0f) noexcept
+{
+  return std::abs(lhs - rhs) <= 1e-5f * std::max(iMagnitude, std::abs(rhs));
+}
+
+/// @brief Check given vectors are nearly same, and padding lane is kept as 0.
+bool IsNearlyEqual(const dy::DVector3A& lhs, const dy::DVector3& rhs, float iMagnitude = 1.0f) noexcept
+{
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    if (IsNearlyEqual(lhs[i], rhs[i], iMagnitude) == false) { return false; }
+  }
+  return lhs.__W == 0.0f;
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunVector3ABenchmark()
+{
+  static_assert(DVector3A{1, 2, 3} + DVector3A{1, 1, 1} == DVector3A{2, 3, 4}, "Test failed");
+  static_assert(DVector3A{1, 2, 3} * 2.0f - DVector3A{1.0f} == DVector3A{1, 3, 5}, "Test failed");
+
+  std::mt19937 engine{0x5EED};
+  std::uniform_real_distribution<TF32> distribution{-100.0f, 100.0f};
+  std::vector<DVector3> vectors(kVectorCount), outVectors(kVectorCount);
+  std::vector<DVector3A> alignedVectors(kVectorCount), outAlignedVectors(kVectorCount);
+  for (TU32 i = 0; i < kVectorCount; ++i)
+  {
+    vectors[i] = DVector3{distribution(engine), distribution(engine), distribution(engine)};
+    alignedVectors[i] = DVector3A{vectors[i]};
+  }
+
+  // Verify results with DVector3 before measuring.
+  bool isSucceeded = true;
+  for (TU32 i = 0; i < kVectorCount; ++i)
+  {
+    const auto& lhs = vectors[i];
+    const auto& rhs = vectors[(i + 1) % kVectorCount];
+    const auto& alignedLhs = alignedVectors[i];
+    const auto& alignedRhs = alignedVectors[(i + 1) % kVectorCount];
+    auto compound = alignedLhs;
+    compound += alignedRhs; compound *= 0.5f; compound -= alignedRhs; compound /= 2.0f;
+
+    if (static_cast<DVector3>(alignedLhs) != lhs
+    ||  IsNearlyEqual(alignedLhs + alignedRhs, lhs + rhs) == false
+    ||  IsNearlyEqual(alignedLhs - alignedRhs, lhs - rhs) == false
+    ||  IsNearlyEqual(-alignedLhs, lhs * -1.0f) == false
+    ||  IsNearlyEqual(alignedLhs * alignedRhs, lhs * rhs) == false
+    ||  IsNearlyEqual(alignedLhs / alignedRhs, DVector3{lhs.X / rhs.X, lhs.Y / rhs.Y, lhs.Z / rhs.Z}) == false
+    ||  IsNearlyEqual(alignedLhs / 4.0f, lhs * 0.25f) == false
+    ||  IsNearlyEqual(compound, (((lhs + rhs) * 0.5f) - rhs) * 0.5f) == false
+    ||  IsNearlyEqual(alignedLhs.Normalize(), lhs.Normalize()) == false
+    ||  IsNearlyEqual(DVector3A::Cross(alignedLhs, alignedRhs), DVector3::Cross(lhs, rhs), kProductMagnitude) == false
+    ||  IsNearlyEqual(DVector3A::Lerp(alignedLhs, alignedRhs, 0.3f), DVector3::Lerp(lhs, rhs, 0.3f)) == false
+    ||  IsNearlyEqual(DVector3A::Dot(alignedLhs, alignedRhs), DVector3::Dot(lhs, rhs), kProductMagnitude) == false
+    ||  IsNearlyEqual(alignedLhs.GetLength(), lhs.GetLength()) == false)
+    {
+      std::printf("DVector3A is not same to DVector3 at %u.\n", i);
+      isSucceeded = false; break;
+    }
+  }
+
+  constexpr TU32 mask = kVectorCount - 1;
+  Report("DVector3A", "Normalize", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outAlignedVectors[i & mask] = alignedVectors[i & mask].Normalize();
+  }));
+  Report("DVector3A", "Normalize (DVector3)", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outVectors[i & mask] = vectors[i & mask].Normalize();
+  }));
+  Report("DVector3A", "Cross", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outAlignedVectors[i & mask] = DVector3A::Cross(alignedVectors[i & mask], alignedVectors[(i + 1) & mask]);
+  }));
+  Report("DVector3A", "Cross (DVector3)", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outVectors[i & mask] = DVector3::Cross(vectors[i & mask], vectors[(i + 1) & mask]);
+  }));
+  Report("DVector3A", "Load and store DVector3", MeasureNsPerCall(kIterations, [&](TU32 i)
+  {
+    outVectors[i & mask] = static_cast<DVector3>(DVector3A{vectors[i & mask]} * 2.0f);
+  }));
+
+  DoNotOptimize(outVectors[0]);
+  DoNotOptimize(outAlignedVectors[0]);
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
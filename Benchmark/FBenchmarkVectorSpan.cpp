@@ -0,0 +1,154 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "FBenchmark.h"
+#include "Type/FHelperVectorSpan.h"
+
+namespace
+{
+
+/// Not multiple of 16, to exercise remainder path.
+constexpr TU32 kVectorCount = 10007;
+constexpr TU32 kIterations  = 256;
+/// Vector elements are in [-100, 100], so products are up to 100 * 100.
+constexpr float kProductMagnitude = 100.0f * 100.0f;
+
+/// @brief Check given float arrays are nearly same with relative tolerance. \n
+/// Dot and cross products cancel out, and kernels may be contracted to FMA,
+/// so error is relative to magnitude of products (`iMagnitude`), not result.
+bool IsNearlyEqual(const float* lhs, const float* rhs, std::size_t iCount, float iMagnitude = 1.0f) noexcept
+{
+  for (std::size_t i = 0; i < iCount; ++i)
+  {
+    if (std::abs(lhs[i] - rhs[i]) > 1e-5f * std::max(iMagnitude, std::abs(rhs[i]))) { return false; }
+  }
+  return true;
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunVectorSpanBenchmark()
+{
+  std::mt19937 engine{0x5EED};
+  std::uniform_real_distribution<TF32> distribution{-100.0f, 100.0f};
+  std::vector<DVector3> lhs(kVectorCount), rhs(kVectorCount), result(kVectorCount), expected(kVectorCount);
+  std::vector<float> dots(kVectorCount), expectedDots(kVectorCount);
+  for (TU32 i = 0; i < kVectorCount; ++i)
+  {
+    lhs[i] = DVector3{distribution(engine), distribution(engine), distribution(engine)};
+    rhs[i] = DVector3{distribution(engine), distribution(engine), distribution(engine)};
+  }
+
+  // Scalar results.
+  std::vector<DVector3> expectedAdd(kVectorCount), expectedLerp(kVectorCount);
+  std::vector<DVector3> expectedCross(kVectorCount), expectedNormalize(kVectorCount);
+  DAabb expectedBounds{lhs[0], lhs[0]};
+  for (TU32 i = 0; i < kVectorCount; ++i)
+  {
+    expectedAdd[i] = lhs[i] + rhs[i];
+    expectedLerp[i] = DVector3::Lerp(lhs[i], rhs[i], 0.3f);
+    expectedDots[i] = DVector3::Dot(lhs[i], rhs[i]);
+    expectedCross[i] = DVector3::Cross(lhs[i], rhs[i]);
+    expectedNormalize[i] = lhs[i].Normalize();
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+      expectedBounds.mMin[axis] = std::min(expectedBounds.mMin[axis], lhs[i][axis]);
+      expectedBounds.mMax[axis] = std::max(expectedBounds.mMax[axis], lhs[i][axis]);
+    }
+  }
+
+  bool isSucceeded = true;
+  const auto supportedLevel = GetSupportedSimdLevel();
+  std::printf("Supported SIMD level : %s\n", ToString(supportedLevel));
+
+  for (auto level : {ESimdLevel::Sse2, ESimdLevel::Avx2, ESimdLevel::Avx512})
+  {
+    if (level > supportedLevel) { break; }
+    SetVectorSpanSimdLevel(level);
+    const char* name = ToString(GetVectorSpanSimdLevel());
+
+    // Verify results before measuring.
+    const auto check = [&](const char* iOperation, const float* iResult, const float* iExpected, std::size_t iCount,
+        float iMagnitude = 1.0f)
+    {
+      if (IsNearlyEqual(iResult, iExpected, iCount, iMagnitude) == false)
+      {
+        std::printf("%s %s is not same to scalar result.\n", name, iOperation);
+        isSucceeded = false;
+      }
+    };
+    AddVectors(lhs.data(), rhs.data(), kVectorCount, result.data());
+    check("AddVectors", result[0].Data(), expectedAdd[0].Data(), kVectorCount * 3);
+    LerpVectors(lhs.data(), rhs.data(), 0.3f, kVectorCount, result.data());
+    check("LerpVectors", result[0].Data(), expectedLerp[0].Data(), kVectorCount * 3);
+    DotVectors(lhs.data(), rhs.data(), kVectorCount, dots.data());
+    check("DotVectors", dots.data(), expectedDots.data(), kVectorCount, kProductMagnitude);
+    CrossVectors(lhs.data(), rhs.data(), kVectorCount, result.data());
+    check("CrossVectors", result[0].Data(), expectedCross[0].Data(), kVectorCount * 3, kProductMagnitude);
+    NormalizeVectors(lhs.data(), kVectorCount, result.data());
+    check("NormalizeVectors", result[0].Data(), expectedNormalize[0].Data(), kVectorCount * 3);
+    const auto bounds = ComputeBounds(lhs.data(), kVectorCount);
+    check("ComputeBounds", bounds.mMin.Data(), expectedBounds.mMin.Data(), 3);
+    check("ComputeBounds", bounds.mMax.Data(), expectedBounds.mMax.Data(), 3);
+
+    // Spans are processed per kVectorCount vectors, so divide by kVectorCount.
+    char label[64];
+    std::snprintf(label, sizeof(label), "Cross (%s, per vector)", name);
+    Report("VectorSpan", label, MeasureNsPerCall(kIterations, [&](TU32)
+    {
+      CrossVectors(lhs.data(), rhs.data(), kVectorCount, result.data());
+    }) / kVectorCount);
+    std::snprintf(label, sizeof(label), "Normalize (%s, per vector)", name);
+    Report("VectorSpan", label, MeasureNsPerCall(kIterations, [&](TU32)
+    {
+      NormalizeVectors(lhs.data(), kVectorCount, result.data());
+    }) / kVectorCount);
+    std::snprintf(label, sizeof(label), "Bounds (%s, per vector)", name);
+    Report("VectorSpan", label, MeasureNsPerCall(kIterations, [&](TU32)
+    {
+      DoNotOptimize(ComputeBounds(lhs.data(), kVectorCount));
+    }) / kVectorCount);
+  }
+  SetVectorSpanSimdLevel(supportedLevel);
+
+  // Each output is sunk, otherwise invariant inline loop is hoisted out of measurement.
+  Report("VectorSpan", "Cross (DVector3, per vector)", MeasureNsPerCall(kIterations, [&](TU32)
+  {
+    for (TU32 i = 0; i < kVectorCount; ++i)
+    {
+      expected[i] = DVector3::Cross(lhs[i], rhs[i]);
+      DoNotOptimize(expected[i]);
+    }
+  }) / kVectorCount);
+  Report("VectorSpan", "Normalize (DVector3, per vector)", MeasureNsPerCall(kIterations, [&](TU32)
+  {
+    for (TU32 i = 0; i < kVectorCount; ++i)
+    {
+      expected[i] = lhs[i].Normalize();
+      DoNotOptimize(expected[i]);
+    }
+  }) / kVectorCount);
+
+  DoNotOptimize(result[0]);
+  DoNotOptimize(expected[0]);
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
@@ -0,0 +1,185 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "FBenchmark.h"
+#include "Type/DVector2.h"
+#include "Type/DVector3.h"
+#include "Type/FHelperVertexDedup.h"
+
+namespace
+{
+
+/// Grid of kGridSize x kGridSize quads, 6 corners per quad.
+constexpr TU32 kGridSize = 512;
+
+/// @struct DVertex
+/// @brief Same layout to DDefaultVertex, which can not be used here because it depends on Vulkan.
+struct DVertex final
+{
+  dy::DVector3 mPosition;
+  dy::DVector3 mBaseColor;
+  dy::DVector2 mTextureUv0;
+
+  bool operator==(const DVertex& iOther) const noexcept
+  {
+    return this->mPosition == iOther.mPosition
+        && this->mBaseColor == iOther.mBaseColor
+        && this->mTextureUv0 == iOther.mTextureUv0;
+  }
+};
+
+/// @brief Previous std::hash<DDefaultVertex> of xor-shift combiners, kept as reference.
+struct DCombinedHash final
+{
+  std::size_t operator()(const DVertex& vertex) const
+  {
+    return ((std::hash<dy::DVector3>()(vertex.mPosition)
+          ^ (std::hash<dy::DVector3>()(vertex.mBaseColor) << 1)) >> 1)
+      ^ (std::hash<dy::DVector2>()(vertex.mTextureUv0) << 1);
+  }
+};
+
+struct DObjectHash final
+{
+  std::size_t operator()(const DVertex& vertex) const { return static_cast<std::size_t>(dy::HashObject(vertex)); }
+};
+
+/// @brief Previous deduplication of LoadModel, kept as reference.
+template <typename THash>
+void DeduplicateWithMap(const std::vector<DVertex>& iCorners, std::vector<DVertex>& outVertices, std::vector<TU32>& outIndices)
+{
+  outVertices.clear();
+  outIndices.clear();
+  std::unordered_map<DVertex, TU32, THash> uniqueVertices = {};
+  for (const auto& vertex : iCorners)
+  {
+    if (uniqueVertices.count(vertex) == 0)
+    {
+      uniqueVertices[vertex] = static_cast<TU32>(outVertices.size());
+      outVertices.emplace_back(vertex);
+    }
+    outIndices.emplace_back(uniqueVertices[vertex]);
+  }
+}
+
+/// @brief Create corners of grid mesh on integer coordinates, which collide on xor-shift combiners.
+std::vector<DVertex> CreateGridCorners()
+{
+  std::vector<DVertex> corners;
+  corners.reserve(std::size_t{kGridSize} * kGridSize * 6);
+  const auto corner = [](TU32 x, TU32 z)
+  {
+    return DVertex{
+        dy::DVector3{float(x), 0.0f, float(z)},
+        dy::DVector3{1.0f},
+        dy::DVector2{float(x) / kGridSize, float(z) / kGridSize}};
+  };
+  for (TU32 z = 0; z < kGridSize; ++z)
+  {
+    for (TU32 x = 0; x < kGridSize; ++x)
+    {
+      for (const auto& vertex : {corner(x, z), corner(x + 1, z), corner(x + 1, z + 1),
+                                 corner(x + 1, z + 1), corner(x, z + 1), corner(x, z)})
+      {
+        corners.push_back(vertex);
+      }
+    }
+  }
+  return corners;
+}
+
+/// @brief Count distinct slots of unique vertices in power of two table with load factor 1/2,
+/// where slot is taken from low bits of hash value.
+template <typename THash>
+std::size_t CountDistinctSlots(const std::vector<DVertex>& iVertices)
+{
+  std::size_t mask = 1;
+  while (mask < iVertices.size() * 2) { mask <<= 1; }
+  mask -= 1;
+
+  std::unordered_set<std::size_t> slots;
+  for (const auto& vertex : iVertices) { slots.insert(THash{}(vertex) & mask); }
+  return slots.size();
+}
+
+} /// anonymous namespace
+
+namespace dy::bench
+{
+
+bool RunVertexDedupBenchmark()
+{
+  const auto corners = CreateGridCorners();
+  const auto cornerCount = TF64(corners.size());
+
+  // Verify results before measuring. Every method numbers vertices by first appearance.
+  bool isSucceeded = true;
+  std::vector<DVertex> expectedVertices, vertices;
+  std::vector<TU32> expectedIndices, indices;
+  DeduplicateWithMap<DCombinedHash>(corners, expectedVertices, expectedIndices);
+
+  const TU32 hardwareThreadCount = std::max(2u, std::thread::hardware_concurrency());
+  std::vector<TU32> threadCounts = {1, 2, 4};
+  if (hardwareThreadCount > 4) { threadCounts.push_back(hardwareThreadCount); }
+  for (const TU32 threadCount : threadCounts)
+  {
+    DVertexDedupStats stats;
+    DeduplicateVerticesParallel(corners.data(), corners.size(), threadCount, vertices, indices, &stats);
+    if (vertices != expectedVertices || indices != expectedIndices)
+    {
+      std::printf("DeduplicateVerticesParallel (%u threads) is not same to std::unordered_map.\n", threadCount);
+      isSucceeded = false; break;
+    }
+
+    const std::string suffix = " (" + std::to_string(threadCount) + " threads)";
+    ReportValue("VertexDedup", ("Average probe" + suffix).c_str(), stats.GetAverageProbeLength(), "slots");
+    ReportValue("VertexDedup", ("Max probe" + suffix).c_str(), stats.mMaxProbeLength, "slots");
+    ReportValue("VertexDedup", ("Collisions per lookup" + suffix).c_str(),
+        TF64(stats.mCollisionCount) / TF64(stats.mLookupCount), "slots");
+  }
+  // Vertices which share slot always collide, so fewer distinct slots mean longer probes.
+  ReportValue("VertexDedup", "Unique vertices", TF64(expectedVertices.size()), "vertices");
+  ReportValue("VertexDedup", "Distinct slots (combined)",
+      TF64(CountDistinctSlots<DCombinedHash>(expectedVertices)), "slots");
+  ReportValue("VertexDedup", "Distinct slots (HashObject)",
+      TF64(CountDistinctSlots<DObjectHash>(expectedVertices)), "slots");
+
+  // Whole deduplication is measured, so divide by corner count.
+  Report("VertexDedup", "unordered_map (combined, corner)", MeasureNsPerCall(1, [&](TU32)
+  {
+    DeduplicateWithMap<DCombinedHash>(corners, vertices, indices);
+  }) / cornerCount);
+  Report("VertexDedup", "unordered_map (HashObject, corner)", MeasureNsPerCall(1, [&](TU32)
+  {
+    DeduplicateWithMap<DObjectHash>(corners, vertices, indices);
+  }) / cornerCount);
+  for (const TU32 threadCount : threadCounts)
+  {
+    const std::string name = "FVertexHashTable (" + std::to_string(threadCount) + " threads, corner)";
+    Report("VertexDedup", name.c_str(), MeasureNsPerCall(1, [&](TU32)
+    {
+      DeduplicateVerticesParallel(corners.data(), corners.size(), threadCount, vertices, indices);
+    }) / cornerCount);
+  }
+
+  DoNotOptimize(vertices[0]);
+  DoNotOptimize(indices[0]);
+  return isSucceeded;
+}
+
+} /// ::dy::bench namespace
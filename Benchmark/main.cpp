@@ -0,0 +1,70 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+//!
+//! Benchmark main function.
+//! Usage : VulkanSandboxBenchmark [--json <path>] [--csv <path>]
+//!
+
+#include <cstring>
+#include "FBenchmark.h"
+
+int main(int argc, char* argv[])
+{
+  const char* jsonPath = nullptr;
+  const char* csvPath  = nullptr;
+  for (int i = 1; i < argc; ++i)
+  {
+    if      (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) { jsonPath = argv[++i]; }
+    else if (std::strcmp(argv[i], "--csv") == 0 && i + 1 < argc)  { csvPath = argv[++i]; }
+    else
+    {
+      std::printf("Usage : %s [--json <path>] [--csv <path>]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  bool isSucceeded = true;
+  isSucceeded &= dy::bench::RunVectorBenchmark();
+  isSucceeded &= dy::bench::RunVector3ABenchmark();
+  isSucceeded &= dy::bench::RunMatrix4Benchmark();
+  isSucceeded &= dy::bench::RunMatrix3x4Benchmark();
+  isSucceeded &= dy::bench::RunTransformBenchmark();
+  isSucceeded &= dy::bench::RunQuaternionBenchmark();
+  isSucceeded &= dy::bench::RunFrustumBenchmark();
+  isSucceeded &= dy::bench::RunVectorSpanBenchmark();
+  isSucceeded &= dy::bench::RunVertexDedupBenchmark();
+  isSucceeded &= dy::bench::RunMeshOptimizeBenchmark();
+  isSucceeded &= dy::bench::RunQuantizeBenchmark();
+  isSucceeded &= dy::bench::RunIndexBufferBenchmark();
+  isSucceeded &= dy::bench::RunMeshletBenchmark();
+  isSucceeded &= dy::bench::RunSimplifyBenchmark();
+  isSucceeded &= dy::bench::RunObjStreamBenchmark();
+  isSucceeded &= dy::bench::RunMeshCacheBenchmark();
+  isSucceeded &= dy::bench::RunMeshRegistryBenchmark();
+  isSucceeded &= dy::bench::RunMipmapBenchmark();
+  isSucceeded &= dy::bench::RunImageDecodeBenchmark();
+
+  if (jsonPath != nullptr && dy::bench::WriteResultsJson(jsonPath) == false)
+  {
+    std::printf("Failed to write %s.\n", jsonPath);
+    isSucceeded = false;
+  }
+  if (csvPath != nullptr && dy::bench::WriteResultsCsv(csvPath) == false)
+  {
+    std::printf("Failed to write %s.\n", csvPath);
+    isSucceeded = false;
+  }
+
+  return isSucceeded == true ? 0 : 1;
+}
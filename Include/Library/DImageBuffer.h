@@ -12,6 +12,7 @@
 /// SOFTWARE.
 ///
 
+#include <cstddef>
 #include <string>
 #include "FGlobalType.h"
 #include "FMacro.h"
@@ -22,17 +23,21 @@ namespace dy
 
 /// @class DDyImageBinaryDataBuffer
 /// @brief Image binary buffer that manages binary buffer chunk, 
-/// automatically released when it's be out of scope.
+/// automatically released when it's be out of scope. \n
+/// Image is decoded as RGBA without process-wide state of stb_image, so buffers can be created
+/// on several threads at once, e.g. by FImageDecodePool.
 class DDyImageBinaryDataBuffer final
 {
 public:
-  DDyImageBinaryDataBuffer(const std::string& imagePath);
+  /// @brief Decode image of `imagePath`. Rows are flipped to bottom-up order if `iIsFlipVertically` is true.
+  DDyImageBinaryDataBuffer(const std::string& imagePath, bool iIsFlipVertically = true);
   ~DDyImageBinaryDataBuffer();
 
   DDyImageBinaryDataBuffer(const DDyImageBinaryDataBuffer&)                 = delete;
   DDyImageBinaryDataBuffer& operator=(DDyImageBinaryDataBuffer&)            = delete;
-  DDyImageBinaryDataBuffer(DDyImageBinaryDataBuffer&&) noexcept             = default;
-  DDyImageBinaryDataBuffer& operator=(DDyImageBinaryDataBuffer&&) noexcept  = default;
+  /// @brief Take buffer chunk of `ioSource`, which becomes not created properly.
+  DDyImageBinaryDataBuffer(DDyImageBinaryDataBuffer&& ioSource) noexcept;
+  DDyImageBinaryDataBuffer& operator=(DDyImageBinaryDataBuffer&& ioSource) noexcept;
 
   /// @brief Check if buffer chunk is created properly when construction time.
   MCR_NODISCARD bool IsBufferCreatedProperly() const noexcept
@@ -80,4 +85,17 @@ private:
   bool mIsBufferCreatedProperly       = false;
 };
 
+/// @brief Read width and height of image of `iImagePath` from its header, without decoding it.
+/// Return false if image can not be read.
+MCR_NODISCARD bool GetImageSize(const std::string& iImagePath, TI32& outWidth, TI32& outHeight);
+
+/// @brief Decode image of `iImagePath` as RGBA into `outPixels` of `iSize` bytes, which must be width * height * 4. \n
+/// Decoder writes output image to `outPixels` directly, e.g. mapped staging memory, instead of its own heap buffer.
+/// Rows are flipped in place if `iIsFlipVertically` is true, which reads `outPixels` back, so keep it false
+/// for write-combined memory. Return false if image can not be decoded or its size is not `iSize`.
+/// If decoder used caller memory for its intermediate data, output is copied from heap instead,
+/// and false is written to `outIsDirect` if it is not null.
+MCR_NODISCARD bool DecodeImageInto(
+    const std::string& iImagePath, bool iIsFlipVertically, void* outPixels, std::size_t iSize, bool* outIsDirect = nullptr);
+
 } /// ::dy namespace
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <string>
+#include "FGlobalType.h"
+#include "FMacro.h"
+
+namespace dy
+{
+
+/// @class DMappedFile
+/// @brief Read-only memory mapped file, automatically unmapped when it's be out of scope.
+class DMappedFile final
+{
+public:
+  DMappedFile() = default;
+  explicit DMappedFile(const std::string& iFilePath);
+  ~DMappedFile();
+
+  DMappedFile(const DMappedFile&)             = delete;
+  DMappedFile& operator=(const DMappedFile&)  = delete;
+  DMappedFile(DMappedFile&& ioSource) noexcept;
+  DMappedFile& operator=(DMappedFile&& ioSource) noexcept;
+
+  /// @brief Check file is mapped. Not existing or empty file is not mapped.
+  MCR_NODISCARD bool IsMapped() const noexcept { return this->mData != nullptr; }
+
+  /// @brief Get the start point of mapped file.
+  MCR_NODISCARD const unsigned char* GetData() const noexcept { return this->mData; }
+
+  /// @brief Get byte size of mapped file.
+  MCR_NODISCARD TU64 GetSize() const noexcept { return this->mSize; }
+
+private:
+  /// @brief Unmap file and reset to empty state.
+  void Release() noexcept;
+
+  const unsigned char* mData = nullptr;
+  TU64 mSize = 0;
+#if defined(_WIN32) == true
+  void* mFileHandle     = nullptr;
+  void* mMappingHandle  = nullptr;
+#endif
+};
+
+} /// ::dy namespace
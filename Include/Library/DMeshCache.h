@@ -0,0 +1,111 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <string>
+#include "FGlobalType.h"
+#include "FMacro.h"
+#include "Library/DMappedFile.h"
+#include "Type/DAabb.h"
+#include "Type/FHelperIndexBuffer.h"
+#include "Type/FHelperMeshlet.h"
+#include "Type/FHelperQuantizeVertex.h"
+#include "Type/FHelperSimplify.h"
+
+namespace dy
+{
+
+/// @class DMeshCache
+/// @brief Memory mapped binary cache of mesh source file in upload format. \n
+/// Vertices and indices are stored as they are written to vertex and index buffer, with submeshes of index
+/// buffer layout and dequantization of vertices, so warm start only copies them into staging buffer.
+/// Cache is keyed by source path, modified time and content hash of source file,
+/// so cache is invalidated automatically when source file is changed.
+class DMeshCache final
+{
+public:
+  /// @brief Map cache file `iCachePath` and validate it against `iSourcePath`. \n
+  /// Cache is valid when format version, `iVertexStride` and source path are same,
+  /// and source file has same modified time and size or, if not, same content hash.
+  /// When only modified time is changed, new time is written to cache so source is not hashed on next load.
+  /// Payload is validated too, so indices added to vertex offset of their submesh, and meshlet, LOD and
+  /// submesh ranges of valid cache are in bounds.
+  DMeshCache(const std::string& iCachePath, const std::string& iSourcePath, TU32 iVertexStride);
+
+  /// @brief Check if cache is mapped and valid. Other getters must not be called when this is false.
+  MCR_NODISCARD bool IsValid() const noexcept { return this->mIsValid; }
+
+  /// @brief Get the start point of packed vertex array. Pointer is 16 bytes aligned.
+  MCR_NODISCARD const void* GetVertices() const noexcept;
+
+  /// @brief Get vertex count.
+  MCR_NODISCARD TU32 GetVertexCount() const noexcept;
+
+  /// @brief Get the start point of index array, of which each index is GetIndexSize() bytes.
+  MCR_NODISCARD const void* GetIndices() const noexcept;
+
+  /// @brief Get index count.
+  MCR_NODISCARD TU32 GetIndexCount() const noexcept;
+
+  /// @brief Get byte size of one index, which is sizeof(TU16) or sizeof(TU32).
+  MCR_NODISCARD TU32 GetIndexSize() const noexcept;
+
+  /// @brief Get the start point of submesh array of index buffer layout. Submeshes cover index array in order.
+  MCR_NODISCARD const DIndexSubmesh* GetSubmeshes() const noexcept;
+
+  /// @brief Get submesh count.
+  MCR_NODISCARD TU32 GetSubmeshCount() const noexcept;
+
+  /// @brief Get bounds of vertex positions.
+  MCR_NODISCARD DAabb GetBounds() const noexcept;
+
+  /// @brief Get dequantization of vertices, which is identity when vertices are not quantized.
+  MCR_NODISCARD DCompactVertexDequantization GetDequantization() const noexcept;
+
+  /// @brief Get the start point of meshlet array, which is built offline with index array.
+  MCR_NODISCARD const DMeshlet* GetMeshlets() const noexcept;
+
+  /// @brief Get the start point of meshlet bounds array. Pointer is 16 bytes aligned.
+  MCR_NODISCARD const DMeshletBounds* GetMeshletBounds() const noexcept;
+
+  /// @brief Get meshlet count.
+  MCR_NODISCARD TU32 GetMeshletCount() const noexcept;
+
+  /// @brief Get the start point of LOD array, of which index ranges are in index array.
+  MCR_NODISCARD const DMeshLod* GetLods() const noexcept;
+
+  /// @brief Get LOD count.
+  MCR_NODISCARD TU32 GetLodCount() const noexcept;
+
+  /// @brief Write cache of `iSourcePath` to `iCachePath`. \n
+  /// `iIndices` are `iIndexSize` bytes each, and are relative to vertex offset of submesh which has them.
+  /// File is written to temporary file and renamed, so mapped or half-written cache is never read.
+  /// Return false if source file is not exist or cache could not be written.
+  static bool Write(
+      const std::string& iCachePath, const std::string& iSourcePath,
+      const void* iVertices, TU32 iVertexStride, TU32 iVertexCount,
+      const void* iIndices, TU32 iIndexSize, TU32 iIndexCount,
+      const DIndexSubmesh* iSubmeshes, TU32 iSubmeshCount,
+      const DAabb& iBounds, const DCompactVertexDequantization& iDequantization,
+      const DMeshlet* iMeshlets, const DMeshletBounds* iMeshletBounds, TU32 iMeshletCount,
+      const DMeshLod* iLods, TU32 iLodCount);
+
+  /// @brief Get default cache path of given source path.
+  MCR_NODISCARD static std::string GetCachePath(const std::string& iSourcePath);
+
+private:
+  DMappedFile mFile;
+  bool mIsValid = false;
+};
+
+} /// ::dy namespace
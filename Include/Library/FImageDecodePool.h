@@ -0,0 +1,90 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "FGlobalType.h"
+#include "FMacro.h"
+#include "Library/DImageBuffer.h"
+
+namespace dy
+{
+
+/// @struct DImageDecodeRequest
+/// @brief Image file to be decoded by FImageDecodePool and its options.
+struct DImageDecodeRequest final
+{
+  std::string mImagePath;
+  /// Flip rows to bottom-up order, same to default of DDyImageBinaryDataBuffer.
+  bool        mIsFlipVertically = true;
+};
+
+/// @class FImageDecodePool
+/// @brief Worker threads which decode images of queued requests in order they are queued. \n
+/// Each request has its own future, so caller waits only for images it needs next.
+/// Failed image is returned as buffer which is not created properly, not as exception.
+class FImageDecodePool final
+{
+public:
+  /// @brief Create `iThreadCount` workers. 0 is count of hardware threads.
+  explicit FImageDecodePool(TU32 iThreadCount = 0);
+  /// @brief Decode queued requests and join workers.
+  ~FImageDecodePool();
+
+  FImageDecodePool(const FImageDecodePool&)            = delete;
+  FImageDecodePool& operator=(const FImageDecodePool&) = delete;
+
+  /// @brief Queue image of `iRequest` to be decoded.
+  MCR_NODISCARD std::future<DDyImageBinaryDataBuffer> Decode(const DImageDecodeRequest& iRequest);
+  /// @brief Queue images of `iRequests` at once. Futures are returned in order of requests.
+  MCR_NODISCARD std::vector<std::future<DDyImageBinaryDataBuffer>> Decode(const std::vector<DImageDecodeRequest>& iRequests);
+  /// @brief Queue image of `iRequest` to be decoded into `outPixels` of `iSize` bytes by DecodeImageInto.
+  /// `outPixels` must be valid until future is ready. Future has result of DecodeImageInto.
+  MCR_NODISCARD std::future<bool> DecodeInto(const DImageDecodeRequest& iRequest, void* outPixels, std::size_t iSize);
+
+  /// @brief Get count of worker threads.
+  MCR_NODISCARD TU32 GetThreadCount() const noexcept { return static_cast<TU32>(this->mWorkers.size()); }
+
+private:
+  /// @brief Push `iTask` to queue and return future of its result. Mutex must be locked.
+  template <typename TResult, typename TFunctor>
+  std::future<TResult> PushTask(TFunctor&& iTask)
+  {
+    // std::function must be copyable, so task is shared.
+    auto task = std::make_shared<std::packaged_task<TResult()>>(std::forward<TFunctor>(iTask));
+    auto future = task->get_future();
+    this->mTasks.emplace_back([task] { (*task)(); });
+    return future;
+  }
+
+  /// @brief Pop and run tasks until pool is destroyed and queue is empty.
+  void RunWorker();
+
+  std::vector<std::thread>          mWorkers;
+  std::deque<std::function<void()>> mTasks;
+  std::mutex                        mMutex;
+  std::condition_variable           mTaskCondition;
+  bool                              mIsStopping = false;
+};
+
+} /// ::dy namespace
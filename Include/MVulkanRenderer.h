@@ -12,10 +12,12 @@
 /// SOFTWARE.
 ///
 
+#include <functional>
 #include "IHelperSingleton.h"
 #include "ASystemInclude.h"
 #include "DQueueFamilyIndices.h"
 #include "DVkSwapChainSupportDetails.h"
+#include "Type/DMeshRegistry.h"
 
 class MVulkanRenderer final : public IHelperSingleton<MVulkanRenderer>
 {
@@ -230,13 +232,19 @@ private:
   /// One of the drawing commands involveds binding the right `VkFramebuffer`, so we actually
   /// have to record a command buffer for every image in the swap chain once again.
   void CreateCommandBuffers();
+  /// @brief Record render pass and draws of live meshes into command buffer of swap chain image `iImageIndex`.
+  /// Command buffer must not be pending, so it is called after fence of image is waited.
+  void RecordCommandBuffer(TU32 iImageIndex);
 
   /// @brief Create default semaphores to be used when rendering and synchornize between
   /// rendering queue and present queue of default (first) framebuffer & swap chain.
   /// Created semaphores must be destroyed explicitly.
   void CreateDefaultSemaphores();
 
-  /// @brief Create texture image.
+  /// @brief Create staging buffer of texture, whose size was read before. Return mapped memory of staging buffer,
+  /// which texture or its CPU mip chain is written into before CreateTextureImage.
+  MCR_NODISCARD void* CreateTextureStagingBuffer();
+  /// @brief Create texture image from staging buffer of CreateTextureStagingBuffer.
   ///
   /// We've seen before, with the swap chain images and the framebuffer, that images are accessed
   /// through image views rather than directly.
@@ -274,18 +282,40 @@ private:
   ///
   /// It should be noted that it's uncommon in practice to generate the mipmap levels at runtime.
   /// Usually they are pregenerated and stored in the texture file.
+  ///
+  /// When IsMipmapComputeSupported is true, whole chain is made by GenerateMipmapsWithCompute instead,
+  /// so iImage must also have VK_IMAGE_USAGE_STORAGE_BIT usage. Format which can not be blitted always
+  /// uses compute path, and throws only when compute path is not supported either.
   void GenerateMipmaps(
       VkImage iImage, VkFormat iPreferredFormat, 
       TU32 iWidth, TU32 iHeight, TU32 iRequiredMipLevel);
+  /// @brief Check iFormat image of optimal tiling supports linear filtering of `vkCmdBlitImage`.
+  MCR_NODISCARD bool IsMipmapBlitSupported(VkFormat iFormat);
+  /// @brief Check mipmaps of iFormat image can be made by one compute dispatch of `mipmap.comp`.
+  /// Format must have variant of `mipmap.comp` and be storage image of optimal tiling,
+  /// and device must index storage image array dynamically.
+  MCR_NODISCARD bool IsMipmapComputeSupported(VkFormat iFormat, TU32 iRequiredMipLevel);
+  /// @brief Create mipmaps by one `vkCmdBlitImage` per level, with barriers between levels.
+  void GenerateMipmapsWithBlit(
+      VkImage iImage, TU32 iWidth, TU32 iHeight, TU32 iRequiredMipLevel);
+  /// @brief Create mipmaps by one dispatch of single-pass downsampler `mipmap.comp`,
+  /// which writes every level as storage image. Level 0 must be VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL.
+  void GenerateMipmapsWithCompute(
+      VkImage iImage, VkFormat iFormat, TU32 iWidth, TU32 iHeight, TU32 iRequiredMipLevel);
+  /// @brief Print GPU time of GenerateMipmapsWithBlit and GenerateMipmapsWithCompute, each of which makes
+  /// chain of new image from level 0 of iStagingBuffer. Path which iFormat does not support is skipped.
+  void CompareMipmapGeneration(
+      VkBuffer iStagingBuffer, VkFormat iFormat, TU32 iWidth, TU32 iHeight, TU32 iRequiredMipLevel);
 
   /// @brief Create texture image view for accessing texture image.
   void CreateTextureImageView();
-  /// @brief Create image view with image and given format.
+  /// @brief Create image view with image and given format, of iRequireMipLevel levels from iBaseMipLevel.
   MCR_NODISCARD VkImageView CreateImageView(    
       VkImage iImage, 
       VkFormat iFormat, 
       VkImageAspectFlagBits iAspectMaskFlag,
-      TU32 iRequireMipLevel);
+      TU32 iRequireMipLevel,
+      TU32 iBaseMipLevel = 0);
 
   /// @brief Create samplers for texture to access following special way,
   /// such as GL_REPEAT, Bilinear filtering, Anisotroic, etc...
@@ -299,26 +329,34 @@ private:
   /// And we can also determine how to read outside texel using `Addressing mode`.
   void CreateTextureSampler();
 
-  /// @brief Load model.
+  /// @brief Load model into CPU memory in upload format of mesh buffer, from cache when it is valid.
+  /// It does not use Vulkan, so it is called on worker thread while device is created.
   void LoadModel(const std::string& iModelPath);
-  /// @brief Create vertex buffers. 
+  /// @brief Create one device local buffer which has vertex and index regions of every mesh.
   ///
   /// Buffers in Vulkan (not builtin) are storing arbitary (important!) data that can be
   /// interpreted by the graphics card and descriptor specification freedomly.
   /// They can be used store vertex data, but they can also be used for many other purpose.
   /// But, unlike builtin buffer, customized buffer do not automatically allocate memory themselves.
-  void CreateVertexBuffer();
-  /// @brief Create indice buffers.
   ///
-  /// Actually, vertex and indices should be in one VkBuffer as written in Vulkan memory management link below.
+  /// Vertex and indices of meshes are in one VkBuffer as written in Vulkan memory management link below.
   /// This is cache friendly, and use offsets in commands like `vkCmdBindVertexBuffers`.
-  /// It is even possible to reuse the same chunk of memory for multiple resources if they are not
-  /// used during the same render operations. (but be careful of operation will be held asynchronously.)
-  /// 
-  /// Replace other resource to VkBuffer that are used by another resource is Aliasing.
-  /// And vulkan functions have explicit flags to specify that you want to do Aliasing.
+  /// Ranges of meshes are sub-allocated by sMeshRegistry, so buffer is bound once for every draw of frame.
   /// @link https://developer.nvidia.com/vulkan-memory-management
-  void CreateIndiceBuffer();
+  void CreateMeshBuffer();
+  /// @brief Add vertices and indices of loaded model, which are in upload format, to mesh buffer.
+  void CreateModelMesh();
+  /// @brief Allocate ranges of mesh in mesh buffer and upload them through staging buffer. \n
+  /// `iWriteMesh` writes `iVertexCount` vertices and `iIndexCount` indices of `iIndexSize` bytes
+  /// into given mapped staging memory. Mesh is drawn whole from next frame, except model which is drawn by its LOD.
+  /// Throw if mesh buffer has no free range that fits.
+  MCR_NODISCARD dy::DMeshHandle AddMesh(
+      TU32 iVertexCount, TU32 iIndexCount, TU32 iIndexSize,
+      const std::function<void(void* outVertices, void* outIndices)>& iWriteMesh);
+  /// @brief Remove mesh from mesh buffer. \n
+  /// Mesh is not drawn from next frame, and command buffers recorded with it are recorded again before submit.
+  /// Its ranges are freed in DrawFrame after frames in flight which may draw it are finished.
+  void RemoveMesh(const dy::DMeshHandle& iHandle);
   /// @brief Create proper uniform buffer object buffers.
   /// 
   /// We're going to copy new data to the uniform buffer EVERY FRAME, so it doesn't really make any
@@ -342,13 +380,14 @@ private:
       VkDeviceSize iSize, VkBufferUsageFlags iUsage, 
       VkMemoryAllocateFlags iMemoryAllocationFlags,
       VkBuffer& outBuffer, VkDeviceMemory& outBufferMemory);
-  /// @brief Copy SRC_BIT source buffer to DST_BIT buffer with inSize from offset 0.
+  /// @brief Copy regions of SRC_BIT source buffer to DST_BIT buffer. Empty regions are skipped.
   /// Memory transfer operations are executed usig command buffers, like a drawing commands.
   /// So, we have to allocate command buffer first, 
-  void CopyBuffer(VkBuffer inSourceBuffer, VkDeviceSize inSize, VkBuffer outDestBuffer);
+  void CopyBuffer(VkBuffer inSourceBuffer, const std::vector<VkBufferCopy>& inRegions, VkBuffer outDestBuffer);
   /// @brief Copy buffer to image. Before calling this function, 
   /// image must be transited to appropriate layout.
-  void CopyBufferToImage(VkBuffer iBuffer, VkImage iImage, TU32 iWidth, TU32 iHeight);
+  /// Buffer has `iMipLevelCount` RGBA8 levels packed tightly, same to dy::GenerateMipChain.
+  void CopyBufferToImage(VkBuffer iBuffer, VkImage iImage, TU32 iWidth, TU32 iHeight, TU32 iMipLevelCount = 1);
   /// @brief
   MCR_NODISCARD VkCommandBuffer BeginSingleTimeCommands();
   /// @brief
@@ -429,6 +468,8 @@ public:
   std::vector<VkSemaphore>  mSemaphoreRenderFinished;
   /// @brief GPU-GPU synchronization.
   std::vector<VkFence>      mFencesInFlight;
+  /// @brief Fence of frame which last submitted command buffer of each swap chain image.
+  std::vector<VkFence>      mImagesInFlight;
   /// @brief Defines how many frames should be processed concurrently.
   static constexpr TI32     kMaxFramesInFlight = 2;
   /// @brief Defines frame index for managing vulkan semaphores.
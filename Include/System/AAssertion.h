@@ -18,7 +18,10 @@
 #include <string>
 
 #include <fmt/format.h>
-#include "ASystemInclude.h"
+
+#if defined(_WIN32) == true
+#include <Windows.h>
+#endif
 
 namespace sh
 {
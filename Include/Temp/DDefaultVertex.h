@@ -15,6 +15,7 @@
 #include <vector>
 #include "Type/DVector3.h"
 #include "Type/DVector2.h"
+#include "Type/FHelperHash.h"
 #include "ASystemInclude.h"
 
 namespace dy
@@ -40,6 +41,9 @@ struct DDefaultVertex final
   }
 };
 
+// Hashed and compared by object representation in deduplication, so must not have padding.
+static_assert(sizeof(DDefaultVertex) == sizeof(float) * 8, "DDefaultVertex must not have padding.");
+
 } /// ::dy namespace
 
 namespace std
@@ -48,9 +52,7 @@ namespace std
   {
     size_t operator()(const dy::DDefaultVertex& vertex) const 
     {
-      return ((hash<dy::DVector3>()(vertex.mPosition) 
-            ^ (hash<dy::DVector3>()(vertex.mBaseColor) << 1)) >> 1)
-        ^ (hash<dy::DVector2>()(vertex.mTextureUv0) << 1);
+      return static_cast<size_t>(dy::HashObject(vertex));
     }
   };
 }
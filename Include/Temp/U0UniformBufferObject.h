@@ -12,18 +12,24 @@
 /// SOFTWARE.
 ///
 
+#include "Type/DMatrix3x4.h"
 #include "Type/DMatrix4.h"
+#include "Type/DVector4.h"
 
 namespace dy
 {
 
 /// The specification.
 /// https://www.khronos.org/registry/vulkan/specs/1.1-extensions/html/chap14.html#interfaces-resources-layout
+/// Model matrix is always affine, so it is uploaded as 48-byte rows and read as `mat3x4` in shader.
+/// `uTextureUvTransform` is (scale.x, scale.y, offset.x, offset.y) of texture coordinate.
+/// Both of them include dequantization of DCompactVertex, and are identity part for DDefaultVertex.
 struct UUniformBufferObject final
 {
-	alignas(16) DMatrix4 uModel;
+	alignas(16) DMatrix3x4 uModel;
 	alignas(16) DMatrix4 uView;
 	alignas(16) DMatrix4 uProj;
+	alignas(16) DVector4 uTextureUvTransform;
 };
 
 } /// ::dy namespace
\ No newline at end of file
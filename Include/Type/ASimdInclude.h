@@ -0,0 +1,63 @@
+#ifndef GUARD_DY_HELPER_TYPE_SIMD_INCLUDE_H
+#define GUARD_DY_HELPER_TYPE_SIMD_INCLUDE_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <immintrin.h>
+#include <type_traits>
+
+//!
+//! SSE2 is baseline of x64, so SSE2 path is always compiled.
+//! AVX path is compiled when compiler targets AVX. (/arch:AVX, /arch:AVX2 or -mavx)
+//!
+
+#if defined(__AVX__)
+#define MDY_SIMD_AVX
+#endif
+
+//!
+//! If you want to use fused multiply-add instructions, remove comment "//" to activate macro option.
+//! FMA rounds once per multiply-add, so results are not bit-exact to glm anymore.
+//!
+
+//#define MDY_FLAG_USING_FMA
+
+#if defined(MDY_FLAG_USING_FMA)
+  #if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+  #define MDY_SIMD_FMA
+  #endif
+#endif
+
+//!
+//! MDY_IS_CONSTANT_EVALUATED() is true only in constant evaluation, like C++20 std::is_constant_evaluated.
+//! Constexpr math functions take scalar path in constant evaluation, and SIMD path in runtime.
+//! GCC 9+, Clang 9+ and MSVC 19.25+ provide builtin in C++17 mode.
+//! Otherwise this is always false, so constexpr math functions which use SIMD work only in runtime.
+//!
+
+#if defined(__cpp_lib_is_constant_evaluated)
+  #define MDY_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__has_builtin)
+  #if __has_builtin(__builtin_is_constant_evaluated)
+  #define MDY_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+  #endif
+#endif
+#if !defined(MDY_IS_CONSTANT_EVALUATED)
+  #if (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+  #define MDY_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+  #else
+  #define MDY_IS_CONSTANT_EVALUATED() false
+  #endif
+#endif
+
+#endif /// GUARD_DY_HELPER_TYPE_SIMD_INCLUDE_H
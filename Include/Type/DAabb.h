@@ -0,0 +1,42 @@
+#ifndef GUARD_DY_HELPER_TYPE_AABB_H
+#define GUARD_DY_HELPER_TYPE_AABB_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include "DVector3.h"
+
+namespace dy
+{
+
+/// @struct DAabb
+/// @brief Axis-aligned bounding box. Packed as 24 bytes of (min, max).
+struct DAabb final
+{
+  DVector3 mMin = {};
+  DVector3 mMax = {};
+
+  DAabb() = default;
+  constexpr DAabb(const DVector3& iMin, const DVector3& iMax) noexcept : mMin{iMin}, mMax{iMax} {};
+
+  /// @brief Get center point of box.
+  [[nodiscard]] constexpr DVector3 GetCenter() const noexcept { return (this->mMin + this->mMax) * 0.5f; }
+
+  /// @brief Get half size of box.
+  [[nodiscard]] constexpr DVector3 GetExtent() const noexcept { return (this->mMax - this->mMin) * 0.5f; }
+};
+
+static_assert(sizeof(DAabb) == 24, "Test failed");
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_AABB_H
@@ -0,0 +1,76 @@
+#ifndef GUARD_DY_HELPER_TYPE_FRUSTUM_H
+#define GUARD_DY_HELPER_TYPE_FRUSTUM_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <array>
+#include <cstddef>
+#include "FGlobalType.h"
+#include "Type/DAabb.h"
+#include "Type/DMatrix4.h"
+#include "Type/DSphere.h"
+
+namespace dy
+{
+
+/// @enum EDepthRange
+/// @brief Clip space depth range of projection matrix.
+enum class EDepthRange
+{
+  /// OpenGL and glm default, -w <= z <= w.
+  MinusOneToOne,
+  /// Vulkan and GLM_FORCE_DEPTH_ZERO_TO_ONE, 0 <= z <= w.
+  ZeroToOne,
+};
+
+/// @class DFrustum
+/// @brief View frustum of 6 planes extracted from view-projection matrix. \n
+/// Each plane is (nx, ny, nz, d) with normalized inward normal, so point p is inside when n.p + d >= 0.
+class DFrustum final
+{
+public:
+  /// @enum EPlane
+  enum EPlane : std::size_t { Left = 0, Right, Bottom, Top, Near, Far, Count };
+
+  DFrustum() = default;
+
+  /// @brief Extract planes from `iViewProjection` = projection * view (Gribb-Hartmann method).
+  explicit DFrustum(const DMatrix4& iViewProjection, EDepthRange iDepthRange = EDepthRange::MinusOneToOne) noexcept;
+
+  /// @brief Get plane as (nx, ny, nz, d).
+  [[nodiscard]] const DVector4& GetPlane(EPlane iPlane) const noexcept { return this->mPlanes[iPlane]; }
+
+  /// @brief Check sphere is inside or intersects frustum.
+  [[nodiscard]] bool IsVisible(const DSphere& iSphere) const noexcept;
+
+  /// @brief Check box is inside or intersects frustum. \n
+  /// Box may be reported visible when it is outside near frustum corner, same as other plane tests.
+  [[nodiscard]] bool IsVisible(const DAabb& iBox) const noexcept;
+
+  /// @brief Test `iCount` spheres and write indices of visible spheres to `outVisibleIndices` in order. \n
+  /// 4 (SSE) or 8 (AVX) spheres are tested per iteration.
+  /// `outVisibleIndices` must have room for `iCount` indices. Return visible count.
+  std::size_t CullSpheres(const DSphere* iSpheres, std::size_t iCount, TU32* outVisibleIndices) const noexcept;
+
+  /// @brief Test `iCount` boxes and write indices of visible boxes to `outVisibleIndices` in order. \n
+  /// 4 (SSE) or 8 (AVX) boxes are tested per iteration.
+  /// `outVisibleIndices` must have room for `iCount` indices. Return visible count.
+  std::size_t CullAabbs(const DAabb* iBoxes, std::size_t iCount, TU32* outVisibleIndices) const noexcept;
+
+private:
+  std::array<DVector4, EPlane::Count> mPlanes;
+};
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_FRUSTUM_H
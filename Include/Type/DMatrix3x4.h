@@ -0,0 +1,121 @@
+#ifndef GUARD_DY_HELPER_TYPE_MATRIX3X4_H
+#define GUARD_DY_HELPER_TYPE_MATRIX3X4_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <array>
+#include "DMatrix4.h"
+#include "DQuaternion.h"
+#include "DVector3.h"
+#include "DVector4.h"
+
+namespace dy
+{
+
+/// @class DMatrix3x4
+/// @brief Affine matrix stored as 3 rows of (m0, m1, m2, translation) in 48 bytes. \n
+/// Last row is always (0, 0, 0, 1) and not stored. 
+/// Memory layout is same to GLSL std140 `mat3x4`, so shader transforms point as `vec4(p, 1.0) * m`.
+class DMatrix3x4 final
+{
+public:
+  DMatrix3x4() = default;
+
+  /// @brief Create matrix from row-major elements, same order to DMatrix4 element constructor.
+  constexpr DMatrix3x4(
+      const float _00, const float _01, const float _02, const float _03,
+      const float _10, const float _11, const float _12, const float _13,
+      const float _20, const float _21, const float _22, const float _23) noexcept :
+      mRows{DVector4{_00, _01, _02, _03},
+            DVector4{_10, _11, _12, _13},
+            DVector4{_20, _21, _22, _23}} {}
+
+  constexpr DMatrix3x4(const DVector4& iRow0, const DVector4& iRow1, const DVector4& iRow2) noexcept :
+      mRows{iRow0, iRow1, iRow2} {}
+
+  /// @brief Create from affine `iMatrix`. Last row of `iMatrix` is discarded.
+  explicit DMatrix3x4(const DMatrix4& iMatrix) noexcept;
+
+  /// @brief Convert to DMatrix4 which has (0, 0, 0, 1) last row.
+  explicit operator DMatrix4() const noexcept;
+
+  /// @brief Get row `iRow`. Not column like DMatrix4::operator[].
+  [[nodiscard]] constexpr const DVector4& GetRow(std::size_t iRow) const noexcept
+  {
+    if (MDY_IS_CONSTANT_EVALUATED() == false) { MDY_ASSERT(iRow <= 2); }
+    return this->mRows[iRow];
+  }
+
+  /// @brief Get translation, which is last column.
+  [[nodiscard]] constexpr DVector3 GetTranslation() const noexcept
+  {
+    return DVector3{this->mRows[0].W, this->mRows[1].W, this->mRows[2].W};
+  }
+
+  [[nodiscard]] float* Data() noexcept { return this->mRows[0].Data(); }
+  [[nodiscard]] const float* Data() const noexcept { return this->mRows[0].Data(); }
+
+  /// @brief Affine matrix multiplication, this * rhs. \n
+  /// Each result row is linear combination of rhs rows, so 3 rows are computed instead of 4 columns.
+  /// operator* is not provided, because DMatrix4::operator* is element-wise multiplication.
+  [[nodiscard]] DMatrix3x4 Multiply(const DMatrix3x4& rhs) const noexcept;
+
+  /// @brief Transform point, this * (p, 1).
+  [[nodiscard]] DVector3 MultiplyPoint(const DVector3& iPoint) const noexcept;
+
+  /// @brief Transform direction, this * (d, 0). Translation is not applied.
+  [[nodiscard]] DVector3 MultiplyDirection(const DVector3& iDirection) const noexcept;
+
+  /// @brief Inverse of affine matrix. Upper 3x3 is inversed with cross products, so shear is allowed. \n
+  /// If upper 3x3 is singular, result has infinite or NaN values like DMatrix4::Inverse.
+  [[nodiscard]] DMatrix3x4 Inverse() const noexcept;
+
+  /// @brief Decompose matrix which has no shear into translation, rotation and scale, so T * R * S is this. \n
+  /// If upper 3x3 has negative determinant, X scale becomes negative.
+  /// Return false when any scale is zero. Then `outRotation` is identity.
+  bool Decompose(DVector3& outTranslation, DQuaternion& outRotation, DVector3& outScale) const noexcept;
+
+  /// @brief Get identity matrix.
+  static constexpr DMatrix3x4 Identity() noexcept
+  {
+    return DMatrix3x4{
+        1, 0, 0, 0,
+        0, 1, 0, 0,
+        0, 0, 1, 0};
+  }
+
+  /// @brief Create T * R * S matrix from position, normalized rotation and scale. \n
+  /// Same to DMatrix4 which is made by ComposeTransforms.
+  [[nodiscard]] static DMatrix3x4 CreateWithTransform(
+      const DVector3& iPosition, const DQuaternion& iRotation, const DVector3& iScale) noexcept;
+
+  friend bool operator==(const DMatrix3x4& lhs, const DMatrix3x4& rhs) noexcept
+  {
+    return lhs.mRows[0] == rhs.mRows[0] && lhs.mRows[1] == rhs.mRows[1] && lhs.mRows[2] == rhs.mRows[2];
+  }
+
+  friend bool operator!=(const DMatrix3x4& lhs, const DMatrix3x4& rhs) noexcept
+  {
+    return !(lhs == rhs);
+  }
+
+private:
+  /// Row major
+  std::array<DVector4, 3> mRows;
+};
+
+static_assert(sizeof(DMatrix3x4) == 48, "Test failed");
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_MATRIX3X4_H
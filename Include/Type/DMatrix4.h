@@ -16,6 +16,7 @@
 #include <array>
 #include "DVector4.h"
 #include "DVector3.h"
+#include "FHelperSimd.h"
 
 #include "System/AUndef.h"
 
@@ -36,7 +37,7 @@ public:
   DMatrix4& operator=(DMatrix4&& value) = default;
   DMatrix4(std::initializer_list<float>&) = delete;
 
-  DMatrix4(const float _00, const float _01, const float _02, const float _03,
+  constexpr DMatrix4(const float _00, const float _01, const float _02, const float _03,
            const float _10, const float _11, const float _12, const float _13,
            const float _20, const float _21, const float _22, const float _23,
            const float _30, const float _31, const float _32, const float _33) :
@@ -45,9 +46,10 @@ public:
                    DVector4{_02, _12, _22, _32},
                    DVector4{_03, _13, _23, _33}} {}
 
-  DMatrix4(
+  constexpr DMatrix4(
     const DVector4& column1, const DVector4& column2,
-    const DVector4& column3, const DVector4& column4);
+    const DVector4& column3, const DVector4& column4) :
+      mMatrixValue{column1, column2, column3, column4} {}
 
   DMatrix4(const glm::mat4& glmMatrix) noexcept;
 
@@ -55,15 +57,15 @@ public:
 
   explicit operator glm::mat4() const noexcept;
 
-  DVector4& operator[](std::size_t index) noexcept
+  constexpr DVector4& operator[](std::size_t index) noexcept
   {
-    MDY_ASSERT(index <= 3);
+    if (MDY_IS_CONSTANT_EVALUATED() == false) { MDY_ASSERT(index <= 3); }
     return mMatrixValue[index];
   }
 
-  const DVector4& operator[](std::size_t index) const noexcept
+  constexpr const DVector4& operator[](std::size_t index) const noexcept
   {
-    MDY_ASSERT(index <= 3);
+    if (MDY_IS_CONSTANT_EVALUATED() == false) { MDY_ASSERT(index <= 3); }
     return mMatrixValue[index];
   }
 
@@ -88,29 +90,94 @@ public:
   friend bool operator!=(const DMatrix4& lhs, const DMatrix4& rhs) noexcept;
 
   /// @brief
-  DMatrix4 Transpose() const noexcept;
+  constexpr DMatrix4 Transpose() const noexcept
+  {
+    const auto& m = this->mMatrixValue;
+    return DMatrix4{
+        m[0][0], m[0][1], m[0][2], m[0][3],
+        m[1][0], m[1][1], m[1][2], m[1][3],
+        m[2][0], m[2][1], m[2][2], m[2][3],
+        m[3][0], m[3][1], m[3][2], m[3][3]};
+  }
 
-  /// @brief P = this * V = rhs as mathmethical PV matrix multiplication.
-  DMatrix4 Multiply(const DMatrix4& rhs) const noexcept;
+  /// @brief P = this * V = rhs as mathmethical PV matrix multiplication. \n
+  /// Each result column is linear combination of this columns, so broadcasted and
+  /// accumulated with SSE (AVX does two columns at once). Result is bit-exact to glm::mat4.
+  /// Scalar path with same summation order is used in constant evaluation.
+  constexpr DMatrix4 Multiply(const DMatrix4& rhs) const noexcept
+  {
+    if (MDY_IS_CONSTANT_EVALUATED() == true)
+    {
+      return DMatrix4{
+          this->MultiplyVectorSequential(rhs.mMatrixValue[0]), this->MultiplyVectorSequential(rhs.mMatrixValue[1]),
+          this->MultiplyVectorSequential(rhs.mMatrixValue[2]), this->MultiplyVectorSequential(rhs.mMatrixValue[3])};
+    }
+    return this->MultiplySimd(rhs);
+  }
 
-  /// @brief P = this, v = rhs, r = result so r = P(v^T)
-  DVector4 MultiplyVector(const DVector4& rhs) const noexcept;
+  /// @brief P = this, v = rhs, r = result so r = P(v^T) \n
+  /// Result is bit-exact to glm::mat4 * glm::vec4.
+  constexpr DVector4 MultiplyVector(const DVector4& rhs) const noexcept
+  {
+    if (MDY_IS_CONSTANT_EVALUATED() == true)
+    {
+      // glm sums (c0x + c1y) + (c2z + c3w) pairwise in mat4 * vec4.
+      const auto& c = this->mMatrixValue;
+      return (c[0] * rhs.X + c[1] * rhs.Y) + (c[2] * rhs.Z + c[3] * rhs.W);
+    }
+    return this->MultiplyVectorSimd(rhs);
+  }
 
-  /// @brief Inverse.
+  /// @brief Inverse of general 4x4 matrix using 2x2 block adjugates with SSE. \n
+  /// If matrix is singular, result has infinite or NaN values like glm::inverse.
   DMatrix4 Inverse() const;
 
+  /// @brief Inverse of affine matrix which has rotation, (non-uniform) scale and translation. \n
+  /// Upper 3x3 is inversed as scaled transpose, so matrix must not have shear or projection.
+  /// Use `Inverse` for general matrix.
+  DMatrix4 InverseAffine() const noexcept;
+
+  /// @brief Inverse `iCount` matrices of `iMatrices` into `outMatrices` using `Inverse`. \n
+  /// `iMatrices` and `outMatrices` may point to same array.
+  static void InverseBatch(const DMatrix4* iMatrices, std::size_t iCount, DMatrix4* outMatrices);
+
+  /// @brief Inverse `iCount` affine matrices of `iMatrices` into `outMatrices` using `InverseAffine`. \n
+  /// `iMatrices` and `outMatrices` may point to same array.
+  static void InverseAffineBatch(const DMatrix4* iMatrices, std::size_t iCount, DMatrix4* outMatrices) noexcept;
+
   /// @brief Get identity matrix. \n
   /// [ 1 0 0 0 ] \n
   /// [ 0 1 0 0 ] \n
   /// [ 0 0 1 0 ] \n
   /// [ 0 0 0 1 ] \n
-  static DMatrix4 Identity() noexcept;
+  static constexpr DMatrix4 Identity() noexcept
+  {
+    return DMatrix4{
+        1, 0, 0, 0,
+        0, 1, 0, 0,
+        0, 0, 1, 0,
+        0, 0, 0, 1};
+  }
 
   /// @brief 
-  static DMatrix4 CreateWithScale(const DVector3& scaleVector);
+  static constexpr DMatrix4 CreateWithScale(const DVector3& scaleVector) noexcept
+  {
+    return DMatrix4{
+        scaleVector.X, 0, 0, 0,
+        0, scaleVector.Y, 0, 0,
+        0, 0, scaleVector.Z, 0,
+        0, 0, 0,             1};
+  }
 
   /// @brief
-  static DMatrix4 CreateWithTranslation(const DVector3& translationPoint);
+  static constexpr DMatrix4 CreateWithTranslation(const DVector3& translationPoint) noexcept
+  {
+    return DMatrix4{
+        1, 0, 0, translationPoint.X,
+        0, 1, 0, translationPoint.Y,
+        0, 0, 1, translationPoint.Z,
+        0, 0, 0, 1};
+  }
 
   /// @brief Get orthographic projection of OpenGL. \n
   /// [ 2/(r-l)    0       0    -(r+l)/(r-l) ] \n
@@ -121,14 +188,32 @@ public:
 
   /// @brief Scale matrix.
   DMatrix4& Scale(const DVector3& iScaleFactor);
-  /// @brief Rotate matrix.
+  /// @brief Rotate matrix with euler angle (degree), this * R where R is from DQuaternion.
   DMatrix4& Rotate(const DVector3& iRotationDegreeAngle);
   /// @brief Translate matrix.
   DMatrix4& Translate(const DVector3& iPosition);
 
 private:
-  /// Identity matrix constructor
-  explicit DMatrix4(bool);
+  /// @brief Runtime SSE/AVX path of `Multiply`.
+  DMatrix4 MultiplySimd(const DMatrix4& rhs) const noexcept;
+  /// @brief Runtime SSE path of `MultiplyVector`. Defined in header to be inlined into callers,
+  /// because call overhead is larger than 4 multiply-adds.
+  DVector4 MultiplyVectorSimd(const DVector4& rhs) const noexcept
+  {
+    // glm sums (c0x + c1y) + (c2z + c3w) pairwise in mat4 * vec4, not sequentially.
+    using simd::Splat;
+    const auto& c = this->mMatrixValue;
+    const __m128 lower = simd::MulAdd(c[1].__Simd, Splat<1>(rhs.__Simd), _mm_mul_ps(c[0].__Simd, Splat<0>(rhs.__Simd)));
+    const __m128 upper = simd::MulAdd(c[3].__Simd, Splat<3>(rhs.__Simd), _mm_mul_ps(c[2].__Simd, Splat<2>(rhs.__Simd)));
+    return DVector4{_mm_add_ps(lower, upper)};
+  }
+
+  /// @brief r = ((c0x + c1y) + c2z) + c3w, which is summation order of glm mat4 * mat4 column.
+  constexpr DVector4 MultiplyVectorSequential(const DVector4& rhs) const noexcept
+  {
+    const auto& c = this->mMatrixValue;
+    return ((c[0] * rhs.X + c[1] * rhs.Y) + c[2] * rhs.Z) + c[3] * rhs.W;
+  }
 
   /// Column major
   std::array<DVector4, 4> mMatrixValue;
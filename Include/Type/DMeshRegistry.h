@@ -0,0 +1,149 @@
+#ifndef GUARD_DY_HELPER_TYPE_MESH_REGISTRY_H
+#define GUARD_DY_HELPER_TYPE_MESH_REGISTRY_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cstddef>
+#include <vector>
+#include "FGlobalType.h"
+
+//!
+//! Sub-allocation of many meshes into one vertex region and one index region of shared buffer.
+//! Vertex region is counted in vertices, so first vertex of mesh is `vertexOffset` of indexed draw.
+//! Index region is counted in 4-byte words, so 16-bit and 32-bit indices of meshes are placed in
+//! same region which is bound at one offset, and first index of mesh is word offset scaled by index size.
+//! Free ranges of each region are kept sorted by offset and coalesced with neighbours when mesh is removed,
+//! and new mesh takes first free range that fits.
+//!
+
+namespace dy
+{
+
+/// @struct DMeshHandle
+/// @brief Handle of mesh added to DMeshRegistry. \n
+/// Handle becomes stale when its mesh is removed, even if its slot is reused by other mesh.
+struct DMeshHandle final
+{
+  TU32 mSlot       = NumericalMax<TU32>;
+  TU32 mGeneration = 0;
+
+  /// @brief Check handle is returned by successful `DMeshRegistry::Add`.
+  [[nodiscard]] bool IsValid() const noexcept { return this->mSlot != NumericalMax<TU32>; }
+
+  friend constexpr bool operator==(const DMeshHandle& lhs, const DMeshHandle& rhs) noexcept
+  {
+    return lhs.mSlot == rhs.mSlot && lhs.mGeneration == rhs.mGeneration;
+  }
+  friend constexpr bool operator!=(const DMeshHandle& lhs, const DMeshHandle& rhs) noexcept
+  {
+    return (lhs == rhs) == false;
+  }
+};
+
+/// @struct DMeshAllocation
+/// @brief Vertex and index ranges of mesh in shared buffer.
+struct DMeshAllocation final
+{
+  TU32 mFirstVertex     = 0;
+  TU32 mVertexCount     = 0;
+  /// First 4-byte word of indices in index region.
+  TU32 mIndexWord       = 0;
+  TU32 mIndexWordCount  = 0;
+  TU32 mIndexCount      = 0;
+  /// Byte size of one index, which is 2 or 4.
+  TU32 mIndexSize       = 4;
+
+  /// @brief Get `firstIndex` of indexed draw when index region is bound with index type of this mesh.
+  [[nodiscard]] TU32 GetFirstIndex() const noexcept { return this->mIndexWord * 4 / this->mIndexSize; }
+};
+
+/// @class DMeshRegistry
+/// @brief Allocator of vertex and index ranges of meshes in one shared buffer. \n
+/// Registry only manages ranges, so caller writes vertices and indices into buffer by allocation of handle.
+class DMeshRegistry final
+{
+public:
+  /// @brief Create registry of `iVertexCapacity` vertices and `iIndexWordCapacity` 4-byte index words.
+  DMeshRegistry(TU32 iVertexCapacity, TU32 iIndexWordCapacity);
+
+  /// @brief Allocate ranges of `iVertexCount` vertices and `iIndexCount` indices of `iIndexSize` bytes. \n
+  /// Return invalid handle if `iIndexSize` is not 2 or 4, or either region has no free range that fits.
+  [[nodiscard]] DMeshHandle Add(TU32 iVertexCount, TU32 iIndexCount, TU32 iIndexSize);
+
+  /// @brief Free ranges of mesh of `iHandle`. Return false if handle is stale.
+  bool Remove(const DMeshHandle& iHandle);
+
+  /// @brief Get allocation of mesh of `iHandle`. Return nullptr if handle is stale.
+  [[nodiscard]] const DMeshAllocation* Get(const DMeshHandle& iHandle) const noexcept;
+
+  /// @brief Get count of meshes in registry.
+  [[nodiscard]] std::size_t GetMeshCount() const noexcept { return this->mMeshCount; }
+
+  /// @brief Get count of vertices allocated to meshes.
+  [[nodiscard]] TU32 GetUsedVertexCount() const noexcept { return this->mVertexRegion.mUsedCount; }
+  /// @brief Get count of 4-byte index words allocated to meshes.
+  [[nodiscard]] TU32 GetUsedIndexWordCount() const noexcept { return this->mIndexRegion.mUsedCount; }
+
+  /// @brief Get largest vertex count that can be added at once.
+  [[nodiscard]] TU32 GetLargestFreeVertexCount() const noexcept { return this->mVertexRegion.GetLargestFreeCount(); }
+  /// @brief Get largest count of 4-byte index words that can be added at once.
+  [[nodiscard]] TU32 GetLargestFreeIndexWordCount() const noexcept { return this->mIndexRegion.GetLargestFreeCount(); }
+
+  [[nodiscard]] TU32 GetVertexCapacity() const noexcept { return this->mVertexRegion.mCapacity; }
+  [[nodiscard]] TU32 GetIndexWordCapacity() const noexcept { return this->mIndexRegion.mCapacity; }
+
+private:
+  /// @struct DRange
+  struct DRange final
+  {
+    TU32 mOffset;
+    TU32 mCount;
+  };
+
+  /// @struct DRegion
+  /// @brief First-fit allocator of one region, whose free ranges are sorted by offset and never adjacent.
+  struct DRegion final
+  {
+    std::vector<DRange> mFreeRanges;
+    TU32 mCapacity  = 0;
+    TU32 mUsedCount = 0;
+
+    explicit DRegion(TU32 iCapacity);
+
+    /// @brief Take `iCount` items from first free range that fits, and write its offset to `outOffset`.
+    /// Return false if no free range fits. Zero count is always allocated at offset 0.
+    bool Allocate(TU32 iCount, TU32& outOffset);
+    /// @brief Return range to free ranges and coalesce it with neighbours.
+    void Free(TU32 iOffset, TU32 iCount);
+
+    [[nodiscard]] TU32 GetLargestFreeCount() const noexcept;
+  };
+
+  /// @struct DSlot
+  struct DSlot final
+  {
+    DMeshAllocation mAllocation;
+    TU32 mGeneration = 0;
+    bool mIsUsed     = false;
+  };
+
+  DRegion             mVertexRegion;
+  DRegion             mIndexRegion;
+  std::vector<DSlot>  mSlots;
+  std::vector<TU32>   mFreeSlots;
+  std::size_t         mMeshCount = 0;
+};
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_MESH_REGISTRY_H
@@ -0,0 +1,114 @@
+#ifndef GUARD_DY_HELPER_TYPE_QUATERNION_H
+#define GUARD_DY_HELPER_TYPE_QUATERNION_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <glm/gtc/quaternion.hpp>
+#include "ASimdInclude.h"
+#include "DMatrix4.h"
+#include "DVector3.h"
+
+namespace dy
+{
+
+/// @struct DQuaternion
+/// @brief Float type quaternion struct. Elements are stored as (X, Y, Z, W) in one __m128,
+/// and W is real part. Rotation convention is same to glm::quat.
+struct DQuaternion final
+{
+  union
+  {
+    __m128 __Simd;
+    struct { float X; float Y; float Z; float W; };
+  };
+
+  /// @brief Identity quaternion.
+  DQuaternion() noexcept : X{0}, Y{0}, Z{0}, W{1} {};
+  DQuaternion(const DQuaternion&) = default;
+  DQuaternion& operator=(const DQuaternion&) = default;
+
+  explicit DQuaternion(__m128 __iSimd) noexcept : __Simd{__iSimd} {};
+  DQuaternion(const float x, const float y, const float z, const float w) noexcept : X{x}, Y{y}, Z{z}, W{w} {};
+  DQuaternion(const glm::quat& value) noexcept : X{value.x}, Y{value.y}, Z{value.z}, W{value.w} {};
+
+  /// @brief Create quaternion from euler angle (degree) of X, Y and Z axis. \n
+  /// Same to glm::quat(glm::radians(eulerAngle)).
+  explicit DQuaternion(const DVector3& iEulerDegreeAngle) noexcept;
+
+  explicit operator glm::quat() const noexcept
+  {
+    return glm::quat{this->W, this->X, this->Y, this->Z};
+  }
+
+  [[nodiscard]] float* Data() noexcept { return &this->X; }
+  [[nodiscard]] const float* Data() const noexcept { return &this->X; }
+
+  /// @brief Hamilton product, this * rhs. Rotation `rhs` is applied first.
+  [[nodiscard]] DQuaternion Multiply(const DQuaternion& rhs) const noexcept;
+
+  friend DQuaternion operator*(const DQuaternion& lhs, const DQuaternion& rhs) noexcept
+  {
+    return lhs.Multiply(rhs);
+  }
+
+  DQuaternion& operator*=(const DQuaternion& rhs) noexcept
+  {
+    *this = this->Multiply(rhs);
+    return *this;
+  }
+
+  /// @brief Return squared length of this quaternion.
+  [[nodiscard]] float GetSquareLength() const noexcept;
+
+  /// @brief Return new normalized quaternion. Quaternion must not be zero.
+  [[nodiscard]] DQuaternion Normalize() const noexcept;
+
+  /// @brief Return conjugate, which is inverse rotation when quaternion is normalized.
+  [[nodiscard]] DQuaternion Conjugate() const noexcept;
+
+  /// @brief Rotate vector with this normalized quaternion.
+  [[nodiscard]] DVector3 RotateVector(const DVector3& iVector) const noexcept;
+
+  /// @brief Get rotation matrix of this normalized quaternion. Same to glm::mat4_cast.
+  [[nodiscard]] DMatrix4 GetRotationMatrix4x4() const noexcept;
+
+  /// @brief Dot product of two quaternions.
+  [[nodiscard]] static float Dot(const DQuaternion& lhs, const DQuaternion& rhs) noexcept;
+
+  /// @brief Normalized linear interpolation through shortest path. \n
+  /// Cheaper than `Slerp` but angular velocity is not constant.
+  [[nodiscard]] static DQuaternion Nlerp(const DQuaternion& iFrom, const DQuaternion& iTo, float iOffset) noexcept;
+
+  /// @brief Spherical linear interpolation through shortest path. \n
+  /// When two quaternions are nearly same, falls back to `Nlerp` to avoid division by sin(0).
+  [[nodiscard]] static DQuaternion Slerp(const DQuaternion& iFrom, const DQuaternion& iTo, float iOffset) noexcept;
+
+  /// @brief Create quaternion which rotates `iDegree` around normalized `iAxis`.
+  [[nodiscard]] static DQuaternion CreateWithAxisAngle(const DVector3& iAxis, float iDegree) noexcept;
+
+  friend bool operator==(const DQuaternion& lhs, const DQuaternion& rhs) noexcept
+  {
+    return _mm_movemask_ps(_mm_cmpeq_ps(lhs.__Simd, rhs.__Simd)) == 0xF;
+  }
+
+  friend bool operator!=(const DQuaternion& lhs, const DQuaternion& rhs) noexcept
+  {
+    return !(lhs == rhs);
+  }
+};
+
+static_assert(sizeof(DQuaternion) == 16, "Test failed");
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_QUATERNION_H
@@ -0,0 +1,36 @@
+#ifndef GUARD_DY_HELPER_TYPE_SPHERE_H
+#define GUARD_DY_HELPER_TYPE_SPHERE_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include "DVector3.h"
+
+namespace dy
+{
+
+/// @struct DSphere
+/// @brief Bounding sphere. Packed as 16 bytes, so 4 spheres can be transposed with one 4x4 transpose.
+struct DSphere final
+{
+  DVector3  mCenter = {};
+  float     mRadius = 0.0f;
+
+  DSphere() = default;
+  constexpr DSphere(const DVector3& iCenter, float iRadius) noexcept : mCenter{iCenter}, mRadius{iRadius} {};
+};
+
+static_assert(sizeof(DSphere) == 16, "Test failed");
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_SPHERE_H
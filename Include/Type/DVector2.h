@@ -14,6 +14,7 @@
 ///
 
 #include <array>
+#include <cmath>
 #include <stdexcept>
 #include <glm/glm.hpp>
 
@@ -32,14 +33,14 @@ struct DVector2 final
   };
 
   DVector2() = default;
-  DVector2(const float x, const float y) noexcept : X{x}, Y{y} {};
-  explicit DVector2(const float value) noexcept : X{value}, Y{value} {}
+  constexpr DVector2(const float x, const float y) noexcept : X{x}, Y{y} {};
+  constexpr explicit DVector2(const float value) noexcept : X{value}, Y{value} {}
 
-  DVector2(const DVector2& value) noexcept : X{value.X}, Y{value.Y} {}
-  DVector2(const glm::vec2& value) noexcept : X{value.x}, Y{value.y} {}
+  constexpr DVector2(const DVector2& value) noexcept = default;
+  constexpr DVector2(const glm::vec2& value) noexcept : X{value.x}, Y{value.y} {}
 
   DVector2& operator=(const DVector2& value) = default;
-  DVector2& operator=(const glm::vec2& value) noexcept
+  constexpr DVector2& operator=(const glm::vec2& value) noexcept
   {
     this->X = value.x;
     this->Y = value.y;
@@ -47,7 +48,7 @@ struct DVector2 final
   }
 
 
-  auto& operator[](std::size_t index)
+  constexpr auto& operator[](std::size_t index)
   {
     switch (index)
     {
@@ -57,7 +58,7 @@ struct DVector2 final
     }
   }
 
-  const auto& operator[](std::size_t index) const
+  constexpr const auto& operator[](std::size_t index) const
   {
     switch (index) {
     case 0: return this->X;
@@ -90,7 +91,7 @@ struct DVector2 final
   [[nodiscard]] float GetLength() const noexcept
   {
     MDY_ASSERT(this->HasNaNs() == false);
-    return std::sqrtf(this->GetSquareLength());
+    return std::sqrt(this->GetSquareLength());
   }
 
   /// @brief Return new DVector2 instance of normalized input vector.
@@ -101,25 +102,25 @@ struct DVector2 final
     return {this->X / length, this->Y / length};
   }
 
-  friend DVector2 operator+(DVector2 lhs, const DVector2& rhs) noexcept 
+  friend constexpr DVector2 operator+(DVector2 lhs, const DVector2& rhs) noexcept 
   {
     lhs.X += rhs.X; lhs.Y += rhs.Y;
     return lhs;
   }
 
-  friend DVector2 operator-(DVector2 lhs, const DVector2& rhs) noexcept 
+  friend constexpr DVector2 operator-(DVector2 lhs, const DVector2& rhs) noexcept 
   {
     lhs.X -= rhs.X; lhs.Y -= rhs.Y;
     return lhs;
   }
 
-  friend DVector2 operator*(DVector2 lhs, const float rhs) noexcept 
+  friend constexpr DVector2 operator*(DVector2 lhs, const float rhs) noexcept 
   {
     lhs.X *= rhs; lhs.Y *= rhs;
     return lhs;
   }
 
-  friend DVector2 operator*(DVector2 lhs, const DVector2& rhs) noexcept 
+  friend constexpr DVector2 operator*(DVector2 lhs, const DVector2& rhs) noexcept 
   {
     lhs.X *= rhs.X; lhs.Y *= rhs.Y;
     return lhs;
@@ -142,25 +143,25 @@ struct DVector2 final
     return lhs;
   }
 
-  DVector2& operator+=(const DVector2& value) noexcept
+  constexpr DVector2& operator+=(const DVector2& value) noexcept
   {
     this->X += value.X; this->Y += value.Y;
     return *this;
   }
 
-  DVector2& operator-=(const DVector2& value) noexcept
+  constexpr DVector2& operator-=(const DVector2& value) noexcept
   {
     this->X -= value.X; this->Y -= value.Y;
     return *this;
   }
 
-  DVector2& operator*=(const float value) noexcept
+  constexpr DVector2& operator*=(const float value) noexcept
   {
     this->X *= value; this->Y *= value;
     return *this;
   }
 
-  DVector2& operator*=(const DVector2& value) noexcept
+  constexpr DVector2& operator*=(const DVector2& value) noexcept
   {
     this->X *= value.X; this->Y *= value.Y;
     return *this;
@@ -188,19 +189,19 @@ struct DVector2 final
     return *this;
   }
 
-  friend bool operator==(const DVector2& lhs, const DVector2& rhs) noexcept
+  friend constexpr bool operator==(const DVector2& lhs, const DVector2& rhs) noexcept
   {
     return lhs.X == rhs.X && lhs.Y == rhs.Y;
   }
 
-  friend bool operator!=(const DVector2& lhs, const DVector2& rhs) noexcept
+  friend constexpr bool operator!=(const DVector2& lhs, const DVector2& rhs) noexcept
   {
     return !(lhs == rhs);
   }
 
 public:
   /// @brief Check if this DVector2 is all zero or nearly equal to zero.
-  [[nodiscard]] bool IsAllZero() const noexcept
+  [[nodiscard]] constexpr bool IsAllZero() const noexcept
   {
     return this->X == 0 && this->Y == 0;
   }
@@ -212,7 +213,7 @@ public:
 
   /// @brief Do dot product of (x, y) R^2 vector.
   /// @return Dot product float value.
-  [[nodiscard]] static float Dot(const DVector2& lhs, const DVector2& rhs) noexcept
+  [[nodiscard]] static constexpr float Dot(const DVector2& lhs, const DVector2& rhs) noexcept
   {
     return lhs.X * rhs.X + lhs.Y * rhs.Y;
   }
@@ -222,7 +223,7 @@ public:
   /// @param[in] rhs To DVector2 vector.
   /// @param[in] value float [0, 1] value, it is okay that value is a out of bound.
   /// @return interpolated vec2 value.
-  [[nodiscard]] static DVector2 Lerp(const DVector2& lhs, const DVector2& rhs, float value) noexcept
+  [[nodiscard]] static constexpr DVector2 Lerp(const DVector2& lhs, const DVector2& rhs, float value) noexcept
   {
     return lhs * (1.0f - value) + rhs * value;
   }
@@ -14,6 +14,8 @@
 ///
 
 #include <array>
+#include <cmath>
+#include <stdexcept>
 #include <glm/glm.hpp>
 #include "System/AAssertion.h"
 
@@ -30,14 +32,14 @@ struct DVector3 final
   };
 
   DVector3() = default;
-  DVector3(const float x, const float y, const float z) noexcept : X(x), Y(y), Z(z) {};
-  explicit DVector3(const float value) noexcept : X{value}, Y{value}, Z{value} {};
+  constexpr DVector3(const float x, const float y, const float z) noexcept : X(x), Y(y), Z(z) {};
+  constexpr explicit DVector3(const float value) noexcept : X{value}, Y{value}, Z{value} {};
 
-  DVector3(const DVector3& value) noexcept = default;
-  DVector3(const glm::vec3& value) noexcept : X{value.x}, Y{value.y}, Z{value.z} {};
+  constexpr DVector3(const DVector3& value) noexcept = default;
+  constexpr DVector3(const glm::vec3& value) noexcept : X{value.x}, Y{value.y}, Z{value.z} {};
 
   DVector3& operator=(const DVector3& value) noexcept = default;
-  DVector3& operator=(const glm::vec3& value) noexcept
+  constexpr DVector3& operator=(const glm::vec3& value) noexcept
   {
     this->X = value.x;
     this->Y = value.y;
@@ -45,7 +47,7 @@ struct DVector3 final
     return *this;
   }
 
-  auto& operator[](std::size_t index)
+  constexpr auto& operator[](std::size_t index)
   {
     switch (index)
     {
@@ -56,7 +58,7 @@ struct DVector3 final
     }
   }
 
-  const auto& operator[](std::size_t index) const
+  constexpr const auto& operator[](std::size_t index) const
   {
     switch (index)
     {
@@ -93,7 +95,7 @@ struct DVector3 final
   [[nodiscard]] float GetLength() const noexcept
   {
     MDY_ASSERT(this->HasNaNs() == false);
-    return std::sqrtf(GetSquareLength());
+    return std::sqrt(GetSquareLength());
   }
 
   /// @brief Return new DVector3 instance of normalized input vector.
@@ -104,7 +106,7 @@ struct DVector3 final
     return {this->X / length, this->Y / length, this->Z / length};
   }
 
-  friend DVector3 operator+(DVector3 lhs, const DVector3& rhs) noexcept
+  friend constexpr DVector3 operator+(DVector3 lhs, const DVector3& rhs) noexcept
   {
     lhs.X += rhs.X;
     lhs.Y += rhs.Y;
@@ -112,7 +114,7 @@ struct DVector3 final
     return lhs;
   }
 
-  friend DVector3 operator-(DVector3 lhs, const DVector3& rhs) noexcept
+  friend constexpr DVector3 operator-(DVector3 lhs, const DVector3& rhs) noexcept
   {
     lhs.X -= rhs.X;
     lhs.Y -= rhs.Y;
@@ -120,7 +122,7 @@ struct DVector3 final
     return lhs;
   }
 
-  friend DVector3 operator*(DVector3 lhs, const float rhs) noexcept
+  friend constexpr DVector3 operator*(DVector3 lhs, const float rhs) noexcept
   {
     lhs.X *= rhs;
     lhs.Y *= rhs;
@@ -128,7 +130,7 @@ struct DVector3 final
     return lhs;
   }
 
-  friend DVector3 operator*(DVector3 lhs, const DVector3& rhs) noexcept
+  friend constexpr DVector3 operator*(DVector3 lhs, const DVector3& rhs) noexcept
   {
     lhs.X *= rhs.X;
     lhs.Y *= rhs.Y;
@@ -150,25 +152,25 @@ struct DVector3 final
     return lhs;
   }
 
-  DVector3& operator+=(const DVector3& value) noexcept
+  constexpr DVector3& operator+=(const DVector3& value) noexcept
   {
     this->X += value.X; this->Y += value.Y; this->Z += value.Z;
     return *this;
   }
 
-  DVector3& operator-=(const DVector3& value) noexcept
+  constexpr DVector3& operator-=(const DVector3& value) noexcept
   {
     this->X -= value.X; this->Y -= value.Y; this->Z -= value.Z;
     return *this;
   }
 
-  DVector3& operator*=(const float value) noexcept
+  constexpr DVector3& operator*=(const float value) noexcept
   {
     this->X *= value; this->Y *= value; this->Z *= value;
     return *this;
   }
 
-  DVector3& operator*=(const DVector3& value) noexcept
+  constexpr DVector3& operator*=(const DVector3& value) noexcept
   {
     this->X *= value.X; this->Y *= value.Y; this->Z *= value.Z;
     return *this;
@@ -188,29 +190,29 @@ struct DVector3 final
     return *this;
   }
 
-  friend bool operator==(const DVector3& lhs, const DVector3& rhs) noexcept
+  friend constexpr bool operator==(const DVector3& lhs, const DVector3& rhs) noexcept
   {
     return lhs.X == rhs.X && lhs.Y == rhs.Y && lhs.Z == rhs.Z;
   }
-  friend bool operator!=(const DVector3& lhs, const DVector3& rhs) noexcept
+  friend constexpr bool operator!=(const DVector3& lhs, const DVector3& rhs) noexcept
   {
     return !(lhs == rhs);
   }
 
   /// @brief Check if this DVector3 is all zero or nearly equal to zero.
-  [[nodiscard]] bool IsAllZero() const noexcept
+  [[nodiscard]] constexpr bool IsAllZero() const noexcept
   {
     return this->X == 0 && this->Y == 0 && this->Z == 0;
   }
 
   /// @brief Do dot product of (x, y, z) R^3 vector.
-  [[nodiscard]] static float Dot(const DVector3& lhs, const DVector3& rhs) noexcept
+  [[nodiscard]] static constexpr float Dot(const DVector3& lhs, const DVector3& rhs) noexcept
   {
     return lhs.X * rhs.X + lhs.Y * rhs.Y + lhs.Z * rhs.Z;
   }
 
   /// @brief Cross product of (x, y, z) R^3 vector.
-  [[nodiscard]] static DVector3 Cross(const DVector3& lhs, const DVector3& rhs) noexcept
+  [[nodiscard]] static constexpr DVector3 Cross(const DVector3& lhs, const DVector3& rhs) noexcept
   {
     return
     {
@@ -220,30 +222,27 @@ struct DVector3 final
     };
   }
 
-  [[nodiscard]] static DVector3 Lerp(const DVector3& lhs, const DVector3& rhs, float value) noexcept
+  [[nodiscard]] static constexpr DVector3 Lerp(const DVector3& lhs, const DVector3& rhs, float value) noexcept
   {
     return lhs * (1.0f - value) + rhs * value;
   }
 
   /// @brief Return {0, 0, 1} front DVector3 vector.
-  static DVector3 FrontZ() noexcept
+  static constexpr DVector3 FrontZ() noexcept
   {
-    static DVector3 ret{0, 0, 1};
-    return ret;
+    return {0, 0, 1};
   }
 
   /// @brief Return {1, 0, 0} right DVector3 vector.
-  static DVector3 RightX() noexcept
+  static constexpr DVector3 RightX() noexcept
   {
-    static DVector3 ret{1, 0, 0};
-    return ret;
+    return {1, 0, 0};
   }
 
   /// @brief Return {0, 1, 0} up DVector3 vector.
-  static DVector3 UpY() noexcept
+  static constexpr DVector3 UpY() noexcept
   {
-    static DVector3 ret{0, 1, 0};
-    return ret;
+    return {0, 1, 0};
   }
 };
 
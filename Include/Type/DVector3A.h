@@ -0,0 +1,263 @@
+#ifndef GUARD_DY_HELPER_TYPE_VECTOR3A_H
+#define GUARD_DY_HELPER_TYPE_VECTOR3A_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cmath>
+#include <glm/glm.hpp>
+#include "ASimdInclude.h"
+#include "DVector3.h"
+#include "System/AAssertion.h"
+
+namespace dy
+{
+
+/// @struct DVector3A
+/// @brief 16-byte aligned float type 3-element vector struct, backed by one __m128. \n
+/// Use DVector3 for packed data such as vertex, and DVector3A for calculation.
+/// Fourth lane is padding and kept as 0, so every operation works on whole __m128.
+struct alignas(16) DVector3A final
+{
+  union 
+  { 
+    __m128 __Simd{}; 
+    struct { float X; float Y; float Z; float __W; };
+  };
+
+  DVector3A() = default;
+  DVector3A(const DVector3A&) = default;
+  DVector3A& operator=(const DVector3A&) = default;
+
+  /// @brief Fourth lane of `__iSimd` must be 0.
+  explicit DVector3A(__m128 __iSimd) noexcept : __Simd{__iSimd} {};
+  constexpr explicit DVector3A(const float value) noexcept : X{value}, Y{value}, Z{value}, __W{0} {};
+  constexpr DVector3A(const float x, const float y, const float z) noexcept : X{x}, Y{y}, Z{z}, __W{0} {};
+  constexpr explicit DVector3A(const glm::vec3& value) noexcept : X{value.x}, Y{value.y}, Z{value.z}, __W{0} {};
+
+  /// @brief Load packed DVector3 without reading beyond 12 bytes.
+  explicit DVector3A(const DVector3& value) noexcept
+  {
+    const __m128 xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(value.Data())));
+    this->__Simd = _mm_movelh_ps(xy, _mm_load_ss(value.Data() + 2));
+  }
+
+  /// @brief Store to packed DVector3 without writing beyond 12 bytes.
+  explicit operator DVector3() const noexcept
+  {
+    DVector3 result;
+    _mm_store_sd(reinterpret_cast<double*>(result.Data()), _mm_castps_pd(this->__Simd));
+    _mm_store_ss(result.Data() + 2, _mm_movehl_ps(this->__Simd, this->__Simd));
+    return result;
+  }
+
+  explicit operator glm::vec3() const noexcept
+  {
+    return glm::vec3{this->X, this->Y, this->Z};
+  }
+
+  constexpr auto& operator[](std::size_t index)
+  {
+    switch (index)
+    {
+    case 0: return this->X;
+    case 1: return this->Y;
+    case 2: return this->Z;
+    default: throw std::out_of_range("DVector3A range is out of bound.");
+    }
+  }
+
+  constexpr const auto& operator[](std::size_t index) const
+  {
+    switch (index)
+    {
+    case 0: return this->X;
+    case 1: return this->Y;
+    case 2: return this->Z;
+    default: throw std::out_of_range("DVector3A range is out of bound.");
+    }
+  }
+
+  [[nodiscard]] float* Data() noexcept { return &this->X; }
+  [[nodiscard]] const float* Data() const noexcept { return &this->X; }
+
+  [[nodiscard]] bool HasNaNs() const noexcept
+  {
+    return (_mm_movemask_ps(_mm_cmpunord_ps(this->__Simd, this->__Simd)) & 0x7) != 0;
+  }
+
+  /// @brief Return squared length of this vector.
+  [[nodiscard]] float GetSquareLength() const noexcept
+  {
+    MDY_ASSERT(this->HasNaNs() == false);
+    return Dot(*this, *this);
+  }
+
+  /// @brief Returns the length of this vector.
+  [[nodiscard]] float GetLength() const noexcept
+  {
+    MDY_ASSERT(this->HasNaNs() == false);
+    return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(Dot(*this, *this))));
+  }
+
+  /// @brief Return new normalized vector. Zero vector becomes NaN like DVector3::Normalize.
+  [[nodiscard]] DVector3A Normalize() const noexcept
+  {
+    MDY_ASSERT(this->HasNaNs() == false);
+    const __m128 length = _mm_sqrt_ps(DotSimd(this->__Simd, this->__Simd));
+    // Padding lane becomes NaN when length is 0, so clear it again.
+    return DVector3A{MaskXyz(_mm_div_ps(this->__Simd, length))};
+  }
+
+  //!
+  //! Operators below take scalar path in constant evaluation because __Simd is not active member,
+  //! and SIMD path in runtime, same to DVector4.
+  //!
+
+  friend constexpr DVector3A operator+(DVector3A lhs, const DVector3A& rhs) noexcept
+  {
+    if (MDY_IS_CONSTANT_EVALUATED() == true) { return {lhs.X + rhs.X, lhs.Y + rhs.Y, lhs.Z + rhs.Z}; }
+    lhs.__Simd = _mm_add_ps(lhs.__Simd, rhs.__Simd);
+    return lhs;
+  }
+
+  friend constexpr DVector3A operator-(DVector3A lhs, const DVector3A& rhs) noexcept
+  {
+    if (MDY_IS_CONSTANT_EVALUATED() == true) { return {lhs.X - rhs.X, lhs.Y - rhs.Y, lhs.Z - rhs.Z}; }
+    lhs.__Simd = _mm_sub_ps(lhs.__Simd, rhs.__Simd);
+    return lhs;
+  }
+
+  friend constexpr DVector3A operator-(DVector3A value) noexcept
+  {
+    if (MDY_IS_CONSTANT_EVALUATED() == true) { return {-value.X, -value.Y, -value.Z}; }
+    value.__Simd = _mm_sub_ps(_mm_setzero_ps(), value.__Simd);
+    return value;
+  }
+
+  friend constexpr DVector3A operator*(DVector3A lhs, const float rhs) noexcept
+  {
+    if (MDY_IS_CONSTANT_EVALUATED() == true) { return {lhs.X * rhs, lhs.Y * rhs, lhs.Z * rhs}; }
+    lhs.__Simd = _mm_mul_ps(lhs.__Simd, _mm_set1_ps(rhs));
+    return lhs;
+  }
+
+  friend constexpr DVector3A operator*(const float lhs, const DVector3A& rhs) noexcept
+  {
+    return rhs * lhs;
+  }
+
+  /// If lhs and rhs are DVector3A, element multiplication happens.
+  friend constexpr DVector3A operator*(DVector3A lhs, const DVector3A& rhs) noexcept
+  {
+    if (MDY_IS_CONSTANT_EVALUATED() == true) { return {lhs.X * rhs.X, lhs.Y * rhs.Y, lhs.Z * rhs.Z}; }
+    lhs.__Simd = _mm_mul_ps(lhs.__Simd, rhs.__Simd);
+    return lhs;
+  }
+
+  friend DVector3A operator/(DVector3A lhs, const float rhs) noexcept
+  {
+    MDY_ASSERT(rhs != 0.0f);
+    lhs.__Simd = _mm_div_ps(lhs.__Simd, _mm_set1_ps(rhs));
+    return lhs;
+  }
+
+  friend DVector3A operator/(DVector3A lhs, const DVector3A& rhs) noexcept
+  {
+    MDY_ASSERT(rhs.X != 0.0f && rhs.Y != 0.0f && rhs.Z != 0.0f);
+    // Padding lane is 0 / 0, so clear it.
+    lhs.__Simd = MaskXyz(_mm_div_ps(lhs.__Simd, rhs.__Simd));
+    return lhs;
+  }
+
+  constexpr DVector3A& operator+=(const DVector3A& value) noexcept { return *this = *this + value; }
+  constexpr DVector3A& operator-=(const DVector3A& value) noexcept { return *this = *this - value; }
+  constexpr DVector3A& operator*=(const float value) noexcept { return *this = *this * value; }
+  constexpr DVector3A& operator*=(const DVector3A& value) noexcept { return *this = *this * value; }
+  DVector3A& operator/=(const float value) noexcept { return *this = *this / value; }
+  DVector3A& operator/=(const DVector3A& value) noexcept { return *this = *this / value; }
+
+  friend constexpr bool operator==(const DVector3A& lhs, const DVector3A& rhs) noexcept
+  {
+    if (MDY_IS_CONSTANT_EVALUATED() == true) { return lhs.X == rhs.X && lhs.Y == rhs.Y && lhs.Z == rhs.Z; }
+    return (_mm_movemask_ps(_mm_cmpeq_ps(lhs.__Simd, rhs.__Simd)) & 0x7) == 0x7;
+  }
+
+  friend constexpr bool operator!=(const DVector3A& lhs, const DVector3A& rhs) noexcept
+  {
+    return !(lhs == rhs);
+  }
+
+  /// @brief Check if this DVector3A is all zero.
+  [[nodiscard]] bool IsAllZero() const noexcept
+  {
+    return (_mm_movemask_ps(_mm_cmpeq_ps(this->__Simd, _mm_setzero_ps())) & 0x7) == 0x7;
+  }
+
+  /// @brief Do dot product of (x, y, z). Summation order is same to DVector3::Dot.
+  [[nodiscard]] static float Dot(const DVector3A& lhs, const DVector3A& rhs) noexcept
+  {
+    return _mm_cvtss_f32(DotSimd(lhs.__Simd, rhs.__Simd));
+  }
+
+  /// @brief Cross product of (x, y, z). Same to DVector3::Cross.
+  [[nodiscard]] static DVector3A Cross(const DVector3A& lhs, const DVector3A& rhs) noexcept
+  {
+    const __m128 lYzx = _mm_shuffle_ps(lhs.__Simd, lhs.__Simd, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m128 rYzx = _mm_shuffle_ps(rhs.__Simd, rhs.__Simd, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m128 lZxy = _mm_shuffle_ps(lhs.__Simd, lhs.__Simd, _MM_SHUFFLE(3, 1, 0, 2));
+    const __m128 rZxy = _mm_shuffle_ps(rhs.__Simd, rhs.__Simd, _MM_SHUFFLE(3, 1, 0, 2));
+    return DVector3A{_mm_sub_ps(_mm_mul_ps(lYzx, rZxy), _mm_mul_ps(rYzx, lZxy))};
+  }
+
+  /// @brief lhs * (1 - value) + rhs * value, same to DVector3::Lerp.
+  [[nodiscard]] static DVector3A Lerp(const DVector3A& lhs, const DVector3A& rhs, float value) noexcept
+  {
+    return lhs * (1.0f - value) + rhs * value;
+  }
+
+  /// @brief Component-wise minimum.
+  [[nodiscard]] static DVector3A Min(const DVector3A& lhs, const DVector3A& rhs) noexcept
+  {
+    return DVector3A{_mm_min_ps(lhs.__Simd, rhs.__Simd)};
+  }
+
+  /// @brief Component-wise maximum.
+  [[nodiscard]] static DVector3A Max(const DVector3A& lhs, const DVector3A& rhs) noexcept
+  {
+    return DVector3A{_mm_max_ps(lhs.__Simd, rhs.__Simd)};
+  }
+
+private:
+  /// @brief Clear padding lane.
+  static __m128 MaskXyz(const __m128& iVector) noexcept
+  {
+    return _mm_and_ps(iVector, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+  }
+
+  /// @brief (x * x + y * y) + z * z, broadcasted.
+  static __m128 DotSimd(const __m128& lhs, const __m128& rhs) noexcept
+  {
+    const __m128 product = _mm_mul_ps(lhs, rhs);
+    const __m128 x = _mm_shuffle_ps(product, product, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 y = _mm_shuffle_ps(product, product, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 z = _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 2, 2, 2));
+    return _mm_add_ps(_mm_add_ps(x, y), z);
+  }
+};
+
+static_assert(sizeof(DVector3A) == 16, "Test failed");
+static_assert(alignof(DVector3A) == 16, "Test failed");
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_VECTOR3A_H
@@ -15,6 +15,7 @@
 
 #include <array>
 #include <glm/glm.hpp>
+#include "ASimdInclude.h"
 #include "System/AAssertion.h"
 
 namespace dy
@@ -35,9 +36,9 @@ struct DVector4 final
   DVector4& operator=(const DVector4&) = default;
 
   explicit DVector4(__m128 __iSimd) : __Simd{__iSimd} {};
-  explicit DVector4(const float value) noexcept : X{value}, Y{value}, Z{value}, W{value} {};
-  DVector4(const float x, const float y, const float z, const float w) noexcept : X(x), Y(y), Z(z), W{w} {};
-  DVector4(const glm::vec4& value) noexcept : X{value.x}, Y{value.y}, Z{value.z}, W{value.w} {}
+  constexpr explicit DVector4(const float value) noexcept : X{value}, Y{value}, Z{value}, W{value} {};
+  constexpr DVector4(const float x, const float y, const float z, const float w) noexcept : X(x), Y(y), Z(z), W{w} {};
+  constexpr DVector4(const glm::vec4& value) noexcept : X{value.x}, Y{value.y}, Z{value.z}, W{value.w} {}
 
   DVector4& operator=(const __m128& __iSimd) noexcept
   {
@@ -45,13 +46,13 @@ struct DVector4 final
     return *this;
   }
 
-  DVector4& operator=(const glm::vec4& value) noexcept
+  constexpr DVector4& operator=(const glm::vec4& value) noexcept
   {
     this->X = value.x; this->Y = value.y; this->Z = value.z; this->W = value.w;
     return *this;
   }
 
-  auto& operator[](std::size_t index)
+  constexpr auto& operator[](std::size_t index)
   {
     switch (index)
     {
@@ -63,7 +64,7 @@ struct DVector4 final
     }
   }
 
-  const auto& operator[](std::size_t index) const
+  constexpr const auto& operator[](std::size_t index) const
   {
     switch (index) {
     case 0: return this->X;
@@ -82,27 +83,48 @@ struct DVector4 final
   [[nodiscard]] float* Data() noexcept { return &this->X; }
   [[nodiscard]] const float* Data() const noexcept { return &this->X; }
 
-  friend DVector4 operator+(DVector4 lhs, const DVector4& rhs) noexcept
+  //!
+  //! Operators below take scalar path in constant evaluation because __Simd is not active member,
+  //! and SIMD path in runtime.
+  //!
+
+  friend constexpr DVector4 operator+(DVector4 lhs, const DVector4& rhs) noexcept
   {
+    if (MDY_IS_CONSTANT_EVALUATED() == true)
+    {
+      return {lhs.X + rhs.X, lhs.Y + rhs.Y, lhs.Z + rhs.Z, lhs.W + rhs.W};
+    }
     lhs.__Simd = _mm_add_ps(lhs.__Simd, rhs.__Simd);
     return lhs;
   }
 
-  friend DVector4 operator-(DVector4 lhs, const DVector4& rhs) noexcept
+  friend constexpr DVector4 operator-(DVector4 lhs, const DVector4& rhs) noexcept
   {
+    if (MDY_IS_CONSTANT_EVALUATED() == true)
+    {
+      return {lhs.X - rhs.X, lhs.Y - rhs.Y, lhs.Z - rhs.Z, lhs.W - rhs.W};
+    }
     lhs.__Simd = _mm_sub_ps(lhs.__Simd, rhs.__Simd);
     return lhs;
   }
 
-  friend DVector4 operator*(DVector4 lhs, const float rhs) noexcept
+  friend constexpr DVector4 operator*(DVector4 lhs, const float rhs) noexcept
   {
+    if (MDY_IS_CONSTANT_EVALUATED() == true)
+    {
+      return {lhs.X * rhs, lhs.Y * rhs, lhs.Z * rhs, lhs.W * rhs};
+    }
     lhs.__Simd = _mm_mul_ps(lhs.__Simd, _mm_set_ps(rhs, rhs, rhs, rhs));
     return lhs;
   }
 
   /// If lhs and rhs are DVector4, element multiplication happens.
-  friend DVector4 operator*(DVector4 lhs, const DVector4& rhs) noexcept
+  friend constexpr DVector4 operator*(DVector4 lhs, const DVector4& rhs) noexcept
   {
+    if (MDY_IS_CONSTANT_EVALUATED() == true)
+    {
+      return {lhs.X * rhs.X, lhs.Y * rhs.Y, lhs.Z * rhs.Z, lhs.W * rhs.W};
+    }
     lhs.__Simd = _mm_mul_ps(lhs.__Simd, rhs.__Simd);
     return lhs;
   }
@@ -125,27 +147,27 @@ struct DVector4 final
     return lhs;
   }
 
-  DVector4& operator+=(const DVector4& value) noexcept
+  constexpr DVector4& operator+=(const DVector4& value) noexcept
   {
-    this->__Simd = _mm_add_ps(this->__Simd, value.__Simd);
+    *this = *this + value;
     return *this;
   }
 
-  DVector4& operator-=(const DVector4& value) noexcept
+  constexpr DVector4& operator-=(const DVector4& value) noexcept
   {
-    this->__Simd = _mm_sub_ps(this->__Simd, value.__Simd);
+    *this = *this - value;
     return *this;
   }
 
-  DVector4& operator*=(const float value) noexcept
+  constexpr DVector4& operator*=(const float value) noexcept
   {
-    this->__Simd = _mm_mul_ps(this->__Simd, _mm_set_ps(value, value, value, value));
+    *this = *this * value;
     return *this;
   }
 
-  DVector4& operator*=(const DVector4& value) noexcept
+  constexpr DVector4& operator*=(const DVector4& value) noexcept
   {
-    this->__Simd = _mm_sub_ps(this->__Simd, value.__Simd);
+    *this = *this * value;
     return *this;
   }
 
@@ -166,12 +188,16 @@ struct DVector4 final
   }
 
   // https://stackoverflow.com/questions/6042399/how-to-compare-m128-types
-  friend bool operator==(const DVector4& lhs, const DVector4& rhs) noexcept
+  friend constexpr bool operator==(const DVector4& lhs, const DVector4& rhs) noexcept
   {
+    if (MDY_IS_CONSTANT_EVALUATED() == true)
+    {
+      return lhs.X == rhs.X && lhs.Y == rhs.Y && lhs.Z == rhs.Z && lhs.W == rhs.W;
+    }
     return _mm_movemask_ps(_mm_cmpeq_ps(lhs.__Simd, rhs.__Simd)) == 0xF;
   }
   
-  friend bool operator!=(const DVector4& lhs, const DVector4& rhs) noexcept
+  friend constexpr bool operator!=(const DVector4& lhs, const DVector4& rhs) noexcept
   {
     return !(lhs == rhs);
   }
@@ -0,0 +1,40 @@
+#ifndef GUARD_DY_HELPER_TYPE_HELPER_CPU_FEATURE_H
+#define GUARD_DY_HELPER_TYPE_HELPER_CPU_FEATURE_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+namespace dy
+{
+
+/// @enum ESimdLevel
+/// @brief Instruction set level which can be selected in runtime. Higher level includes lower levels. \n
+/// There is no level between SSE2 and AVX2, because no kernel uses SSE3 to SSE4.2 instructions.
+enum class ESimdLevel
+{
+  Sse2 = 0,
+  /// AVX2 and FMA.
+  Avx2,
+  /// AVX-512 Foundation.
+  Avx512,
+};
+
+/// @brief Get highest SIMD level which both CPU and OS (saved register state) support. \n
+/// CPUID is queried only once.
+[[nodiscard]] ESimdLevel GetSupportedSimdLevel() noexcept;
+
+/// @brief Get name of level for logging.
+[[nodiscard]] const char* ToString(ESimdLevel iLevel) noexcept;
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_HELPER_CPU_FEATURE_H
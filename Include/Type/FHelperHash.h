@@ -0,0 +1,99 @@
+#ifndef GUARD_DY_HELPER_TYPE_HELPER_HASH_H
+#define GUARD_DY_HELPER_TYPE_HELPER_HASH_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cstddef>
+#include <cstring>
+#include "FGlobalType.h"
+#if defined(_MSC_VER) == true && defined(__clang__) == false
+#include <intrin.h>
+#endif
+
+//!
+//! Non-cryptographic 64-bit hash over raw bytes, in the style of wyhash.
+//! Each 16 bytes are folded with one 64x64->128 bit multiply, so every input bit
+//! affects every output bit, unlike xor-shift combiners of std::hash<DVector3>.
+//! Result depends on byte order, so it must not be stored across different platforms.
+//!
+
+namespace dy
+{
+
+namespace hash::detail
+{
+
+constexpr TU64 kSecret0 = 0xA0761D6478BD642Full;
+constexpr TU64 kSecret1 = 0xE7037ED1A0B428DBull;
+constexpr TU64 kSecret2 = 0x8EBC6AF09C88C6E3ull;
+
+/// @brief Multiply to 128 bits and fold high and low 64 bits by xor.
+inline TU64 MultiplyFold(TU64 iLhs, TU64 iRhs) noexcept
+{
+#if defined(_MSC_VER) == true && defined(__clang__) == false
+  TU64 high;
+  const TU64 low = _umul128(iLhs, iRhs, &high);
+  return low ^ high;
+#else
+  const auto product = static_cast<unsigned __int128>(iLhs) * iRhs;
+  return static_cast<TU64>(product) ^ static_cast<TU64>(product >> 64);
+#endif
+}
+
+inline TU64 Read64(const unsigned char* iData) noexcept
+{
+  TU64 value;
+  std::memcpy(&value, iData, sizeof(value));
+  return value;
+}
+
+/// @brief Read 0 ~ 8 bytes as zero-extended integer.
+inline TU64 ReadPartial(const unsigned char* iData, std::size_t iSize) noexcept
+{
+  TU64 value = 0;
+  std::memcpy(&value, iData, iSize);
+  return value;
+}
+
+} /// ::dy::hash::detail namespace
+
+/// @brief Hash `iSize` bytes from `iData`.
+inline TU64 HashBytes(const void* iData, std::size_t iSize, TU64 iSeed = 0) noexcept
+{
+  using namespace hash::detail;
+  const auto* data = static_cast<const unsigned char*>(iData);
+
+  TU64 seed = iSeed ^ kSecret0;
+  std::size_t remained = iSize;
+  for (; remained > 16; remained -= 16, data += 16)
+  {
+    seed = MultiplyFold(Read64(data) ^ kSecret1, Read64(data + 8) ^ seed);
+  }
+
+  // Last 1 ~ 16 bytes. Size is mixed in final step, so zero-extended tail does not collide.
+  const TU64 lhs = ReadPartial(data, remained < 8 ? remained : 8);
+  const TU64 rhs = remained > 8 ? ReadPartial(data + 8, remained - 8) : 0;
+  return MultiplyFold(kSecret2 ^ static_cast<TU64>(iSize), MultiplyFold(lhs ^ kSecret1, rhs ^ seed));
+}
+
+/// @brief Hash object representation of trivially copyable `iValue`. \n
+/// `TType` must not have padding bytes, because they are hashed too.
+template <typename TType>
+TU64 HashObject(const TType& iValue, TU64 iSeed = 0) noexcept
+{
+  return HashBytes(&iValue, sizeof(TType), iSeed);
+}
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_HELPER_HASH_H
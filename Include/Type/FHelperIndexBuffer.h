@@ -0,0 +1,92 @@
+#ifndef GUARD_DY_HELPER_TYPE_HELPER_INDEX_BUFFER_H
+#define GUARD_DY_HELPER_TYPE_HELPER_INDEX_BUFFER_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cstddef>
+#include <vector>
+#include "FGlobalType.h"
+
+//!
+//! Selection of 16-bit or 32-bit index buffer for triangle list.
+//! Large mesh is split into submeshes of consecutive triangles, and each submesh is drawn
+//! with vertex offset, so its indices are relative to the offset and fit in 16 bits.
+//! (1) When each submesh spans at most 65536 vertices, smallest vertex is vertex offset and
+//! vertices are not duplicated. This is common when vertices are numbered in first use order,
+//! e.g. by OptimizeVertexFetch.
+//! (2) Otherwise, each submesh has its own copy of up to 65536 vertices, if duplicated vertices
+//! are smaller than saved index bytes.
+//!
+
+namespace dy
+{
+
+/// @struct DIndexSubmesh
+/// @brief Range of triangles drawn by one indexed draw call.
+struct DIndexSubmesh final
+{
+  /// First index in index buffer.
+  TU32 mFirstIndex   = 0;
+  TU32 mIndexCount   = 0;
+  /// Value added to each index by GPU, which is `vertexOffset` of vkCmdDrawIndexed.
+  TU32 mVertexOffset = 0;
+};
+
+/// @struct DIndexBufferLayout
+/// @brief Index type and submeshes of index buffer.
+struct DIndexBufferLayout final
+{
+  /// True if indices are stored as TU16 relative to vertex offset of submesh.
+  bool mIs16Bit = false;
+  std::vector<DIndexSubmesh> mSubmeshes;
+  /// Source vertex of each vertex in vertex buffer, when submeshes have own vertices.
+  /// Empty when vertex buffer is source vertices as is.
+  std::vector<TU32> mVertexRemap;
+  TU32 mSourceVertexCount = 0;
+
+  /// @brief Get byte size of one index.
+  [[nodiscard]] std::size_t GetIndexSize() const noexcept { return this->mIs16Bit == true ? sizeof(TU16) : sizeof(TU32); }
+
+  /// @brief Get vertex count of vertex buffer.
+  [[nodiscard]] TU32 GetVertexCount() const noexcept
+  {
+    return this->mVertexRemap.empty() == true ? this->mSourceVertexCount : static_cast<TU32>(this->mVertexRemap.size());
+  }
+};
+
+/// @brief Default minimum average index count of submesh. Split into smaller submeshes is not used,
+/// because saved index bandwidth does not pay for cost of additional draw calls.
+constexpr TU32 kDefaultMinSubmeshIndexCount = 3 * 4096;
+
+/// @brief Choose index buffer layout of triangle list, of which vertices are `iVertexStride` bytes. \n
+/// 16-bit indices are used when submeshes have `iMinSubmeshIndexCount` indices in average,
+/// and duplicated vertices are smaller than saved index bytes. Otherwise, one 32-bit submesh is used.
+[[nodiscard]] DIndexBufferLayout CreateIndexBufferLayout(
+    const TU32* iIndices, std::size_t iIndexCount, TU32 iVertexCount, std::size_t iVertexStride,
+    TU32 iMinSubmeshIndexCount = kDefaultMinSubmeshIndexCount);
+
+/// @brief Write indices into `outIndices` in format of `iLayout`, which has `iIndexCount` * GetIndexSize() bytes. \n
+/// `outIndices` may be mapped device memory, because it is only written in order.
+void WriteIndexBuffer(const TU32* iIndices, std::size_t iIndexCount, const DIndexBufferLayout& iLayout, void* outIndices);
+
+/// @brief Write GetVertexCount() vertices of `iVertexStride` bytes into `outVertices` by vertex remap of `iLayout`. \n
+/// `outVertices` may be mapped device memory, because it is only written in order.
+void WriteVertexBuffer(const void* iVertices, std::size_t iVertexStride, const DIndexBufferLayout& iLayout, void* outVertices);
+
+/// @brief Split index ranges at submesh boundaries of `iLayout` into draws which have vertex offset of submesh. \n
+/// `iRanges` must be sorted by first index and must not overlap, e.g. result of CullMeshlets.
+void SplitRangesBySubmesh(const std::vector<DIndexSubmesh>& iRanges, const DIndexBufferLayout& iLayout, std::vector<DIndexSubmesh>& outDraws);
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_HELPER_INDEX_BUFFER_H
@@ -0,0 +1,71 @@
+#ifndef GUARD_DY_HELPER_TYPE_HELPER_MESH_OPTIMIZE_H
+#define GUARD_DY_HELPER_TYPE_HELPER_MESH_OPTIMIZE_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cstddef>
+#include "FGlobalType.h"
+
+//!
+//! Reordering of indexed triangle lists for GPU vertex processing.
+//! Run OptimizeVertexCache, then OptimizeOverdraw, then OptimizeVertexFetch.
+//! Every function keeps triangle set and winding, only order of triangles or vertices is changed.
+//!
+
+namespace dy
+{
+
+/// @struct DVertexCacheStats
+/// @brief Result of FIFO post-transform cache simulation.
+struct DVertexCacheStats final
+{
+  /// Transformed vertex count, which is cache miss count.
+  TU64 mTransformCount = 0;
+  /// Average cache miss ratio, transformed vertices per triangle. 0.5 is ideal for large grid, 3 is worst.
+  TF64 mAcmr = 0.0;
+  /// Average transform to vertex ratio, transformed vertices per referenced vertex. 1 is ideal.
+  TF64 mAtvr = 0.0;
+};
+
+/// @brief Default FIFO cache size to optimize for and analyze with.
+constexpr TU32 kDefaultVertexCacheSize = 16;
+
+/// @brief Simulate FIFO post-transform cache of `iCacheSize` entries over triangle list.
+[[nodiscard]] DVertexCacheStats AnalyzeVertexCache(
+    const TU32* iIndices, std::size_t iIndexCount, TU32 iVertexCount,
+    TU32 iCacheSize = kDefaultVertexCacheSize);
+
+/// @brief Reorder triangles for post-transform cache by Tipsify (Sander et al. 2007). \n
+/// `outIndices` may be same to `iIndices`.
+void OptimizeVertexCache(
+    const TU32* iIndices, std::size_t iIndexCount, TU32 iVertexCount, TU32* outIndices,
+    TU32 iCacheSize = kDefaultVertexCacheSize);
+
+/// @brief Reorder clusters of cache-optimized triangles to reduce overdraw. \n
+/// Clusters are split where cache is restarted, and further while cluster ACMR stays under
+/// `iThreshold` times of ACMR of whole cluster. Clusters facing outward from mesh center are drawn first.
+/// `iPositions` points position (x, y, z) of first vertex, and positions are `iPositionStride` bytes apart.
+/// `outIndices` may be same to `iIndices`.
+void OptimizeOverdraw(
+    const TU32* iIndices, std::size_t iIndexCount,
+    const float* iPositions, std::size_t iPositionStride, TU32 iVertexCount,
+    TU32* outIndices, float iThreshold = 1.05f, TU32 iCacheSize = kDefaultVertexCacheSize);
+
+/// @brief Reorder vertices of `iVertexStride` bytes in order of first use by indices, and remap indices. \n
+/// Vertices not referenced are moved after referenced ones. Return referenced vertex count.
+TU32 OptimizeVertexFetch(void* ioVertices, TU32 iVertexCount, std::size_t iVertexStride,
+    TU32* ioIndices, std::size_t iIndexCount);
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_HELPER_MESH_OPTIMIZE_H
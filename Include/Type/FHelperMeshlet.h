@@ -0,0 +1,97 @@
+#ifndef GUARD_DY_HELPER_TYPE_HELPER_MESHLET_H
+#define GUARD_DY_HELPER_TYPE_HELPER_MESHLET_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cstddef>
+#include <vector>
+#include "FGlobalType.h"
+#include "Type/DFrustum.h"
+#include "Type/DSphere.h"
+#include "Type/DVector3.h"
+#include "Type/FHelperIndexBuffer.h"
+
+//!
+//! Meshlets are clusters of consecutive triangles of index buffer, so visible meshlets are
+//! drawn from the same index buffer without another index array.
+//! Build them after OptimizeVertexCache and OptimizeOverdraw, which keep consecutive triangles close.
+//!
+
+namespace dy
+{
+
+/// @struct DMeshlet
+/// @brief Range of triangles of one cluster in index buffer.
+struct DMeshlet final
+{
+  TU32 mFirstIndex    = 0;
+  TU32 mTriangleCount = 0;
+  /// Unique vertex count referenced by triangles.
+  TU32 mVertexCount   = 0;
+};
+
+/// @struct DMeshletBounds
+/// @brief Culling bounds of meshlet, packed as two vec4 of std140 and std430 layout. \n
+/// Every triangle of meshlet is back-facing when seen from camera position c, if
+/// dot(center - c, axis) >= cutoff * length(center - c) + radius.
+struct DMeshletBounds final
+{
+  /// Bounding sphere of vertices.
+  DSphere   mSphere     = {};
+  /// Average direction of triangle normals. Zero vector when normals spread too wide for cone test.
+  DVector3  mConeAxis   = DVector3{0.0f};
+  /// Sine of half angle of normal cone, so cone test never passes when it is 1.
+  float     mConeCutoff = 1.0f;
+};
+
+static_assert(sizeof(DMeshletBounds) == 32, "DMeshletBounds must be 32 bytes.");
+
+/// @struct DMeshletCullStats
+/// @brief Culling result count of meshlets.
+struct DMeshletCullStats final
+{
+  TU32 mMeshletCount        = 0;
+  TU32 mFrustumCulledCount  = 0;
+  TU32 mBackfaceCulledCount = 0;
+  /// Index ranges after adjacent visible meshlets are merged.
+  TU32 mRangeCount          = 0;
+};
+
+/// @brief Default meshlet limits, which also fit in mesh shader output of 64 vertices and 126 triangles.
+constexpr TU32 kDefaultMeshletMaxVertexCount   = 64;
+constexpr TU32 kDefaultMeshletMaxTriangleCount = 124;
+
+/// @brief Split triangle list into meshlets of consecutive triangles, which have at most
+/// `iMaxVertexCount` unique vertices and `iMaxTriangleCount` triangles.
+[[nodiscard]] std::vector<DMeshlet> BuildMeshlets(
+    const TU32* iIndices, std::size_t iIndexCount, TU32 iVertexCount,
+    TU32 iMaxVertexCount = kDefaultMeshletMaxVertexCount,
+    TU32 iMaxTriangleCount = kDefaultMeshletMaxTriangleCount);
+
+/// @brief Compute bounds of `iMeshletCount` meshlets into `outBounds`. \n
+/// `iPositions` points position (x, y, z) of first vertex, and positions are `iPositionStride` bytes apart.
+void ComputeMeshletBounds(
+    const DMeshlet* iMeshlets, std::size_t iMeshletCount, const TU32* iIndices,
+    const float* iPositions, std::size_t iPositionStride, DMeshletBounds* outBounds);
+
+/// @brief Cull meshlets by frustum and normal cone, and write index ranges of visible meshlets to `outRanges`. \n
+/// `iFrustum` and `iCameraPosition` must be in same space to bounds, e.g. made from projection * view * model.
+/// Adjacent visible meshlets are merged into one range.
+void CullMeshlets(
+    const DMeshlet* iMeshlets, const DMeshletBounds* iBounds, std::size_t iMeshletCount,
+    const DFrustum& iFrustum, const DVector3& iCameraPosition,
+    std::vector<DIndexSubmesh>& outRanges, DMeshletCullStats* outStats = nullptr);
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_HELPER_MESHLET_H
@@ -0,0 +1,78 @@
+#ifndef GUARD_DY_HELPER_TYPE_HELPER_MIPMAP_H
+#define GUARD_DY_HELPER_TYPE_HELPER_MIPMAP_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cstddef>
+#include "FGlobalType.h"
+#include "Type/FHelperCpuFeature.h"
+
+//!
+//! CPU mip chain generation of RGBA8 images, which does not need blit or filter support of device.
+//! Levels are packed tightly after level 0 in one buffer, so whole chain is uploaded by one staging buffer.
+//! Size of level L is max(1, size >> L), same to Vulkan.
+//!
+//! Each level is filtered from previous level in linear space, separably (vertical, then horizontal).
+//! Kernel is selected in runtime from SSE (1 pixel) and AVX2 (2 pixels) by CPUID.
+//! AVX-512 level uses AVX2 kernel, because rows are short and filtering is bound by table lookups.
+//!
+
+namespace dy
+{
+
+/// @enum EMipmapFilter
+/// @brief Filter to reduce each level from previous level.
+enum class EMipmapFilter
+{
+  /// Average of source texels covered by destination texel, weighted by covered area.
+  Box = 0,
+  /// Kaiser windowed sinc of radius 2 destination texels. Sharper than box, result is clamped.
+  Kaiser,
+};
+
+/// @struct DMipmapOptions
+/// @brief Options of `GenerateMipChain`.
+struct DMipmapOptions final
+{
+  EMipmapFilter mFilter = EMipmapFilter::Box;
+  /// RGB is sRGB encoded, so it is linearized by table before filtering and encoded again.
+  /// Alpha is always linear.
+  bool mIsSrgb = true;
+  /// Count of threads which filter rows of large levels. 0 is count of hardware threads.
+  TU32 mThreadCount = 0;
+};
+
+/// @brief Get count of levels of full chain, from `iWidth` x `iHeight` to 1 x 1.
+[[nodiscard]] TU32 GetMipLevelCount(TU32 iWidth, TU32 iHeight) noexcept;
+
+/// @brief Get byte offset of level `iLevel` from level 0 in tightly packed RGBA8 chain.
+[[nodiscard]] std::size_t GetMipLevelOffset(TU32 iWidth, TU32 iHeight, TU32 iLevel) noexcept;
+
+/// @brief Get byte size of `iLevelCount` levels of tightly packed RGBA8 chain.
+[[nodiscard]] std::size_t GetMipChainSize(TU32 iWidth, TU32 iHeight, TU32 iLevelCount) noexcept;
+
+/// @brief Fill level 1 to `iLevelCount - 1` of `ioPixels`, whose level 0 is RGBA8 image of `iWidth` x `iHeight`. \n
+/// `ioPixels` must have `GetMipChainSize` bytes.
+/// Return false if size is 0 or `iLevelCount` is more than `GetMipLevelCount`.
+[[nodiscard]] bool GenerateMipChain(
+    void* ioPixels, TU32 iWidth, TU32 iHeight, TU32 iLevelCount, const DMipmapOptions& iOptions = {});
+
+/// @brief Get instruction set level of kernel which `GenerateMipChain` uses.
+[[nodiscard]] ESimdLevel GetMipmapSimdLevel() noexcept;
+
+/// @brief Use kernel of `iLevel` or lower level which CPU supports. Used to compare kernels.
+void SetMipmapSimdLevel(ESimdLevel iLevel) noexcept;
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_HELPER_MIPMAP_H
@@ -0,0 +1,105 @@
+#ifndef GUARD_DY_HELPER_TYPE_HELPER_OBJ_STREAM_H
+#define GUARD_DY_HELPER_TYPE_HELPER_OBJ_STREAM_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cstddef>
+#include <string>
+#include "FGlobalType.h"
+#include "Type/DAabb.h"
+#include "Type/DVector2.h"
+#include "Type/DVector3.h"
+
+//!
+//! Streaming Wavefront OBJ reader, which reads file in fixed-size chunks and deduplicates
+//! face corners on the fly by their (position, texture coordinate) index pair.
+//! Only positions and texture coordinates of `v`, `vt` and `f` lines are read, and polygons
+//! are triangulated as fan. Positions and texture coordinates of file must be kept because
+//! faces may reference any of them, but expanded corners and whole vertex arrays are not.
+//! Unique vertices and indices are written to sink in batches, in order of first use.
+//! Chunk is split at newlines into ranges which are parsed independently, and parsed ranges are
+//! stitched in file order, so relative indices are resolved with prefix-summed attribute counts.
+//! Parallel reader shards vertex table by hash of corner, same to DeduplicateVerticesParallel.
+//!
+
+namespace dy
+{
+
+/// @struct DObjVertex
+/// @brief Vertex of OBJ file read by ReadObjStream. Missing texture coordinate is (0, 0).
+struct DObjVertex final
+{
+  DVector3 mPosition;
+  DVector2 mTextureUv0;
+};
+
+/// @class IObjStreamSink
+/// @brief Receiver of vertices and triangle indices of ReadObjStream. \n
+/// Vertices are numbered in order they are written, and indices only reference written vertices.
+class IObjStreamSink
+{
+public:
+  virtual ~IObjStreamSink() = default;
+
+  /// @brief Receive `iCount` new vertices. Return false to stop reading.
+  virtual bool WriteVertices(const DObjVertex* iVertices, std::size_t iCount) = 0;
+
+  /// @brief Receive `iCount` indices of triangles. Return false to stop reading.
+  virtual bool WriteIndices(const TU32* iIndices, std::size_t iCount) = 0;
+};
+
+/// @struct DObjStreamOptions
+/// @brief Buffer sizes and memory ceiling of ReadObjStream.
+struct DObjStreamOptions final
+{
+  /// Byte size of file chunk read at once for each thread. Line must be shorter than chunk.
+  std::size_t mChunkSize      = 1 << 20;
+  /// Count of vertices and of indices buffered before they are written to sink.
+  std::size_t mBatchCount     = 1 << 14;
+  /// Largest byte size of memory held by reader, 0 is unlimited. Reading fails when it is exceeded after chunk.
+  std::size_t mMaxMemorySize  = 0;
+};
+
+/// @struct DObjStreamStats
+/// @brief Counts and memory usage of ReadObjStream.
+struct DObjStreamStats final
+{
+  TU64  mPositionCount  = 0;
+  TU64  mUvCount        = 0;
+  TU64  mCornerCount    = 0;
+  TU64  mVertexCount    = 0;
+  TU64  mIndexCount     = 0;
+  /// Largest byte size of memory held by reader, which is sum of capacities of its buffers.
+  TU64  mPeakMemorySize = 0;
+  /// Bounds of all positions of file.
+  DAabb mBounds         = {};
+};
+
+/// @brief Read OBJ file of `iPath` and write its unique vertices and triangle indices to `ioSink`. \n
+/// Return false if file can not be read, is malformed, exceeds memory ceiling or sink stops reading.
+/// Reason of failure is written to `outError` if it is not null.
+[[nodiscard]] bool ReadObjStream(
+    const std::string& iPath, IObjStreamSink& ioSink, const DObjStreamOptions& iOptions = {},
+    DObjStreamStats* outStats = nullptr, std::string* outError = nullptr);
+
+/// @brief Multi-threaded version of `ReadObjStream`, result is same to it. \n
+/// Each chunk is split into `iThreadCount` ranges which are parsed in parallel. Then corners of chunk are
+/// resolved per range and deduplicated per hash shard of vertex table in parallel, and written to sink.
+/// Memory of chunks, parsed ranges and resolved corners grows with `iThreadCount`.
+[[nodiscard]] bool ReadObjStreamParallel(
+    const std::string& iPath, TU32 iThreadCount, IObjStreamSink& ioSink, const DObjStreamOptions& iOptions = {},
+    DObjStreamStats* outStats = nullptr, std::string* outError = nullptr);
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_HELPER_OBJ_STREAM_H
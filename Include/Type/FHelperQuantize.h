@@ -0,0 +1,58 @@
+#ifndef GUARD_DY_HELPER_TYPE_HELPER_QUANTIZE_H
+#define GUARD_DY_HELPER_TYPE_HELPER_QUANTIZE_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include "FGlobalType.h"
+
+//!
+//! Conversion between float and unsigned normalized integer of Vulkan UNORM formats.
+//! Value v of [min, max] range is stored as Unorm((v - min) / (max - min)), and
+//! dequantized by min + Unorm * (max - min) where GPU converts UNORM integer to [0, 1] float.
+//!
+
+namespace dy
+{
+
+/// @brief Quantize [0, 1] into UNORM 16-bit integer, rounding to nearest. Out of range value is clamped.
+[[nodiscard]] inline TU16 QuantizeUnorm16(float iValue) noexcept
+{
+  // Written to clamp NaN to 0 too.
+  if ((iValue > 0.0f) == false) { return 0; }
+  if (iValue >= 1.0f) { return 0xFFFF; }
+  return static_cast<TU16>(iValue * 65535.0f + 0.5f);
+}
+
+/// @brief Dequantize UNORM 16-bit integer, same to GPU conversion.
+[[nodiscard]] inline float DequantizeUnorm16(TU16 iValue) noexcept
+{
+  return static_cast<float>(iValue) / 65535.0f;
+}
+
+/// @brief Quantize [0, 1] into UNORM 8-bit integer, rounding to nearest. Out of range value is clamped.
+[[nodiscard]] inline TU08 QuantizeUnorm8(float iValue) noexcept
+{
+  if ((iValue > 0.0f) == false) { return 0; }
+  if (iValue >= 1.0f) { return 0xFF; }
+  return static_cast<TU08>(iValue * 255.0f + 0.5f);
+}
+
+/// @brief Get extent of [iMin, iMax] for quantization. Empty range returns 1 to avoid division by zero.
+[[nodiscard]] inline float GetQuantizationExtent(float iMin, float iMax) noexcept
+{
+  return iMax > iMin ? iMax - iMin : 1.0f;
+}
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_HELPER_QUANTIZE_H
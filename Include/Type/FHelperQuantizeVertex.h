@@ -0,0 +1,77 @@
+#ifndef GUARD_DY_HELPER_TYPE_HELPER_QUANTIZE_VERTEX_H
+#define GUARD_DY_HELPER_TYPE_HELPER_QUANTIZE_VERTEX_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <array>
+#include <cstddef>
+#include "FGlobalType.h"
+#include "Type/DMatrix3x4.h"
+#include "Type/DVector2.h"
+#include "Type/DVector3.h"
+#include "Type/DVector4.h"
+
+//!
+//! Quantization of mesh vertices into DCompactVertex with FHelperQuantize.h.
+//! Vulkan input descriptions of DCompactVertex are in Temp/DCompactVertex.h.
+//!
+
+namespace dy
+{
+
+/// @struct DCompactVertex
+/// @brief Quantized vertex of 16 bytes, half of DDefaultVertex. \n
+/// Position and texture coordinate are UNORM 16-bit integers normalized into bounds of mesh,
+/// and restored by DCompactVertexDequantization of that mesh.
+struct DCompactVertex final
+{
+  /// Position (x, y, z) in mesh bounds. W is not read, and keeps texture coordinate 4 bytes aligned.
+  std::array<TU16, 4> mPosition;
+  /// Texture coordinate in mesh texture coordinate bounds.
+  std::array<TU16, 2> mTextureUv0;
+  /// Packed RGBA8 base color.
+  std::array<TU08, 4> mBaseColor;
+};
+
+static_assert(sizeof(DCompactVertex) == 16, "DCompactVertex must be 16 bytes.");
+
+/// @struct DCompactVertexDequantization
+/// @brief Per-mesh transform from quantized values of DCompactVertex to original values.
+/// Default value is identity, which is used for DDefaultVertex. \n
+/// Axis of which extent is zero has scale 1, so its vertices are restored to offset exactly.
+struct DCompactVertexDequantization final
+{
+  DVector3 mPositionOffset{0.0f};
+  DVector3 mPositionScale{1.0f};
+  DVector2 mUvOffset{0.0f};
+  DVector2 mUvScale{1.0f};
+
+  /// @brief Get affine matrix from normalized position to local position. \n
+  /// Multiply it on the right of model matrix, then shader does not need to dequantize position.
+  [[nodiscard]] DMatrix3x4 GetPositionMatrix() const noexcept;
+
+  /// @brief Get (scale.x, scale.y, offset.x, offset.y), which is `uTextureUvTransform` of shader.
+  [[nodiscard]] DVector4 GetUvTransform() const noexcept;
+};
+
+/// @brief Quantize `iVertexCount` vertices into `outVertices` over their position and texture coordinate bounds. \n
+/// `iPositions`, `iBaseColors` and `iUvs` point (x, y, z), (r, g, b) and (u, v) of first vertex,
+/// and vertices are `iVertexStride` bytes apart.
+/// `outVertices` may be mapped device memory, because it is only written in order.
+DCompactVertexDequantization QuantizeVertices(
+    const float* iPositions, const float* iBaseColors, const float* iUvs, std::size_t iVertexStride,
+    TU32 iVertexCount, DCompactVertex* outVertices);
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_HELPER_QUANTIZE_VERTEX_H
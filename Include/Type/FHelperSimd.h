@@ -0,0 +1,99 @@
+#ifndef GUARD_DY_HELPER_TYPE_HELPER_SIMD_H
+#define GUARD_DY_HELPER_TYPE_HELPER_SIMD_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include "ASimdInclude.h"
+
+namespace dy::simd
+{
+
+/// @brief Broadcast `TIndex`th element of given vector to all elements.
+template <int TIndex>
+inline __m128 Splat(const __m128& iVector) noexcept
+{
+  return _mm_shuffle_ps(iVector, iVector, _MM_SHUFFLE(TIndex, TIndex, TIndex, TIndex));
+}
+
+/// @brief Shuffle two vectors as (lhs[X], lhs[Y], rhs[Z], rhs[W]).
+template <int TX, int TY, int TZ, int TW>
+inline __m128 Shuffle(const __m128& lhs, const __m128& rhs) noexcept
+{
+  return _mm_shuffle_ps(lhs, rhs, _MM_SHUFFLE(TW, TZ, TY, TX));
+}
+
+/// @brief a * b + c. Fused when MDY_SIMD_FMA is defined.
+inline __m128 MulAdd(const __m128& a, const __m128& b, const __m128& c) noexcept
+{
+#if defined(MDY_SIMD_FMA)
+  return _mm_fmadd_ps(a, b, c);
+#else
+  return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+#if defined(MDY_SIMD_AVX)
+/// @brief a * b + c. Fused when MDY_SIMD_FMA is defined.
+inline __m256 MulAdd(const __m256& a, const __m256& b, const __m256& c) noexcept
+{
+#if defined(MDY_SIMD_FMA)
+  return _mm256_fmadd_ps(a, b, c);
+#else
+  return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+}
+#endif
+
+/// @brief Return horizontal sum of `a * b` broadcasted to all elements.
+/// Shuffle and add are used instead of SSE3 hadd or SSE4.1 dp.
+inline __m128 Dot4(const __m128& a, const __m128& b) noexcept
+{
+  const __m128 product = _mm_mul_ps(a, b);
+  const __m128 pair = _mm_add_ps(product, Shuffle<1, 0, 3, 2>(product, product));
+  return _mm_add_ps(pair, Shuffle<2, 3, 0, 1>(pair, pair));
+}
+
+/// @brief Flip sign of each element when corresponding bit of `TMask` (x = 1, y = 2, z = 4, w = 8) is set.
+template <int TMask>
+inline __m128 FlipSign(const __m128& iVector) noexcept
+{
+  const __m128 sign = _mm_castsi128_ps(_mm_set_epi32(
+      (TMask & 8) ? int(0x80000000) : 0, (TMask & 4) ? int(0x80000000) : 0,
+      (TMask & 2) ? int(0x80000000) : 0, (TMask & 1) ? int(0x80000000) : 0));
+  return _mm_xor_ps(iVector, sign);
+}
+
+/// @brief Transpose 4 packed (x, y, z) triples as 3 vectors into (x0..x3), (y0..y3), (z0..z3).
+/// Input is (x0 y0 z0 x1), (y1 z1 x2 y2), (z2 x3 y3 z3), and can be loaded from DVector3 array.
+inline void TransposeAosToSoa3(
+    const __m128& v0, const __m128& v1, const __m128& v2,
+    __m128& outX, __m128& outY, __m128& outZ) noexcept
+{
+  outX = Shuffle<0, 3, 0, 2>(v0, Shuffle<2, 2, 1, 1>(v1, v2));
+  outY = Shuffle<0, 2, 0, 2>(Shuffle<1, 1, 0, 0>(v0, v1), Shuffle<3, 3, 2, 2>(v1, v2));
+  outZ = Shuffle<0, 2, 0, 3>(Shuffle<2, 2, 1, 1>(v0, v1), v2);
+}
+
+/// @brief Inverse of `TransposeAosToSoa3`.
+inline void TransposeSoaToAos3(
+    const __m128& x, const __m128& y, const __m128& z,
+    __m128& outV0, __m128& outV1, __m128& outV2) noexcept
+{
+  outV0 = Shuffle<0, 2, 0, 2>(Shuffle<0, 0, 0, 0>(x, y), Shuffle<0, 0, 1, 1>(z, x));
+  outV1 = Shuffle<0, 2, 0, 2>(Shuffle<1, 1, 1, 1>(y, z), Shuffle<2, 2, 2, 2>(x, y));
+  outV2 = Shuffle<0, 2, 0, 2>(Shuffle<2, 2, 3, 3>(z, x), Shuffle<3, 3, 3, 3>(y, z));
+}
+
+} /// ::dy::simd namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_HELPER_SIMD_H
@@ -0,0 +1,72 @@
+#ifndef GUARD_DY_HELPER_TYPE_HELPER_SIMPLIFY_H
+#define GUARD_DY_HELPER_TYPE_HELPER_SIMPLIFY_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cstddef>
+#include <vector>
+#include "FGlobalType.h"
+
+//!
+//! Quadric error metric simplification (Garland and Heckbert 1998) of indexed triangle list.
+//! Quadrics are built in 5D of position and weighted texture coordinate, so collapses which
+//! stretch texture are as expensive as collapses which move surface.
+//! Vertex is collapsed onto its neighbor vertex (half-edge collapse), so simplified indices
+//! reference the same vertex buffer and every LOD can share it.
+//! Vertices on open borders, UV seams and non-manifold edges are never removed.
+//!
+
+namespace dy
+{
+
+/// @struct DMeshLod
+/// @brief Level of detail of mesh, which is range of shared index buffer and its meshlets.
+struct DMeshLod final
+{
+  TU32  mFirstIndex   = 0;
+  TU32  mIndexCount   = 0;
+  /// Meshlets of LOD, filled by caller after meshlets are built.
+  TU32  mFirstMeshlet = 0;
+  TU32  mMeshletCount = 0;
+  /// Geometric error from source mesh estimated by quadrics, in model space unit.
+  float mError        = 0.0f;
+};
+
+/// @brief Default LOD count including source mesh, and triangle ratio of each LOD to previous one.
+constexpr TU32  kDefaultMaxLodCount = 6;
+constexpr float kDefaultLodReduction = 0.5f;
+
+/// @brief Simplify triangle list to `iTargetIndexCount` indices or less, while error is under `iTargetError`. \n
+/// `iPositions` and `iUvs` point (x, y, z) and (u, v) of first vertex, and vertices are `iVertexStride` bytes apart.
+/// Texture coordinate is multiplied by `iUvWeight` to be compared with position.
+/// Error of result is written to `outError` if it is not null.
+[[nodiscard]] std::vector<TU32> SimplifyMesh(
+    const TU32* iIndices, std::size_t iIndexCount,
+    const float* iPositions, const float* iUvs, std::size_t iVertexStride, TU32 iVertexCount,
+    std::size_t iTargetIndexCount, float iTargetError, float iUvWeight, float* outError = nullptr);
+
+/// @brief Build LOD chain of triangle list into `outIndices` and `outLods`, of which first LOD is source indices. \n
+/// Each LOD is simplified from source mesh to `iReduction` of triangles of previous LOD, and is reordered
+/// by OptimizeVertexCache. Chain ends at `iMaxLodCount` LODs, or when simplification stops making progress.
+void BuildLodChain(
+    const TU32* iIndices, std::size_t iIndexCount,
+    const float* iPositions, const float* iUvs, std::size_t iVertexStride, TU32 iVertexCount, float iUvWeight,
+    std::vector<TU32>& outIndices, std::vector<DMeshLod>& outLods,
+    TU32 iMaxLodCount = kDefaultMaxLodCount, float iReduction = kDefaultLodReduction);
+
+/// @brief Select coarsest LOD of which error is at most `iMaxError`. LODs must be ordered from fine to coarse.
+[[nodiscard]] TU32 SelectLod(const DMeshLod* iLods, std::size_t iLodCount, float iMaxError) noexcept;
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_HELPER_SIMPLIFY_H
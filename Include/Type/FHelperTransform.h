@@ -0,0 +1,83 @@
+#ifndef GUARD_DY_HELPER_TYPE_HELPER_TRANSFORM_H
+#define GUARD_DY_HELPER_TYPE_HELPER_TRANSFORM_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cstddef>
+#include "Type/DMatrix3x4.h"
+#include "Type/DMatrix4.h"
+#include "Type/DQuaternion.h"
+#include "Type/DVector3.h"
+
+namespace dy
+{
+
+/// @struct DVector3Stream
+/// @brief Structure-of-arrays view of (x, y, z) streams. Streams are not owned.
+struct DVector3Stream final
+{
+  float* mX = nullptr;
+  float* mY = nullptr;
+  float* mZ = nullptr;
+};
+
+/// @struct DConstVector3Stream
+/// @brief Read-only structure-of-arrays view of (x, y, z) streams. Streams are not owned.
+struct DConstVector3Stream final
+{
+  const float* mX = nullptr;
+  const float* mY = nullptr;
+  const float* mZ = nullptr;
+};
+
+/// @brief Transform `iCount` points as (x, y, z, 1) with `iMatrix`, r = M * p. \n
+/// Result w is dropped, so `iMatrix` should be affine. Result is bit-exact to DMatrix4::MultiplyVector.
+/// 4 points (SSE) or 8 points (AVX) are processed per iteration, and input and output may be same.
+void TransformPoints(
+    const DMatrix4& iMatrix,
+    const DConstVector3Stream& iPoints, std::size_t iCount, const DVector3Stream& outPoints) noexcept;
+
+/// @brief Transform `iCount` directions as (x, y, z, 0) with `iMatrix`, so translation is ignored.
+/// Input and output may be same.
+void TransformDirections(
+    const DMatrix4& iMatrix,
+    const DConstVector3Stream& iDirections, std::size_t iCount, const DVector3Stream& outDirections) noexcept;
+
+/// @brief Transform `iCount` packed DVector3 points. \n
+/// Each 4 points are transposed to (x, y, z) streams internally, so caller does not have to
+/// change 12-byte DVector3 layout. Input and output may be same.
+void TransformPoints(
+    const DMatrix4& iMatrix,
+    const DVector3* iPoints, std::size_t iCount, DVector3* outPoints) noexcept;
+
+/// @brief Transform `iCount` packed DVector3 directions. Input and output may be same.
+void TransformDirections(
+    const DMatrix4& iMatrix,
+    const DVector3* iDirections, std::size_t iCount, DVector3* outDirections) noexcept;
+
+/// @brief Build `iCount` world matrices as T * R * S from position, normalized rotation and scale arrays. \n
+/// 4 instances are composed per iteration in structure-of-arrays form and transposed into columns.
+/// Result is same to glm::translate(p) * glm::mat4_cast(r) * glm::scale(s).
+void ComposeTransforms(
+    const DVector3* iPositions, const DQuaternion* iRotations, const DVector3* iScales,
+    std::size_t iCount, DMatrix4* outMatrices) noexcept;
+
+/// @brief Build `iCount` affine T * R * S matrices into 48-byte DMatrix3x4. \n
+/// Same to DMatrix4 version, but 3 rows are stored instead of 4 columns.
+void ComposeTransforms(
+    const DVector3* iPositions, const DQuaternion* iRotations, const DVector3* iScales,
+    std::size_t iCount, DMatrix3x4* outMatrices) noexcept;
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_HELPER_TRANSFORM_H
@@ -0,0 +1,61 @@
+#ifndef GUARD_DY_HELPER_TYPE_HELPER_VECTOR_SPAN_H
+#define GUARD_DY_HELPER_TYPE_HELPER_VECTOR_SPAN_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <cstddef>
+#include "Type/DAabb.h"
+#include "Type/DVector3.h"
+#include "Type/FHelperCpuFeature.h"
+
+//!
+//! Bulk operations over packed DVector3 arrays.
+//! Kernel is selected in runtime from SSE (4 vectors), AVX2 (8 vectors) and AVX-512 (16 vectors)
+//! by CPUID, so binary does not have to be built for specific CPU.
+//! Input and output arrays may be same, but must not partially overlap.
+//!
+
+namespace dy
+{
+
+/// @brief out[i] = lhs[i] + rhs[i]
+void AddVectors(const DVector3* iLhs, const DVector3* iRhs, std::size_t iCount, DVector3* outResult) noexcept;
+
+/// @brief out[i] = vectors[i] * scale
+void ScaleVectors(const DVector3* iVectors, float iScale, std::size_t iCount, DVector3* outResult) noexcept;
+
+/// @brief out[i] = DVector3::Lerp(lhs[i], rhs[i], offset)
+void LerpVectors(const DVector3* iLhs, const DVector3* iRhs, float iOffset, std::size_t iCount, DVector3* outResult) noexcept;
+
+/// @brief out[i] = DVector3::Dot(lhs[i], rhs[i])
+void DotVectors(const DVector3* iLhs, const DVector3* iRhs, std::size_t iCount, float* outResult) noexcept;
+
+/// @brief out[i] = DVector3::Cross(lhs[i], rhs[i])
+void CrossVectors(const DVector3* iLhs, const DVector3* iRhs, std::size_t iCount, DVector3* outResult) noexcept;
+
+/// @brief out[i] = vectors[i].Normalize(). Zero vector becomes NaN like DVector3::Normalize.
+void NormalizeVectors(const DVector3* iVectors, std::size_t iCount, DVector3* outResult) noexcept;
+
+/// @brief Get component-wise min and max of `iCount` points as box.
+/// If `iCount` is 0, return default (zero) box.
+[[nodiscard]] DAabb ComputeBounds(const DVector3* iPoints, std::size_t iCount) noexcept;
+
+/// @brief Get instruction set level of kernel which span operations use.
+[[nodiscard]] ESimdLevel GetVectorSpanSimdLevel() noexcept;
+
+/// @brief Use kernel of `iLevel` or lower level which CPU supports. Used to compare kernels.
+void SetVectorSpanSimdLevel(ESimdLevel iLevel) noexcept;
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_HELPER_VECTOR_SPAN_H
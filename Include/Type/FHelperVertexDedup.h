@@ -0,0 +1,306 @@
+#ifndef GUARD_DY_HELPER_TYPE_HELPER_VERTEX_DEDUP_H
+#define GUARD_DY_HELPER_TYPE_HELPER_VERTEX_DEDUP_H
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "FGlobalType.h"
+#include "Type/FHelperHash.h"
+
+//!
+//! Vertex deduplication of expanded triangle corners into unique vertex and index arrays.
+//! Vertices are compared and hashed by object representation, so `TVertex` must be
+//! trivially copyable without padding. Bitwise comparison keeps 0.0f and -0.0f separated.
+//!
+
+namespace dy
+{
+
+/// @struct DVertexDedupStats
+/// @brief Probe statistics of vertex deduplication. Probe length 1 means found or inserted at home slot.
+struct DVertexDedupStats final
+{
+  /// Corner count looked up.
+  TU64 mLookupCount     = 0;
+  /// Unique vertex count.
+  TU64 mUniqueCount     = 0;
+  /// Sum of probe lengths of all lookups.
+  TU64 mProbeCount      = 0;
+  /// Count of probed slots held by other vertex.
+  TU64 mCollisionCount  = 0;
+  /// Longest probe length.
+  TU32 mMaxProbeLength  = 0;
+  /// Sum of slot counts of tables.
+  TU64 mCapacity        = 0;
+
+  /// @brief Get average probe length per lookup.
+  [[nodiscard]] TF64 GetAverageProbeLength() const noexcept
+  {
+    return this->mLookupCount == 0 ? 0.0 : TF64(this->mProbeCount) / TF64(this->mLookupCount);
+  }
+
+  /// @brief Accumulate statistics of other table.
+  void Merge(const DVertexDedupStats& iStats) noexcept
+  {
+    this->mLookupCount    += iStats.mLookupCount;
+    this->mUniqueCount    += iStats.mUniqueCount;
+    this->mProbeCount     += iStats.mProbeCount;
+    this->mCollisionCount += iStats.mCollisionCount;
+    this->mMaxProbeLength = std::max(this->mMaxProbeLength, iStats.mMaxProbeLength);
+    this->mCapacity       += iStats.mCapacity;
+  }
+};
+
+/// @class FVertexHashTable
+/// @brief Open-addressing table with linear probing of indices into external vertex storage. \n
+/// Slot keeps upper 32 bits of hash as tag, so vertices are compared only when tags are same.
+/// Table grows to keep load factor under 1/2.
+template <typename TVertex>
+class FVertexHashTable final
+{
+  static_assert(std::is_trivially_copyable_v<TVertex> == true, "TVertex must be trivially copyable.");
+
+public:
+  explicit FVertexHashTable(std::size_t iExpectedCount = 0)
+  {
+    std::size_t capacity = 16;
+    while (capacity < iExpectedCount * 2) { capacity <<= 1; }
+    this->mSlots.assign(capacity, DSlot{});
+  }
+
+  /// @brief Find `iVertex` of `iHash` and return its index in `iStorage`. \n
+  /// If not found, `iNewIndex` is inserted and returned, so caller must append `iVertex` to storage
+  /// at `iNewIndex`. Find and insert share one probe sequence.
+  TU32 InsertOrGet(const TVertex& iVertex, TU64 iHash, TU32 iNewIndex, const TVertex* iStorage)
+  {
+    if ((this->mCount + 1) * 2 > this->mSlots.size()) { this->Grow(iStorage); }
+
+    const std::size_t mask = this->mSlots.size() - 1;
+    const TU32 tag = static_cast<TU32>(iHash >> 32);
+    TU32 probeLength = 1;
+    for (std::size_t slot = static_cast<std::size_t>(iHash) & mask; ; slot = (slot + 1) & mask, ++probeLength)
+    {
+      DSlot& item = this->mSlots[slot];
+      if (item.mIndex == kEmpty)
+      {
+        item = DSlot{tag, iNewIndex};
+        ++this->mCount;
+        ++this->mStats.mUniqueCount;
+        this->Record(probeLength);
+        return iNewIndex;
+      }
+      if (item.mTag == tag && std::memcmp(&iStorage[item.mIndex], &iVertex, sizeof(TVertex)) == 0)
+      {
+        this->Record(probeLength);
+        return item.mIndex;
+      }
+      ++this->mStats.mCollisionCount;
+    }
+  }
+
+  /// @brief Get probe statistics.
+  [[nodiscard]] DVertexDedupStats GetStats() const noexcept
+  {
+    auto stats = this->mStats;
+    stats.mCapacity = this->mSlots.size();
+    return stats;
+  }
+
+private:
+  static constexpr TU32 kEmpty = 0xFFFFFFFF;
+
+  struct DSlot final
+  {
+    TU32 mTag   = 0;
+    TU32 mIndex = kEmpty;
+  };
+
+  void Record(TU32 iProbeLength) noexcept
+  {
+    ++this->mStats.mLookupCount;
+    this->mStats.mProbeCount += iProbeLength;
+    this->mStats.mMaxProbeLength = std::max(this->mStats.mMaxProbeLength, iProbeLength);
+  }
+
+  /// @brief Double slots and reinsert items. Hashes are recomputed from `iStorage`.
+  void Grow(const TVertex* iStorage)
+  {
+    std::vector<DSlot> slots(this->mSlots.size() * 2);
+    const std::size_t mask = slots.size() - 1;
+    for (const auto& item : this->mSlots)
+    {
+      if (item.mIndex == kEmpty) { continue; }
+      std::size_t slot = static_cast<std::size_t>(HashObject(iStorage[item.mIndex])) & mask;
+      while (slots[slot].mIndex != kEmpty) { slot = (slot + 1) & mask; }
+      slots[slot] = item;
+    }
+    this->mSlots = std::move(slots);
+  }
+
+  std::vector<DSlot> mSlots;
+  std::size_t mCount = 0;
+  DVertexDedupStats mStats = {};
+};
+
+/// @brief Deduplicate `iCount` corners into unique vertices and per-corner indices. \n
+/// Unique vertices are ordered by first appearance.
+template <typename TVertex>
+void DeduplicateVertices(
+    const TVertex* iCorners, std::size_t iCount,
+    std::vector<TVertex>& outVertices, std::vector<TU32>& outIndices,
+    DVertexDedupStats* outStats = nullptr)
+{
+  outVertices.clear();
+  outIndices.resize(iCount);
+
+  // Most meshes share each vertex among 4 ~ 6 corners.
+  FVertexHashTable<TVertex> table{iCount / 4};
+  for (std::size_t i = 0; i < iCount; ++i)
+  {
+    const TU32 newIndex = static_cast<TU32>(outVertices.size());
+    outIndices[i] = table.InsertOrGet(iCorners[i], HashObject(iCorners[i]), newIndex, outVertices.data());
+    if (outIndices[i] == newIndex) { outVertices.push_back(iCorners[i]); }
+  }
+
+  if (outStats != nullptr) { *outStats = table.GetStats(); }
+}
+
+/// @brief Multi-threaded version of `DeduplicateVertices`, result is same to it. \n
+/// Corners are sharded by hash, and each of `iThreadCount` threads deduplicates one shard
+/// into first corner index of each vertex. Then unique vertices are numbered in corner order,
+/// so result does not depend on thread scheduling.
+template <typename TVertex>
+void DeduplicateVerticesParallel(
+    const TVertex* iCorners, std::size_t iCount, TU32 iThreadCount,
+    std::vector<TVertex>& outVertices, std::vector<TU32>& outIndices,
+    DVertexDedupStats* outStats = nullptr)
+{
+  if (iThreadCount <= 1) { DeduplicateVertices(iCorners, iCount, outVertices, outIndices, outStats); return; }
+  // Shard index is stored as 8 bits.
+  iThreadCount = std::min<TU32>(iThreadCount, 256);
+
+  // Call `iFunction(thread, begin, end)` over contiguous ranges of corners and join.
+  const auto parallelFor = [iCount, iThreadCount](auto&& iFunction)
+  {
+    std::vector<std::thread> threads;
+    threads.reserve(iThreadCount);
+    for (TU32 thread = 0; thread < iThreadCount; ++thread)
+    {
+      threads.emplace_back(iFunction, thread, iCount * thread / iThreadCount, iCount * (thread + 1) / iThreadCount);
+    }
+    for (auto& thread : threads) { thread.join(); }
+  };
+
+  // (1) Hash corners and count corners of each shard in each range.
+  // Shard is taken from bits 24 ~ 31, above slot bits of tables under 16M slots.
+  std::vector<TU64> hashes(iCount);
+  std::vector<TU08> shards(iCount);
+  std::vector<TU32> shardCounts(std::size_t{iThreadCount} * iThreadCount, 0);
+  parallelFor([&](TU32 iThread, std::size_t iBegin, std::size_t iEnd)
+  {
+    TU32* counts = &shardCounts[std::size_t{iThread} * iThreadCount];
+    for (std::size_t i = iBegin; i < iEnd; ++i)
+    {
+      hashes[i] = HashObject(iCorners[i]);
+      shards[i] = static_cast<TU08>(((hashes[i] >> 24) & 0xFF) * iThreadCount >> 8);
+      ++counts[shards[i]];
+    }
+  });
+
+  // (2) Group corner indices by shard. Ranges are placed in order inside of each shard,
+  // so corners of each shard stay in corner order.
+  std::vector<TU32> shardOffsets(std::size_t{iThreadCount} * iThreadCount);
+  std::vector<TU32> shardBegins(iThreadCount + 1, 0);
+  TU32 offset = 0;
+  for (TU32 shard = 0; shard < iThreadCount; ++shard)
+  {
+    shardBegins[shard] = offset;
+    for (TU32 thread = 0; thread < iThreadCount; ++thread)
+    {
+      shardOffsets[std::size_t{thread} * iThreadCount + shard] = offset;
+      offset += shardCounts[std::size_t{thread} * iThreadCount + shard];
+    }
+  }
+  shardBegins[iThreadCount] = offset;
+
+  std::vector<TU32> shardCorners(iCount);
+  parallelFor([&](TU32 iThread, std::size_t iBegin, std::size_t iEnd)
+  {
+    TU32* offsets = &shardOffsets[std::size_t{iThread} * iThreadCount];
+    for (std::size_t i = iBegin; i < iEnd; ++i) { shardCorners[offsets[shards[i]]++] = static_cast<TU32>(i); }
+  });
+
+  // (3) Each thread finds first corner of vertices in its shard. Corners of one vertex are in same shard,
+  // and they are visited in order, so first inserted corner is first appearance.
+  std::vector<TU32> firstCorners(iCount);
+  std::vector<DVertexDedupStats> stats(iThreadCount);
+  parallelFor([&](TU32 iShard, std::size_t, std::size_t)
+  {
+    const TU32 begin = shardBegins[iShard];
+    const TU32 end = shardBegins[iShard + 1];
+    FVertexHashTable<TVertex> table{(end - begin) / 4};
+    for (TU32 item = begin; item < end; ++item)
+    {
+      const TU32 i = shardCorners[item];
+      firstCorners[i] = table.InsertOrGet(iCorners[i], hashes[i], i, iCorners);
+    }
+    stats[iShard] = table.GetStats();
+  });
+
+  // (4) Number unique vertices in corner order. Count first corners of each range, and offset ranges by prefix sum.
+  std::vector<TU32> uniqueCounts(iThreadCount + 1, 0);
+  parallelFor([&](TU32 iThread, std::size_t iBegin, std::size_t iEnd)
+  {
+    TU32 count = 0;
+    for (std::size_t i = iBegin; i < iEnd; ++i) { count += firstCorners[i] == i ? 1 : 0; }
+    uniqueCounts[iThread + 1] = count;
+  });
+  for (TU32 thread = 0; thread < iThreadCount; ++thread) { uniqueCounts[thread + 1] += uniqueCounts[thread]; }
+
+  outVertices.resize(uniqueCounts[iThreadCount]);
+  outIndices.resize(iCount);
+  parallelFor([&](TU32 iThread, std::size_t iBegin, std::size_t iEnd)
+  {
+    TU32 uniqueIndex = uniqueCounts[iThread];
+    for (std::size_t i = iBegin; i < iEnd; ++i)
+    {
+      if (firstCorners[i] != i) { continue; }
+      outVertices[uniqueIndex] = iCorners[i];
+      outIndices[i] = uniqueIndex++;
+    }
+  });
+
+  // (5) Other corners refer index of its first corner, which is always assigned in (3).
+  parallelFor([&](TU32, std::size_t iBegin, std::size_t iEnd)
+  {
+    for (std::size_t i = iBegin; i < iEnd; ++i)
+    {
+      if (firstCorners[i] != i) { outIndices[i] = outIndices[firstCorners[i]]; }
+    }
+  });
+
+  if (outStats != nullptr)
+  {
+    *outStats = {};
+    for (const auto& item : stats) { outStats->Merge(item); }
+  }
+}
+
+} /// ::dy namespace
+
+#endif /// GUARD_DY_HELPER_TYPE_HELPER_VERTEX_DEDUP_H
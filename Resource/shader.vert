@@ -10,16 +10,19 @@ layout(location = 1) out vec2 textureUv0;
 
 layout(binding = 0) uniform DyUniformBufferObject 
 {
-	mat4 uModel;
+	// Rows of affine model matrix (dy::DMatrix3x4), so vec4(p, 1.0) * uModel is world position.
+	mat3x4 uModel;
 	mat4 uView;
 	mat4 uProj;
+	// (scale.x, scale.y, offset.x, offset.y) of texture coordinate, which dequantizes UNORM coordinate.
+	vec4 uTextureUvTransform;
 } uniUbo;
 
-mat4 DyGetPVM() { return uniUbo.uProj * uniUbo.uView * uniUbo.uModel; }
+mat4 DyGetPV() { return uniUbo.uProj * uniUbo.uView; }
 
 void main() 
 {
-    gl_Position = DyGetPVM() * vec4(inPosition, 1.0);
+    gl_Position = DyGetPV() * vec4(vec4(inPosition, 1.0) * uniUbo.uModel, 1.0);
     fragColor = inBaseColor;
-	textureUv0 = inTextureUv0;
+	textureUv0 = inTextureUv0 * uniUbo.uTextureUvTransform.xy + uniUbo.uTextureUvTransform.zw;
 }
\ No newline at end of file
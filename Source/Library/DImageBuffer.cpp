@@ -13,6 +13,63 @@
 
 #include "Library/DImageBuffer.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+namespace
+{
+
+/// @struct DDirectOutput
+/// @brief Caller memory of DecodeImageInto on this thread.
+/// It is handed to stb_image as allocation of same size, which is its output image.
+struct DDirectOutput final
+{
+  unsigned char*  mPixels = nullptr;
+  std::size_t     mSize   = 0;
+  bool            mIsUsed = false;
+};
+thread_local DDirectOutput sDirectOutput;
+
+void* AllocateImageMemory(std::size_t iSize)
+{
+  if (sDirectOutput.mPixels != nullptr && sDirectOutput.mIsUsed == false && iSize == sDirectOutput.mSize)
+  {
+    sDirectOutput.mIsUsed = true;
+    return sDirectOutput.mPixels;
+  }
+  return std::malloc(iSize);
+}
+
+void* ReallocateImageMemory(void* iMemory, std::size_t iSize)
+{
+  if (iMemory == nullptr || iMemory != sDirectOutput.mPixels) { return std::realloc(iMemory, iSize); }
+
+  // Caller memory can not grow, so it is moved to heap.
+  void* memory = std::malloc(iSize);
+  if (memory == nullptr) { return nullptr; }
+  std::memcpy(memory, iMemory, std::min(iSize, sDirectOutput.mSize));
+  sDirectOutput.mIsUsed = false;
+  return memory;
+}
+
+void FreeImageMemory(void* iMemory)
+{
+  if (iMemory != nullptr && iMemory == sDirectOutput.mPixels) { sDirectOutput.mIsUsed = false; return; }
+  std::free(iMemory);
+}
+
+} /// anonymous namespace
+
+// Allocations of stb_image go through functions above, so image can be decoded into caller memory
+// without copy when its output is allocated while caller memory is not used by stb_image.
+#define STBI_MALLOC(__MASize__)                 AllocateImageMemory(__MASize__)
+#define STBI_REALLOC(__MAMemory__, __MASize__)  ReallocateImageMemory(__MAMemory__, __MASize__)
+#define STBI_FREE(__MAMemory__)                 FreeImageMemory(__MAMemory__)
+// Failure reason of stb_image is process-wide state written whenever a format probe fails,
+// so it is disabled for images to be decoded on several threads. It is not read anyway.
+#define STBI_NO_FAILURE_STRINGS
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 #include "System/AAssertion.h"
@@ -20,6 +77,10 @@
 namespace
 {
 
+/// stbi__err function is not called when failure strings are disabled, so it is referenced here
+/// not to be reported as unused function. (Function-like macro is not expanded without parentheses.)
+[[maybe_unused]] const auto sStbiErrorFunction = &stbi__err;
+
 /// @brief Return color format
 /// @param[in] channelsValue Color channels value for being used to get GL_COLOR channels.
 dy::EImageColorFormatStyle GetColorFormat(const int32_t channelsValue) noexcept 
@@ -38,14 +99,24 @@ dy::EImageColorFormatStyle GetColorFormat(const int32_t channelsValue) noexcept
   }
 }
 
+/// @brief Swap rows of `iHeight` rows of `iRowSize` bytes to reverse their order.
+void FlipRows(unsigned char* ioBuffer, std::size_t iRowSize, std::size_t iHeight) noexcept
+{
+  if (iHeight < 2) { return; }
+  for (std::size_t top = 0, bottom = iHeight - 1; top < bottom; ++top, --bottom)
+  {
+    std::swap_ranges(ioBuffer + top * iRowSize, ioBuffer + (top + 1) * iRowSize, ioBuffer + bottom * iRowSize);
+  }
+}
+
 }
 
 namespace dy
 {
 
-DDyImageBinaryDataBuffer::DDyImageBinaryDataBuffer(const std::string& imagePath)
+DDyImageBinaryDataBuffer::DDyImageBinaryDataBuffer(const std::string& imagePath, bool iIsFlipVertically)
 {
-  stbi_set_flip_vertically_on_load(true);
+  // stbi_set_flip_vertically_on_load is process-wide, so rows are flipped here instead.
   this->mBufferStartPoint = stbi_load(
       imagePath.c_str(), 
       &this->mWidth, &this->mHeight, 
@@ -60,6 +131,34 @@ DDyImageBinaryDataBuffer::DDyImageBinaryDataBuffer(const std::string& imagePath)
   }
   else if (this->mBufferStartPoint == nullptr)  { this->mIsBufferCreatedProperly = false; }
   else                                          { this->mIsBufferCreatedProperly = true; }
+
+  if (this->mIsBufferCreatedProperly == true && iIsFlipVertically == true)
+  {
+    FlipRows(this->mBufferStartPoint, std::size_t(this->mWidth) * 4, std::size_t(this->mHeight));
+  }
+}
+
+DDyImageBinaryDataBuffer::DDyImageBinaryDataBuffer(DDyImageBinaryDataBuffer&& ioSource) noexcept
+  : mImageChannel{ioSource.mImageChannel},
+    mWidth{ioSource.mWidth},
+    mHeight{ioSource.mHeight},
+    mImageFormat{ioSource.mImageFormat},
+    mBufferStartPoint{std::exchange(ioSource.mBufferStartPoint, nullptr)},
+    mIsBufferCreatedProperly{std::exchange(ioSource.mIsBufferCreatedProperly, false)}
+{ }
+
+DDyImageBinaryDataBuffer& DDyImageBinaryDataBuffer::operator=(DDyImageBinaryDataBuffer&& ioSource) noexcept
+{
+  if (this == &ioSource) { return *this; }
+  if (this->mIsBufferCreatedProperly == true) { stbi_image_free(this->mBufferStartPoint); }
+
+  this->mImageChannel             = ioSource.mImageChannel;
+  this->mWidth                    = ioSource.mWidth;
+  this->mHeight                   = ioSource.mHeight;
+  this->mImageFormat              = ioSource.mImageFormat;
+  this->mBufferStartPoint         = std::exchange(ioSource.mBufferStartPoint, nullptr);
+  this->mIsBufferCreatedProperly  = std::exchange(ioSource.mIsBufferCreatedProperly, false);
+  return *this;
 }
 
 DDyImageBinaryDataBuffer::~DDyImageBinaryDataBuffer()
@@ -70,4 +169,46 @@ DDyImageBinaryDataBuffer::~DDyImageBinaryDataBuffer()
   }
 }
 
+bool GetImageSize(const std::string& iImagePath, TI32& outWidth, TI32& outHeight)
+{
+  TI32 channel = 0;
+  return stbi_info(iImagePath.c_str(), &outWidth, &outHeight, &channel) == 1;
+}
+
+bool DecodeImageInto(
+    const std::string& iImagePath, bool iIsFlipVertically, void* outPixels, std::size_t iSize, bool* outIsDirect)
+{
+  auto* const outBuffer = static_cast<unsigned char*>(outPixels);
+  TI32 width = 0, height = 0, channel = 0;
+  sDirectOutput = {outBuffer, iSize, false};
+  unsigned char* const pixels = stbi_load(iImagePath.c_str(), &width, &height, &channel, STBI_rgb_alpha);
+  sDirectOutput = {};
+  if (pixels == nullptr) { return false; }
+  if (outIsDirect != nullptr) { *outIsDirect = pixels == outBuffer; }
+
+  const std::size_t rowSize = std::size_t(width) * 4;
+  if (rowSize * std::size_t(height) != iSize)
+  {
+    // Caller memory is not tracked anymore, so it must not be freed.
+    if (pixels != outBuffer) { stbi_image_free(pixels); }
+    return false;
+  }
+
+  // Output of stb_image is caller memory itself, flip it in place if needed.
+  if (pixels == outBuffer)
+  {
+    if (iIsFlipVertically == true) { FlipRows(outBuffer, rowSize, std::size_t(height)); }
+    return true;
+  }
+
+  // Otherwise, output was allocated while caller memory was used by stb_image. Copy rows in order.
+  for (std::size_t y = 0; y < std::size_t(height); ++y)
+  {
+    const std::size_t sourceRow = iIsFlipVertically == true ? std::size_t(height) - 1 - y : y;
+    std::memcpy(outBuffer + y * rowSize, pixels + sourceRow * rowSize, rowSize);
+  }
+  stbi_image_free(pixels);
+  return true;
+}
+
 } /// ::dy namespace
\ No newline at end of file
@@ -0,0 +1,129 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include "Library/DMappedFile.h"
+
+#include <utility>
+#if defined(_WIN32) == true
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace dy
+{
+
+#if defined(_WIN32) == true
+
+DMappedFile::DMappedFile(const std::string& iFilePath)
+{
+  this->mFileHandle = CreateFileA(iFilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (this->mFileHandle == INVALID_HANDLE_VALUE) { this->mFileHandle = nullptr; return; }
+
+  LARGE_INTEGER size;
+  if (GetFileSizeEx(this->mFileHandle, &size) == FALSE || size.QuadPart == 0) { this->Release(); return; }
+
+  this->mMappingHandle = CreateFileMappingA(this->mFileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (this->mMappingHandle == nullptr) { this->Release(); return; }
+
+  this->mData = static_cast<const unsigned char*>(MapViewOfFile(this->mMappingHandle, FILE_MAP_READ, 0, 0, 0));
+  if (this->mData == nullptr) { this->Release(); return; }
+  this->mSize = static_cast<TU64>(size.QuadPart);
+}
+
+void DMappedFile::Release() noexcept
+{
+  if (this->mData != nullptr)           { UnmapViewOfFile(this->mData); }
+  if (this->mMappingHandle != nullptr)  { CloseHandle(this->mMappingHandle); }
+  if (this->mFileHandle != nullptr)     { CloseHandle(this->mFileHandle); }
+  this->mData = nullptr;
+  this->mSize = 0;
+  this->mMappingHandle = nullptr;
+  this->mFileHandle = nullptr;
+}
+
+DMappedFile::DMappedFile(DMappedFile&& ioSource) noexcept
+  : mData{std::exchange(ioSource.mData, nullptr)},
+    mSize{std::exchange(ioSource.mSize, 0)},
+    mFileHandle{std::exchange(ioSource.mFileHandle, nullptr)},
+    mMappingHandle{std::exchange(ioSource.mMappingHandle, nullptr)}
+{ }
+
+DMappedFile& DMappedFile::operator=(DMappedFile&& ioSource) noexcept
+{
+  if (this == &ioSource) { return *this; }
+  this->Release();
+  this->mData           = std::exchange(ioSource.mData, nullptr);
+  this->mSize           = std::exchange(ioSource.mSize, 0);
+  this->mFileHandle     = std::exchange(ioSource.mFileHandle, nullptr);
+  this->mMappingHandle  = std::exchange(ioSource.mMappingHandle, nullptr);
+  return *this;
+}
+
+#else
+
+DMappedFile::DMappedFile(const std::string& iFilePath)
+{
+  const int fileDescriptor = open(iFilePath.c_str(), O_RDONLY);
+  if (fileDescriptor == -1) { return; }
+
+  // Mapping keeps its own reference of file, so descriptor can be closed right after mmap.
+  struct stat status;
+  if (fstat(fileDescriptor, &status) == 0 && status.st_size > 0)
+  {
+    void* data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    if (data != MAP_FAILED)
+    {
+      this->mData = static_cast<const unsigned char*>(data);
+      this->mSize = static_cast<TU64>(status.st_size);
+    }
+  }
+  close(fileDescriptor);
+}
+
+void DMappedFile::Release() noexcept
+{
+  if (this->mData != nullptr)
+  {
+    munmap(const_cast<unsigned char*>(this->mData), static_cast<size_t>(this->mSize));
+  }
+  this->mData = nullptr;
+  this->mSize = 0;
+}
+
+DMappedFile::DMappedFile(DMappedFile&& ioSource) noexcept
+  : mData{std::exchange(ioSource.mData, nullptr)},
+    mSize{std::exchange(ioSource.mSize, 0)}
+{ }
+
+DMappedFile& DMappedFile::operator=(DMappedFile&& ioSource) noexcept
+{
+  if (this == &ioSource) { return *this; }
+  this->Release();
+  this->mData = std::exchange(ioSource.mData, nullptr);
+  this->mSize = std::exchange(ioSource.mSize, 0);
+  return *this;
+}
+
+#endif
+
+DMappedFile::~DMappedFile()
+{
+  this->Release();
+}
+
+} /// ::dy namespace
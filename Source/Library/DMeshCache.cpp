@@ -0,0 +1,406 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include "Library/DMeshCache.h"
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include "Type/FHelperHash.h"
+
+namespace
+{
+
+/// Increase when layout of `DMeshCacheHeader` or payload is changed,
+/// or when LoadModel produces different vertex and index order or upload format.
+constexpr TU32 kMeshCacheVersion = 6;
+constexpr char kMeshCacheMagic[4] = {'D', 'Y', 'M', 'C'};
+/// Vertex and meshlet bounds arrays are aligned to 16 bytes for SIMD load of DVector4 and friends.
+constexpr TU64 kPayloadAlignment = 16;
+
+//!
+//! Layout : [DMeshCacheHeader][source path][padding][vertices][padding][indices][padding][meshlet bounds][meshlets]
+//!          [submeshes][LODs]
+//!
+
+/// @struct DMeshCacheHeader
+/// @brief Header of mesh cache file. Stored as-is, so cache is only valid on the same platform.
+struct DMeshCacheHeader final
+{
+  char  mMagic[4];
+  TU32  mVersion;
+  TU32  mVertexStride;
+  TU32  mVertexCount;
+  TU32  mIndexCount;
+  TU32  mMeshletCount;
+  TU32  mLodCount;
+  TU32  mSourcePathLength;
+  TI64  mSourceModifiedTime;
+  TU64  mSourceSize;
+  TU64  mSourceHash;
+  TU64  mVertexOffset;
+  TU64  mIndexOffset;
+  TU64  mMeshletBoundsOffset;
+  TU64  mMeshletOffset;
+  TU64  mLodOffset;
+  float mBoundsMin[3];
+  float mBoundsMax[3];
+  TU32  mIndexSize;
+  TU32  mSubmeshCount;
+  TU64  mSubmeshOffset;
+  float mPositionOffset[3];
+  float mPositionScale[3];
+  float mUvOffset[2];
+  float mUvScale[2];
+};
+
+/// @struct DSourceStamp
+/// @brief Modified time and size of source file.
+struct DSourceStamp final
+{
+  TI64 mModifiedTime = 0;
+  TU64 mSize = 0;
+};
+
+/// @brief Get stamp of source file. Return false if source file is not exist.
+bool GetSourceStamp(const std::string& iSourcePath, DSourceStamp& outStamp)
+{
+  namespace fs = std::filesystem;
+  std::error_code error;
+  const auto time = fs::last_write_time(iSourcePath, error);
+  if (error) { return false; }
+  const auto size = fs::file_size(iSourcePath, error);
+  if (error) { return false; }
+
+  outStamp.mModifiedTime = static_cast<TI64>(time.time_since_epoch().count());
+  outStamp.mSize = static_cast<TU64>(size);
+  return true;
+}
+
+/// @brief Get content hash of source file. Return false if source file could not be mapped.
+bool GetSourceHash(const std::string& iSourcePath, TU64& outHash)
+{
+  const dy::DMappedFile source{iSourcePath};
+  if (source.IsMapped() == false) { return false; }
+
+  outHash = dy::HashBytes(source.GetData(), static_cast<std::size_t>(source.GetSize()));
+  return true;
+}
+
+constexpr TU64 AlignUp(TU64 iValue, TU64 iAlignment) noexcept
+{
+  return (iValue + iAlignment - 1) / iAlignment * iAlignment;
+}
+
+const DMeshCacheHeader& GetHeader(const dy::DMappedFile& iFile) noexcept
+{
+  return *reinterpret_cast<const DMeshCacheHeader*>(iFile.GetData());
+}
+
+/// @brief Check [iOffset, iOffset + iSize) is in file of `iFileSize` without overflow.
+constexpr bool IsInFile(TU64 iOffset, TU64 iSize, TU64 iFileSize) noexcept
+{
+  return iOffset <= iFileSize && iSize <= iFileSize - iOffset;
+}
+
+/// @brief Check [iFirst, iFirst + iCount) is in [0, iTotal) without overflow.
+constexpr bool IsInRange(TU64 iFirst, TU64 iCount, TU64 iTotal) noexcept
+{
+  return iFirst <= iTotal && iCount <= iTotal - iFirst;
+}
+
+/// @brief Check indices of each submesh added to its vertex offset are less than `iVertexCount`,
+/// and submeshes cover `iIndexCount` indices in order.
+template <typename TIndex>
+bool IsIndicesInVertices(
+    const TIndex* iIndices, TU32 iIndexCount, const dy::DIndexSubmesh* iSubmeshes, TU32 iSubmeshCount, TU32 iVertexCount)
+{
+  TU32 nextIndex = 0;
+  for (TU32 submeshId = 0; submeshId < iSubmeshCount; ++submeshId)
+  {
+    const auto& submesh = iSubmeshes[submeshId];
+    if (submesh.mFirstIndex != nextIndex
+    ||  IsInRange(submesh.mFirstIndex, submesh.mIndexCount, iIndexCount) == false
+    ||  submesh.mVertexOffset >= iVertexCount) { return false; }
+
+    const TU32 vertexCount = iVertexCount - submesh.mVertexOffset;
+    for (TU32 i = submesh.mFirstIndex; i < submesh.mFirstIndex + submesh.mIndexCount; ++i)
+    {
+      if (iIndices[i] >= vertexCount) { return false; }
+    }
+    nextIndex += submesh.mIndexCount;
+  }
+  return nextIndex == iIndexCount;
+}
+
+/// @brief Check mapped cache has same format and its payload is consistent, so getters can be read
+/// without bounds checks. \n
+/// Arrays must be in file and aligned to their element, indices added to vertex offset of their submesh must be
+/// less than vertex count, and submesh, meshlet and LOD ranges must be in index and meshlet arrays.
+bool IsCacheValid(const dy::DMappedFile& iFile, TU32 iVertexStride)
+{
+  if (iFile.IsMapped() == false || iFile.GetSize() < sizeof(DMeshCacheHeader)) { return false; }
+
+  const auto& header = GetHeader(iFile);
+  if (std::memcmp(header.mMagic, kMeshCacheMagic, sizeof(kMeshCacheMagic)) != 0
+  ||  header.mVersion != kMeshCacheVersion
+  ||  header.mVertexStride != iVertexStride
+  ||  (header.mIndexSize != sizeof(TU16) && header.mIndexSize != sizeof(TU32))) { return false; }
+
+  const TU64 fileSize = iFile.GetSize();
+  if (IsInFile(sizeof(DMeshCacheHeader), header.mSourcePathLength, fileSize) == false
+  ||  header.mVertexOffset % kPayloadAlignment != 0
+  ||  header.mIndexOffset % header.mIndexSize != 0
+  ||  header.mMeshletBoundsOffset % kPayloadAlignment != 0
+  ||  header.mMeshletOffset % alignof(dy::DMeshlet) != 0
+  ||  header.mSubmeshOffset % alignof(dy::DIndexSubmesh) != 0
+  ||  header.mLodOffset % alignof(dy::DMeshLod) != 0
+  ||  IsInFile(header.mVertexOffset, TU64{header.mVertexStride} * header.mVertexCount, fileSize) == false
+  ||  IsInFile(header.mIndexOffset, TU64{header.mIndexSize} * header.mIndexCount, fileSize) == false
+  ||  IsInFile(header.mMeshletBoundsOffset, sizeof(dy::DMeshletBounds) * TU64{header.mMeshletCount}, fileSize) == false
+  ||  IsInFile(header.mMeshletOffset, sizeof(dy::DMeshlet) * TU64{header.mMeshletCount}, fileSize) == false
+  ||  IsInFile(header.mSubmeshOffset, sizeof(dy::DIndexSubmesh) * TU64{header.mSubmeshCount}, fileSize) == false
+  ||  IsInFile(header.mLodOffset, sizeof(dy::DMeshLod) * TU64{header.mLodCount}, fileSize) == false) { return false; }
+
+  const auto* indices = iFile.GetData() + header.mIndexOffset;
+  const auto* submeshes = reinterpret_cast<const dy::DIndexSubmesh*>(iFile.GetData() + header.mSubmeshOffset);
+  const bool isIndicesValid = header.mIndexSize == sizeof(TU16)
+      ? IsIndicesInVertices(reinterpret_cast<const TU16*>(indices), header.mIndexCount,
+                            submeshes, header.mSubmeshCount, header.mVertexCount)
+      : IsIndicesInVertices(reinterpret_cast<const TU32*>(indices), header.mIndexCount,
+                            submeshes, header.mSubmeshCount, header.mVertexCount);
+  if (isIndicesValid == false) { return false; }
+
+  const auto* meshlets = reinterpret_cast<const dy::DMeshlet*>(iFile.GetData() + header.mMeshletOffset);
+  for (TU32 i = 0; i < header.mMeshletCount; ++i)
+  {
+    if (IsInRange(meshlets[i].mFirstIndex, TU64{meshlets[i].mTriangleCount} * 3, header.mIndexCount) == false)
+    { return false; }
+  }
+
+  const auto* lods = reinterpret_cast<const dy::DMeshLod*>(iFile.GetData() + header.mLodOffset);
+  for (TU32 i = 0; i < header.mLodCount; ++i)
+  {
+    if (IsInRange(lods[i].mFirstIndex, lods[i].mIndexCount, header.mIndexCount) == false
+    ||  IsInRange(lods[i].mFirstMeshlet, lods[i].mMeshletCount, header.mMeshletCount) == false) { return false; }
+  }
+  return true;
+}
+
+/// @brief Overwrite source stamp in header of cache file `iCachePath`. File must not be mapped.
+bool WriteSourceStamp(const std::string& iCachePath, const DSourceStamp& iStamp)
+{
+  std::fstream file{iCachePath, std::ios::binary | std::ios::in | std::ios::out};
+  if (file.is_open() == false) { return false; }
+
+  file.seekp(static_cast<std::streamoff>(offsetof(DMeshCacheHeader, mSourceModifiedTime)));
+  file.write(reinterpret_cast<const char*>(&iStamp.mModifiedTime), sizeof(iStamp.mModifiedTime));
+  return file.good();
+}
+
+} /// anonymous namespace
+
+namespace dy
+{
+
+DMeshCache::DMeshCache(const std::string& iCachePath, const std::string& iSourcePath, TU32 iVertexStride)
+  : mFile{iCachePath}
+{
+  // Check payload is not truncated or corrupted.
+  if (IsCacheValid(this->mFile, iVertexStride) == false) { return; }
+
+  const auto& header = GetHeader(this->mFile);
+  const char* sourcePath = reinterpret_cast<const char*>(this->mFile.GetData() + sizeof(DMeshCacheHeader));
+  if (iSourcePath.compare(0, std::string::npos, sourcePath, header.mSourcePathLength) != 0) { return; }
+
+  // Same stamp skips hashing of source. If file is touched or copied, compare content instead.
+  DSourceStamp stamp;
+  if (GetSourceStamp(iSourcePath, stamp) == false) { return; }
+  if (stamp.mModifiedTime != header.mSourceModifiedTime || stamp.mSize != header.mSourceSize)
+  {
+    TU64 hash = 0;
+    if (stamp.mSize != header.mSourceSize
+    ||  GetSourceHash(iSourcePath, hash) == false
+    ||  hash != header.mSourceHash) { return; }
+
+    // Content is same, so store new stamp not to hash source again on next load. Failure to write only costs
+    // hashing again. File is shared read-only while mapped on Windows, so it is unmapped while written.
+    const TU64 fileSize = this->mFile.GetSize();
+    this->mFile = DMappedFile{};
+    WriteSourceStamp(iCachePath, stamp);
+    this->mFile = DMappedFile{iCachePath};
+    if (this->mFile.GetSize() != fileSize || IsCacheValid(this->mFile, iVertexStride) == false) { return; }
+  }
+
+  this->mIsValid = true;
+}
+
+const void* DMeshCache::GetVertices() const noexcept
+{
+  return this->mFile.GetData() + GetHeader(this->mFile).mVertexOffset;
+}
+
+TU32 DMeshCache::GetVertexCount() const noexcept
+{
+  return GetHeader(this->mFile).mVertexCount;
+}
+
+const void* DMeshCache::GetIndices() const noexcept
+{
+  return this->mFile.GetData() + GetHeader(this->mFile).mIndexOffset;
+}
+
+TU32 DMeshCache::GetIndexCount() const noexcept
+{
+  return GetHeader(this->mFile).mIndexCount;
+}
+
+TU32 DMeshCache::GetIndexSize() const noexcept
+{
+  return GetHeader(this->mFile).mIndexSize;
+}
+
+const DIndexSubmesh* DMeshCache::GetSubmeshes() const noexcept
+{
+  return reinterpret_cast<const DIndexSubmesh*>(this->mFile.GetData() + GetHeader(this->mFile).mSubmeshOffset);
+}
+
+TU32 DMeshCache::GetSubmeshCount() const noexcept
+{
+  return GetHeader(this->mFile).mSubmeshCount;
+}
+
+DAabb DMeshCache::GetBounds() const noexcept
+{
+  const auto& header = GetHeader(this->mFile);
+  return DAabb{
+      DVector3{header.mBoundsMin[0], header.mBoundsMin[1], header.mBoundsMin[2]},
+      DVector3{header.mBoundsMax[0], header.mBoundsMax[1], header.mBoundsMax[2]}};
+}
+
+DCompactVertexDequantization DMeshCache::GetDequantization() const noexcept
+{
+  const auto& header = GetHeader(this->mFile);
+  DCompactVertexDequantization result;
+  result.mPositionOffset = DVector3{header.mPositionOffset[0], header.mPositionOffset[1], header.mPositionOffset[2]};
+  result.mPositionScale  = DVector3{header.mPositionScale[0], header.mPositionScale[1], header.mPositionScale[2]};
+  result.mUvOffset       = DVector2{header.mUvOffset[0], header.mUvOffset[1]};
+  result.mUvScale        = DVector2{header.mUvScale[0], header.mUvScale[1]};
+  return result;
+}
+
+const DMeshlet* DMeshCache::GetMeshlets() const noexcept
+{
+  return reinterpret_cast<const DMeshlet*>(this->mFile.GetData() + GetHeader(this->mFile).mMeshletOffset);
+}
+
+const DMeshletBounds* DMeshCache::GetMeshletBounds() const noexcept
+{
+  return reinterpret_cast<const DMeshletBounds*>(this->mFile.GetData() + GetHeader(this->mFile).mMeshletBoundsOffset);
+}
+
+TU32 DMeshCache::GetMeshletCount() const noexcept
+{
+  return GetHeader(this->mFile).mMeshletCount;
+}
+
+const DMeshLod* DMeshCache::GetLods() const noexcept
+{
+  return reinterpret_cast<const DMeshLod*>(this->mFile.GetData() + GetHeader(this->mFile).mLodOffset);
+}
+
+TU32 DMeshCache::GetLodCount() const noexcept
+{
+  return GetHeader(this->mFile).mLodCount;
+}
+
+bool DMeshCache::Write(
+    const std::string& iCachePath, const std::string& iSourcePath,
+    const void* iVertices, TU32 iVertexStride, TU32 iVertexCount,
+    const void* iIndices, TU32 iIndexSize, TU32 iIndexCount,
+    const DIndexSubmesh* iSubmeshes, TU32 iSubmeshCount,
+    const DAabb& iBounds, const DCompactVertexDequantization& iDequantization,
+    const DMeshlet* iMeshlets, const DMeshletBounds* iMeshletBounds, TU32 iMeshletCount,
+    const DMeshLod* iLods, TU32 iLodCount)
+{
+  DSourceStamp stamp;
+  TU64 hash = 0;
+  if (GetSourceStamp(iSourcePath, stamp) == false || GetSourceHash(iSourcePath, hash) == false) { return false; }
+
+  DMeshCacheHeader header = {};
+  std::memcpy(header.mMagic, kMeshCacheMagic, sizeof(kMeshCacheMagic));
+  header.mVersion             = kMeshCacheVersion;
+  header.mVertexStride        = iVertexStride;
+  header.mVertexCount         = iVertexCount;
+  header.mIndexCount          = iIndexCount;
+  header.mIndexSize           = iIndexSize;
+  header.mSubmeshCount        = iSubmeshCount;
+  header.mMeshletCount        = iMeshletCount;
+  header.mLodCount            = iLodCount;
+  header.mSourcePathLength    = static_cast<TU32>(iSourcePath.size());
+  header.mSourceModifiedTime  = stamp.mModifiedTime;
+  header.mSourceSize          = stamp.mSize;
+  header.mSourceHash          = hash;
+  header.mVertexOffset        = AlignUp(sizeof(DMeshCacheHeader) + iSourcePath.size(), kPayloadAlignment);
+  header.mIndexOffset         = AlignUp(header.mVertexOffset + TU64{iVertexStride} * iVertexCount, alignof(TU32));
+  header.mMeshletBoundsOffset = AlignUp(header.mIndexOffset + TU64{iIndexSize} * iIndexCount, kPayloadAlignment);
+  header.mMeshletOffset       = header.mMeshletBoundsOffset + sizeof(DMeshletBounds) * TU64{iMeshletCount};
+  header.mSubmeshOffset       = header.mMeshletOffset + sizeof(DMeshlet) * TU64{iMeshletCount};
+  header.mLodOffset           = header.mSubmeshOffset + sizeof(DIndexSubmesh) * TU64{iSubmeshCount};
+  for (std::size_t axis = 0; axis < 3; ++axis)
+  {
+    header.mBoundsMin[axis] = iBounds.mMin[axis];
+    header.mBoundsMax[axis] = iBounds.mMax[axis];
+    header.mPositionOffset[axis] = iDequantization.mPositionOffset[axis];
+    header.mPositionScale[axis]  = iDequantization.mPositionScale[axis];
+  }
+  for (std::size_t axis = 0; axis < 2; ++axis)
+  {
+    header.mUvOffset[axis] = iDequantization.mUvOffset[axis];
+    header.mUvScale[axis]  = iDequantization.mUvScale[axis];
+  }
+
+  const std::string temporaryPath = iCachePath + ".tmp";
+  {
+    std::ofstream file{temporaryPath, std::ios::binary | std::ios::trunc};
+    if (file.is_open() == false) { return false; }
+
+    const char padding[kPayloadAlignment] = {};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(iSourcePath.data(), static_cast<std::streamsize>(iSourcePath.size()));
+    file.write(padding, static_cast<std::streamsize>(header.mVertexOffset - sizeof(header) - iSourcePath.size()));
+    file.write(static_cast<const char*>(iVertices), static_cast<std::streamsize>(TU64{iVertexStride} * iVertexCount));
+    file.write(padding, static_cast<std::streamsize>(header.mIndexOffset - header.mVertexOffset - TU64{iVertexStride} * iVertexCount));
+    file.write(static_cast<const char*>(iIndices), static_cast<std::streamsize>(TU64{iIndexSize} * iIndexCount));
+    file.write(padding, static_cast<std::streamsize>(header.mMeshletBoundsOffset - header.mIndexOffset - TU64{iIndexSize} * iIndexCount));
+    file.write(reinterpret_cast<const char*>(iMeshletBounds), static_cast<std::streamsize>(header.mMeshletOffset - header.mMeshletBoundsOffset));
+    file.write(reinterpret_cast<const char*>(iMeshlets), static_cast<std::streamsize>(sizeof(DMeshlet) * iMeshletCount));
+    file.write(reinterpret_cast<const char*>(iSubmeshes), static_cast<std::streamsize>(sizeof(DIndexSubmesh) * iSubmeshCount));
+    file.write(reinterpret_cast<const char*>(iLods), static_cast<std::streamsize>(sizeof(DMeshLod) * iLodCount));
+    if (file.good() == false) { return false; }
+  }
+
+  std::error_code error;
+  std::filesystem::rename(temporaryPath, iCachePath, error);
+  if (error) { std::filesystem::remove(temporaryPath, error); return false; }
+  return true;
+}
+
+std::string DMeshCache::GetCachePath(const std::string& iSourcePath)
+{
+  return iSourcePath + ".dymesh";
+}
+
+} /// ::dy namespace
@@ -0,0 +1,97 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include "Library/FImageDecodePool.h"
+
+#include <algorithm>
+
+namespace dy
+{
+
+FImageDecodePool::FImageDecodePool(TU32 iThreadCount)
+{
+  const TU32 threadCount = iThreadCount > 0 ? iThreadCount : std::max(std::thread::hardware_concurrency(), 1u);
+  this->mWorkers.reserve(threadCount);
+  for (TU32 i = 0; i < threadCount; ++i)
+  {
+    this->mWorkers.emplace_back([this] { this->RunWorker(); });
+  }
+}
+
+FImageDecodePool::~FImageDecodePool()
+{
+  {
+    std::lock_guard<std::mutex> lock{this->mMutex};
+    this->mIsStopping = true;
+  }
+  this->mTaskCondition.notify_all();
+  for (auto& worker : this->mWorkers) { worker.join(); }
+}
+
+std::future<DDyImageBinaryDataBuffer> FImageDecodePool::Decode(const DImageDecodeRequest& iRequest)
+{
+  auto futures = this->Decode(std::vector<DImageDecodeRequest>{iRequest});
+  return std::move(futures.front());
+}
+
+std::vector<std::future<DDyImageBinaryDataBuffer>> FImageDecodePool::Decode(const std::vector<DImageDecodeRequest>& iRequests)
+{
+  std::vector<std::future<DDyImageBinaryDataBuffer>> futures;
+  futures.reserve(iRequests.size());
+  {
+    // Requests are queued under one lock, so batch is not interleaved with other threads' requests.
+    std::lock_guard<std::mutex> lock{this->mMutex};
+    for (const auto& request : iRequests)
+    {
+      futures.push_back(this->PushTask<DDyImageBinaryDataBuffer>([request]
+      {
+        return DDyImageBinaryDataBuffer{request.mImagePath, request.mIsFlipVertically};
+      }));
+    }
+  }
+  this->mTaskCondition.notify_all();
+  return futures;
+}
+
+std::future<bool> FImageDecodePool::DecodeInto(const DImageDecodeRequest& iRequest, void* outPixels, std::size_t iSize)
+{
+  std::future<bool> future;
+  {
+    std::lock_guard<std::mutex> lock{this->mMutex};
+    future = this->PushTask<bool>([iRequest, outPixels, iSize]
+    {
+      return DecodeImageInto(iRequest.mImagePath, iRequest.mIsFlipVertically, outPixels, iSize);
+    });
+  }
+  this->mTaskCondition.notify_one();
+  return future;
+}
+
+void FImageDecodePool::RunWorker()
+{
+  while (true)
+  {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock{this->mMutex};
+      this->mTaskCondition.wait(lock, [this] { return this->mIsStopping == true || this->mTasks.empty() == false; });
+      if (this->mTasks.empty() == true) { return; }
+
+      task = std::move(this->mTasks.front());
+      this->mTasks.pop_front();
+    }
+    task();
+  }
+}
+
+} /// ::dy namespace
@@ -12,15 +12,23 @@
 ///
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <stdexcept>
 #include <unordered_set>
 #include <chrono>
 #include <set>
+#include <optional>
+#include <future>
+#include <mutex>
+#include <thread>
 
 #include "ESuccess.h"
 #include "MVulkanRenderer.h"
 #include "FHelperVulkan.h"
 #include "FHelperFileIO.h"
+#include "Temp/DCompactVertex.h"
 #include "Temp/DDefaultVertex.h"
 #include "Temp/U0UniformBufferObject.h"
 
@@ -29,6 +37,17 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <tiny_obj_loader.h>
 #include "Library/DImageBuffer.h"
+#include "Library/FImageDecodePool.h"
+#include "Library/DMeshCache.h"
+#include "Type/DMeshRegistry.h"
+#include "Type/FHelperVectorSpan.h"
+#include "Type/FHelperIndexBuffer.h"
+#include "Type/FHelperMeshOptimize.h"
+#include "Type/FHelperMeshlet.h"
+#include "Type/FHelperMipmap.h"
+#include "Type/FHelperObjStream.h"
+#include "Type/FHelperSimplify.h"
+#include "Type/FHelperVertexDedup.h"
 #include <sstream>
 
 namespace
@@ -117,16 +136,283 @@ const std::vector<TU32> sTempIndices = {
 
 std::vector<dy::DDefaultVertex> sModelVertices = {};
 std::vector<TU32> sModelIndices = {};
+/// Vertex and index buffer contents of model in upload format, made from sModelVertices and sModelIndices
+/// by LoadModel when cache is not valid. They are released after they are uploaded.
+std::vector<TU08> sModelBufferVertices = {};
+std::vector<TU08> sModelBufferIndices = {};
+/// Memory mapped binary cache of model in upload format. When valid, vertex and index buffers are copied
+/// from cache instead of sModelBufferVertices and sModelBufferIndices, and cache is released after that.
+std::optional<dy::DMeshCache> sModelCache = std::nullopt;
+/// Vertex count of model in vertex buffer, and index count of model.
+TU32 sModelVertexCount = 0;
+TU32 sModelIndexCount = 0;
+/// Local space bounds of loaded model.
+dy::DAabb sModelBounds = {};
+/// Read model with streaming OBJ reader, which deduplicates corners on the fly, instead of tinyobj.
+constexpr bool kStreamModelObj = true;
+/// Memory ceiling of streaming OBJ reader, except sModelVertices and sModelIndices.
+constexpr std::size_t kModelStreamMemorySize = std::size_t(1) << 30;
+/// Read model with `ReadObjStreamParallel` on hardware threads. Off until parallel reader is measured faster
+/// than sequential reader on multi-core machine, it is slower on single core (see Benchmark/FBenchmarkObjStream.cpp).
+constexpr bool kStreamModelObjParallel = false;
+
+/// @class FModelObjSink
+/// @brief Sink of streaming OBJ reader which appends vertices and indices to sModelVertices and sModelIndices.
+class FModelObjSink final : public dy::IObjStreamSink
+{
+public:
+  bool WriteVertices(const dy::DObjVertex* iVertices, std::size_t iCount) override
+  {
+    for (std::size_t i = 0; i < iCount; ++i)
+    {
+      dy::DDefaultVertex& vertex = sModelVertices.emplace_back();
+      vertex.mPosition   = iVertices[i].mPosition;
+      vertex.mTextureUv0 = iVertices[i].mTextureUv0;
+      vertex.mBaseColor  = dy::DVector3{ 1, 1, 1 };
+    }
+    return true;
+  }
 
-VkBuffer        sVertexBufferObject;
-VkDeviceMemory  sVertexBufferMemory;
-
-VkBuffer        sVertexElementObject;
-VkDeviceMemory  sVertexElementMemory;
+  bool WriteIndices(const TU32* iIndices, std::size_t iCount) override
+  {
+    sModelIndices.insert(sModelIndices.end(), iIndices, iIndices + iCount);
+    return true;
+  }
+};
+/// Reorder triangles and vertices of loaded model for post-transform cache, overdraw and vertex fetch.
+constexpr bool kOptimizeModelMesh = true;
+/// Upload model vertices as DCompactVertex of 16 bytes instead of DDefaultVertex of 32 bytes.
+constexpr bool kUseCompactVertex = true;
+/// Dequantization of uploaded model vertices, identity when kUseCompactVertex is false.
+dy::DCompactVertexDequantization sModelDequantization = {};
+/// Index type and submeshes of uploaded model indices. 16-bit indices are used when they fit.
+dy::DIndexBufferLayout sModelIndexLayout = {};
+/// Cull meshlets of model on CPU each frame.
+constexpr bool kCullModelMeshlets = true;
+/// Select LOD of model each frame, which is coarsest one of which error is projected under kModelLodPixelError.
+constexpr bool kSelectModelLod = true;
+constexpr float kModelLodPixelError = 1.0f;
+/// Re-record command buffer of acquired image each frame, when draws of model depend on camera.
+constexpr bool kRecordModelDrawsPerFrame = kCullModelMeshlets == true || kSelectModelLod == true;
+/// LODs of model from fine to coarse. They share vertices, and their indices are appended in same index array.
+std::vector<dy::DMeshLod> sModelLods = {};
+TU32 sModelLod = 0;
+/// Meshlets of each LOD and their local space bounds, read from cache or built in LoadModel.
+std::vector<dy::DMeshlet> sModelMeshlets = {};
+std::vector<dy::DMeshletBounds> sModelMeshletBounds = {};
+/// Visible index ranges of meshlets, and draws of them split by submeshes of sModelIndexLayout.
+std::vector<dy::DIndexSubmesh> sModelVisibleRanges = {};
+std::vector<dy::DIndexSubmesh> sModelDraws = {};
+dy::DMeshletCullStats sModelCullStats = {};
+constexpr dy::DVector3 kCameraPosition = {2.0f, 2.0f, 2.0f};
+/// Near plane of projection, which is also nearest distance of model to select LOD.
+constexpr float kNearPlane = 0.1f;
+
+/// Byte size of one vertex in mesh buffer, which is same for every mesh drawn by the pipeline.
+constexpr VkDeviceSize kMeshVertexSize = kUseCompactVertex == true ? sizeof(dy::DCompactVertex) : sizeof(dy::DDefaultVertex);
+/// Capacity of mesh buffer. Vertex region of kMeshBufferVertexCapacity vertices comes first,
+/// and index region of kMeshBufferIndexWordCapacity 4-byte words follows it.
+constexpr TU32 kMeshBufferVertexCapacity    = TU32(1) << 22;
+constexpr TU32 kMeshBufferIndexWordCapacity = TU32(1) << 23;
+constexpr VkDeviceSize kMeshBufferIndexOffset = kMeshVertexSize * kMeshBufferVertexCapacity;
+static_assert(kMeshBufferIndexOffset % sizeof(TU32) == 0, "Index region must be aligned to 4 bytes.");
+
+/// Ranges of meshes in sMeshBufferObject.
+dy::DMeshRegistry sMeshRegistry{kMeshBufferVertexCapacity, kMeshBufferIndexWordCapacity};
+VkBuffer        sMeshBufferObject;
+VkDeviceMemory  sMeshBufferMemory;
+/// Mesh of loaded model in sMeshRegistry.
+dy::DMeshHandle sModelMesh = {};
+/// Live meshes drawn by RecordCommandBuffer in order they are added. Mesh of sModelMesh is drawn by sModelDraws,
+/// and other meshes are drawn whole. Removed mesh is erased at once, before its ranges are freed.
+std::vector<dy::DMeshHandle> sDrawMeshes = {};
+/// Increased when sDrawMeshes is changed. Command buffer of image which is recorded with older version
+/// is recorded again before it is submitted, so pre-recorded command buffers never draw removed mesh.
+TU64 sDrawMeshVersion = 0;
+std::vector<TU64> sImageDrawMeshVersions = {};
+
+/// @struct DPendingMeshRemoval
+/// @brief Mesh removed by RemoveMesh, which is freed when every frame that may draw it is finished.
+struct DPendingMeshRemoval final
+{
+  dy::DMeshHandle mHandle;
+  /// Serial of first frame submitted after removal, which is recorded without the mesh.
+  /// Frames before it may have recorded the mesh, last one is mFrameSerial - 1.
+  TU64            mFrameSerial;
+};
+/// Pending removals in order of frame serial.
+std::vector<DPendingMeshRemoval> sPendingMeshRemovals = {};
+/// Count of frames submitted by DrawFrame.
+TU64 sFrameSerial = 0;
 
 constexpr const char* kModelPath    = "../../Resource/chalet.obj";
 constexpr const char* kTexturePath  = "../../Resource/chalet.jpg";
 TU32 sRequireMipLevel = 1;
+/// Staging buffer of texture, created before texture is decoded so decoder writes pixels into its mapped memory.
+VkBuffer        sTextureStagingBuffer;
+VkDeviceMemory  sTextureStagingMemory;
+TU32            sTextureWidth  = 0;
+TU32            sTextureHeight = 0;
+
+/// @brief Read texture size from header, and set sTextureWidth, sTextureHeight and sRequireMipLevel.
+void ReadTextureSize()
+{
+  TI32 width = 0, height = 0;
+  if (dy::GetImageSize(kTexturePath, width, height) == false)
+  {
+    throw std::runtime_error("Failed to read texture image size.");
+  }
+  sTextureWidth  = static_cast<TU32>(width);
+  sTextureHeight = static_cast<TU32>(height);
+  sRequireMipLevel = dy::GetMipLevelCount(sTextureWidth, sTextureHeight);
+}
+
+/// Generate mip chain on CPU and copy it into staging buffer, filtered in linear space of sRGB texels.
+/// Set false to generate mipmaps on device by GenerateMipmaps.
+constexpr bool             kGenerateMipmapsOnCpu = true;
+constexpr dy::EMipmapFilter kTextureMipmapFilter  = dy::EMipmapFilter::Box;
+/// Generate mipmaps by one compute dispatch when device supports it. Set false to prefer blit path.
+/// Format which can not be blitted uses compute path regardless of this.
+constexpr bool        kGenerateMipmapsWithCompute = true;
+/// Count of `uMipLevels` of `mipmap.comp`.
+constexpr TU32        kMipmapComputeMaxLevel      = 16;
+
+/// @struct DMipmapComputeShader
+/// @brief Variant of `mipmap.comp` compiled with storage format qualifier of `uMipLevels` for mFormat.
+struct DMipmapComputeShader final
+{
+  VkFormat    mFormat;
+  const char* mPath;
+  /// Format qualifier needs shaderStorageImageExtendedFormats.
+  bool        mIsExtended;
+};
+/// Variants compiled by Resource/CMakeLists.txt. sRGB formats can not be storage images.
+constexpr DMipmapComputeShader kMipmapComputeShaders[] = {
+    {VK_FORMAT_R8G8B8A8_UNORM,            "../../Resource/mipmap_rgba8.spv",          false},
+    {VK_FORMAT_R16G16B16A16_UNORM,        "../../Resource/mipmap_rgba16.spv",         true},
+    {VK_FORMAT_R16G16B16A16_SFLOAT,       "../../Resource/mipmap_rgba16f.spv",        false},
+    {VK_FORMAT_R32G32B32A32_SFLOAT,       "../../Resource/mipmap_rgba32f.spv",        false},
+    {VK_FORMAT_A2B10G10R10_UNORM_PACK32,  "../../Resource/mipmap_rgb10_a2.spv",       true},
+    {VK_FORMAT_B10G11R11_UFLOAT_PACK32,   "../../Resource/mipmap_r11f_g11f_b10f.spv", true},
+    {VK_FORMAT_R8G8_UNORM,                "../../Resource/mipmap_rg8.spv",            true},
+    {VK_FORMAT_R16G16_UNORM,              "../../Resource/mipmap_rg16.spv",           true},
+    {VK_FORMAT_R16G16_SFLOAT,             "../../Resource/mipmap_rg16f.spv",          true},
+    {VK_FORMAT_R32G32_SFLOAT,             "../../Resource/mipmap_rg32f.spv",          true},
+    {VK_FORMAT_R8_UNORM,                  "../../Resource/mipmap_r8.spv",             true},
+    {VK_FORMAT_R16_UNORM,                 "../../Resource/mipmap_r16.spv",            true},
+    {VK_FORMAT_R16_SFLOAT,                "../../Resource/mipmap_r16f.spv",           true},
+    {VK_FORMAT_R32_SFLOAT,                "../../Resource/mipmap_r32f.spv",           false},
+};
+
+/// @brief Find variant of `mipmap.comp` for iFormat. Return nullptr if there is no variant.
+const DMipmapComputeShader* FindMipmapComputeShader(VkFormat iFormat)
+{
+  for (const auto& shader : kMipmapComputeShaders)
+  {
+    if (shader.mFormat == iFormat) { return &shader; }
+  }
+  return nullptr;
+}
+
+/// Device was created with shaderStorageImageArrayDynamicIndexing, which `mipmap.comp` requires.
+bool sIsStorageImageArrayIndexable = false;
+/// Device was created with shaderStorageImageExtendedFormats, which extended variants of `mipmap.comp` require.
+bool sIsStorageImageFormatExtended = false;
+
+/// Time compute and blit paths by GPU timestamps on scratch copies of texture at startup.
+/// It creates full-size images and waits queue idle per run on startup path, so it is only a diagnostic.
+/// Set true to exercise compute path and compare both paths on current device.
+constexpr bool kCompareMipmapGeneration = false;
+/// Count of runs of each path, of which minimum time is reported.
+constexpr TU32 kMipmapComparisonCount   = 4;
+/// Begin and end timestamps of GenerateMipmapsWithBlit and GenerateMipmapsWithCompute.
+/// Only created while CompareMipmapGeneration runs.
+VkQueryPool sMipmapQueryPool = VK_NULL_HANDLE;
+
+/// @brief Write begin (iQuery 0) or end (iQuery 1) timestamp of mipmap generation, when sMipmapQueryPool exists.
+void WriteMipmapTimestamp(VkCommandBuffer iCommandBuffer, TU32 iQuery)
+{
+  if (sMipmapQueryPool == VK_NULL_HANDLE) { return; }
+  if (iQuery == 0) { vkCmdResetQueryPool(iCommandBuffer, sMipmapQueryPool, 0, 2); }
+  vkCmdWriteTimestamp(iCommandBuffer,
+      iQuery == 0 ? VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+      sMipmapQueryPool, iQuery);
+}
+
+/// @class FStartupTimeline
+/// @brief Begin and end time of startup stages from start of pfInitialize. \n
+/// Stages of main thread are closed by `Mark`, and stages of worker threads are timed by `Run`.
+class FStartupTimeline final
+{
+public:
+  /// @brief Start timeline and clear recorded stages.
+  void Start()
+  {
+    this->mStartTime = std::chrono::steady_clock::now();
+    this->mLastMarkTime = this->mStartTime;
+    this->mStages.clear();
+  }
+
+  /// @brief Record main thread stage `iName` from previous mark to now.
+  void Mark(const char* iName)
+  {
+    const auto now = std::chrono::steady_clock::now();
+    this->Record(iName, "main", this->mLastMarkTime, now);
+    this->mLastMarkTime = now;
+  }
+
+  /// @brief Call `iFunction` and record its time as stage `iName` of worker thread `iThreadName`.
+  template <typename TFunctor>
+  void Run(const char* iName, const char* iThreadName, TFunctor&& iFunction)
+  {
+    const auto begin = std::chrono::steady_clock::now();
+    iFunction();
+    this->Record(iName, iThreadName, begin, std::chrono::steady_clock::now());
+  }
+
+  /// @brief Print stages in order of begin time, and total time from start.
+  /// Worker threads must be joined before.
+  void Print() const
+  {
+    auto stages = this->mStages;
+    std::stable_sort(stages.begin(), stages.end(), [](const auto& iLhs, const auto& iRhs) { return iLhs.mBeginMs < iRhs.mBeginMs; });
+    std::printf("Startup stages (ms from start) :\n");
+    for (const auto& stage : stages)
+    {
+      std::printf("  %-8s %-32s %9.2f -> %9.2f (%9.2f)\n",
+          stage.mThreadName, stage.mName, stage.mBeginMs, stage.mEndMs, stage.mEndMs - stage.mBeginMs);
+    }
+    std::printf("Startup total : %.2f ms\n",
+        std::chrono::duration<TF64, std::milli>(std::chrono::steady_clock::now() - this->mStartTime).count());
+  }
+
+private:
+  /// @struct DStage
+  struct DStage final
+  {
+    const char* mName;
+    const char* mThreadName;
+    TF64        mBeginMs;
+    TF64        mEndMs;
+  };
+
+  void Record(const char* iName, const char* iThreadName,
+      std::chrono::steady_clock::time_point iBegin, std::chrono::steady_clock::time_point iEnd)
+  {
+    const DStage stage = {
+        iName, iThreadName,
+        std::chrono::duration<TF64, std::milli>(iBegin - this->mStartTime).count(),
+        std::chrono::duration<TF64, std::milli>(iEnd - this->mStartTime).count()};
+    std::lock_guard<std::mutex> lock{this->mMutex};
+    this->mStages.push_back(stage);
+  }
+
+  std::chrono::steady_clock::time_point mStartTime;
+  std::chrono::steady_clock::time_point mLastMarkTime;
+  std::vector<DStage> mStages;
+  std::mutex          mMutex;
+};
+FStartupTimeline sStartupTimeline;
 
 // + We should have multiple buffers, because multiple frames may be in flight at the same time!
 // and we don't want to update the buffer in presentation mode while a previous one is still reading
@@ -142,7 +428,45 @@ std::vector<VkDeviceMemory> sUniformBufferMemories;
 
 EDySuccess MVulkanRenderer::pfInitialize()
 {
+  // Model and texture are read and decoded on worker threads while device and pipeline are created,
+  // because they do not need Vulkan. Their uploads join after command pool and framebuffers are created.
+  sStartupTimeline.Start();
+  auto modelLoad = std::async(std::launch::async, [this]
+  {
+    sStartupTimeline.Run("Load model", "model", [this] { this->LoadModel(kModelPath); });
+  });
+  // Images are decoded by pool, so more textures only add requests.
+  dy::FImageDecodePool imageDecodePool;
+
+  // Texture size is read first, because CPU mip chain and staging buffer are sized by it.
+  // CPU mip chain reads each level back to filter next level, and staging memory is uncached on discrete GPUs.
+  // So texture is decoded and its chain is generated in heap memory from here, as they do not need device.
+  // Staging memory only takes one copy of chain, instead of decoded pixels of DecodeImageInto.
+  ReadTextureSize();
+  std::vector<TU08> textureChain;
+  std::future<bool> textureChainLoad;
+  if constexpr (kGenerateMipmapsOnCpu == true)
+  {
+    textureChain.resize(dy::GetMipChainSize(sTextureWidth, sTextureHeight, sRequireMipLevel));
+    const std::size_t baseSize = std::size_t(sTextureWidth) * sTextureHeight * 4;
+    auto decode = imageDecodePool.DecodeInto(dy::DImageDecodeRequest{kTexturePath, false}, textureChain.data(), baseSize);
+    textureChainLoad = std::async(std::launch::async, [&textureChain, decode = std::move(decode)]() mutable
+    {
+      bool isLoaded = decode.get();
+      sStartupTimeline.Run("Generate mipmaps", "texture", [&]
+      {
+        dy::DMipmapOptions options;
+        options.mFilter = kTextureMipmapFilter;
+        isLoaded = isLoaded == true
+            && dy::GenerateMipChain(
+                textureChain.data(), sTextureWidth, sTextureHeight, sRequireMipLevel, options) == true;
+      });
+      return isLoaded;
+    });
+  }
+
   this->InitGlfw();
+  sStartupTimeline.Mark("Init GLFW");
 
   //
   this->mInstance = this->pCreateVulkanInstance();
@@ -155,6 +479,7 @@ EDySuccess MVulkanRenderer::pfInitialize()
   {
     this->mMessengerExt = this->pSetupDebugManager(this->mInstance);
   }
+  sStartupTimeline.Mark("Create instance");
 
   /* https://vulkan-tutorial.com/Drawing_a_triangle/Presentation/Window_surface
    * Since Vulkan is a platform independent API, it can not interface directly with the window system.
@@ -190,29 +515,66 @@ EDySuccess MVulkanRenderer::pfInitialize()
   // Also, user can create multiple logical devices from the same phyiscal device.
   std::tie(this->mGraphicsDevice, this->mGraphicsQueue, this->mPresentQueue) 
       = this->pCreateVkLogicalDevice(this->mPhysicalDevice);
+  sStartupTimeline.Mark("Create surface and device");
+
+  // Staging memory is only written, while other device objects are created.
+  // CPU mip chain is copied into it once, otherwise texture is decoded into it directly.
+  // Texture is not flipped, because flipping reads mapped memory back. Texture coordinate is flipped instead.
+  void* textureStaging = this->CreateTextureStagingBuffer();
+  std::future<bool> textureLoad;
+  if constexpr (kGenerateMipmapsOnCpu == true)
+  {
+    textureLoad = std::async(std::launch::async, [&textureChain, &textureChainLoad, textureStaging]
+    {
+      if (textureChainLoad.get() == false) { return false; }
+      sStartupTimeline.Run("Copy mip chain", "texture", [&]
+      {
+        std::memcpy(textureStaging, textureChain.data(), textureChain.size());
+      });
+      return true;
+    });
+  }
+  else
+  {
+    textureLoad = imageDecodePool.DecodeInto(
+        dy::DImageDecodeRequest{kTexturePath, false}, textureStaging, std::size_t(sTextureWidth) * sTextureHeight * 4);
+  }
+  sStartupTimeline.Mark("Create texture staging");
 
   // Create swap chain. This function must be succeeded.
   this->CreateSwapChain();
   this->mSwapChainImages = this->GetSwapChainImageHandles(this->mSwapChain);
   // Create swap chain image views to view image handle list of swap chain.
   this->CreateSwapChainImageViews();
+  sStartupTimeline.Mark("Create swap chain");
   // 
   this->CreateRenderPass();
   this->CreateDescriptorSetLayout();
   this->CreateGraphicsPipeline();
+  sStartupTimeline.Mark("Create pipeline");
   //
   this->CreateCommandPool();
   this->CreateDefaultColorResource();
   this->CreateDefaultDepthResource();
   this->CreateFrameBuffer();
+  sStartupTimeline.Mark("Create framebuffers");
+  // `get` rethrows exception of worker thread.
+  modelLoad.get();
+  sStartupTimeline.Mark("Wait model");
+  this->CreateMeshBuffer();
+  this->CreateModelMesh();
+  sModelCache.reset();
+  sStartupTimeline.Mark("Upload model");
   //
-  this->LoadModel(kModelPath);
-  this->CreateVertexBuffer();
-  this->CreateIndiceBuffer();
-  //
+  if (textureLoad.get() == false)
+  {
+    throw std::runtime_error("Failed to decode texture image.");
+  }
+  sStartupTimeline.Mark("Wait texture");
   this->CreateTextureImage();
   this->CreateTextureImageView();
   this->CreateTextureSampler();
+  sStartupTimeline.Mark("Upload texture");
   //
   this->CreateUniformBuffers();
   this->CreateDescriptorPool();
@@ -220,6 +582,8 @@ EDySuccess MVulkanRenderer::pfInitialize()
   this->CreateCommandBuffers();
   //
   this->CreateDefaultSemaphores();
+  sStartupTimeline.Mark("Create descriptors and commands");
+  sStartupTimeline.Print();
 
   return DY_SUCCESS;
 }
@@ -629,6 +993,13 @@ std::tuple<VkDevice, VkQueue, VkQueue> MVulkanRenderer::pCreateVkLogicalDevice(V
 
   // Set up devices features that we'll using.
   VkPhysicalDeviceFeatures logicalDeviceFeatures = {};
+  // Enable dynamic indexing of storage image array if supported, for compute mipmap generation.
+  VkPhysicalDeviceFeatures supportedFeatures;
+  vkGetPhysicalDeviceFeatures(iPhysicalDevice, &supportedFeatures);
+  logicalDeviceFeatures.shaderStorageImageArrayDynamicIndexing = supportedFeatures.shaderStorageImageArrayDynamicIndexing;
+  logicalDeviceFeatures.shaderStorageImageExtendedFormats = supportedFeatures.shaderStorageImageExtendedFormats;
+  sIsStorageImageArrayIndexable = VkIsTrue(supportedFeatures.shaderStorageImageArrayDynamicIndexing);
+  sIsStorageImageFormatExtended = VkIsTrue(supportedFeatures.shaderStorageImageExtendedFormats);
   
   // Using `VkPhysicalDeviceFeatures` and `VkDeviceQueueCreateInfo`,
   // we can start filling `VkDeviceCreateInfo` structure.
@@ -1205,10 +1576,15 @@ void MVulkanRenderer::CreateFixedRenderPipeline(
   VkPipelineVertexInputStateCreateInfo vertexInputInfo = {};
   vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
   // Like this.
+  const auto& attributeDescriptions = kUseCompactVertex == true
+      ? dy::GetCompactVertexAttributeDescriptions()
+      : dy::DDefaultVertex::GetAttributeDescriptons();
   vertexInputInfo.vertexBindingDescriptionCount   = 1;
-  vertexInputInfo.pVertexBindingDescriptions      = &dy::DDefaultVertex::GetBindingDescription();
-  vertexInputInfo.vertexAttributeDescriptionCount = TU32(dy::DDefaultVertex::GetAttributeDescriptons().size());
-  vertexInputInfo.pVertexAttributeDescriptions    = dy::DDefaultVertex::GetAttributeDescriptons().data();
+  vertexInputInfo.pVertexBindingDescriptions      = kUseCompactVertex == true
+      ? &dy::GetCompactVertexBindingDescription()
+      : &dy::DDefaultVertex::GetBindingDescription();
+  vertexInputInfo.vertexAttributeDescriptionCount = TU32(attributeDescriptions.size());
+  vertexInputInfo.pVertexAttributeDescriptions    = attributeDescriptions.data();
 
   // (2) Input assembly
   // creatInfo structure describes two things.
@@ -1434,7 +1810,8 @@ void MVulkanRenderer::CreateCommandPool()
   // Command bffers are executed by submitting them on one of the device queues,
   // Each command pool can only allocate command bufrs that are submited on single type of queue.
   // in flags, there are possible flags that change allocation behaviour of command queue.
-  createInfo.flags            = 0;
+  // Command buffer of acquired image is re-recorded each frame with selected draws, so it must be resettable.
+  createInfo.flags            = kRecordModelDrawsPerFrame == true ? VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT : 0;
 
   // Created command pool handle instance must be destroyed explicitly.
   if (vkCreateCommandPool(this->mGraphicsDevice, &createInfo, nullptr, &this->mCommandPool) != VK_SUCCESS)
@@ -1469,87 +1846,124 @@ void MVulkanRenderer::CreateCommandBuffers()
     throw std::runtime_error("Failed to allocated command buffers.");
   }
 
-  // (3) Begin recording a command buffer with `VkCommandBufferBeginInfo`.
-  // This structure specifies some details about the usage of this specific command buffer.
+  // Fence of frame which is rendering each image, so command buffer is not re-recorded while pending.
+  this->mImagesInFlight.assign(this->mCommandBuffers.size(), VK_NULL_HANDLE);
+  sImageDrawMeshVersions.assign(this->mCommandBuffers.size(), sDrawMeshVersion);
+
+  // (3) Record each command buffer.
   for (size_t i = 0; i < this->mCommandBuffers.size(); ++i)
   {
-    // Structure specifying a command buffer begin operation
-    // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/VkCommandBufferBeginInfo.html
-    VkCommandBufferBeginInfo beginInfo = {};
-    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-    // `flags` parameter specifies how we're going to use the command buffer.
-    // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/VkCommandBufferUsageFlagBits.html
-    // In this case, we are going to use STIMUTANEOUS because we may already be scheduling the drawing
-    // commands for the next frame while the last frmae is not finished yet.
-
-    // ...specifies that a command buffer can be resubmitted to a queue while it is in the pending state, 
-    // and recorded into multiple primary command buffers...
-    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
-    beginInfo.pInheritanceInfo = nullptr; // Is only relevant for secondary command buffer.
-
-    // If the command buffer was already recorded once, then a call to `vkBeginCommandBuffer`
-    // will implicitly reset it.
-    // Start recording a command buffer.
-    if (vkBeginCommandBuffer(this->mCommandBuffers[i], &beginInfo) != VK_SUCCESS)
+    this->RecordCommandBuffer(static_cast<TU32>(i));
+  }
+}
+
+void MVulkanRenderer::RecordCommandBuffer(TU32 iImageIndex)
+{
+  // Begin recording a command buffer with `VkCommandBufferBeginInfo`.
+  // This structure specifies some details about the usage of this specific command buffer.
+  // Structure specifying a command buffer begin operation
+  // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/VkCommandBufferBeginInfo.html
+  VkCommandBufferBeginInfo beginInfo = {};
+  beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+  // `flags` parameter specifies how we're going to use the command buffer.
+  // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/VkCommandBufferUsageFlagBits.html
+  // In this case, we are going to use STIMUTANEOUS because we may already be scheduling the drawing
+  // commands for the next frame while the last frmae is not finished yet.
+
+  // ...specifies that a command buffer can be resubmitted to a queue while it is in the pending state, 
+  // and recorded into multiple primary command buffers...
+  beginInfo.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+  beginInfo.pInheritanceInfo = nullptr; // Is only relevant for secondary command buffer.
+
+  // If the command buffer was already recorded once, then a call to `vkBeginCommandBuffer`
+  // will implicitly reset it.
+  // Start recording a command buffer.
+  if (vkBeginCommandBuffer(this->mCommandBuffers[iImageIndex], &beginInfo) != VK_SUCCESS)
+  {
+    throw std::runtime_error("Failed to begin recording command buffer.");
+  }
+
+  // Drawing starts by beginning the render pass with `vkCmdBeginRenderPass`.
+  // using `VkRenderPassBeginInfo`...
+  // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/VkRenderPassBeginInfo.html
+  VkRenderPassBeginInfo renderPassInfo = {};
+  renderPassInfo.sType      = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+  renderPassInfo.renderPass = this->mRenderPass;
+  renderPassInfo.framebuffer= this->mSwapChainFrameBuffers[iImageIndex];
+  // Render area defines where shader loades and stores will take place.
+  // It should match the size of the attachments for performance.
+  renderPassInfo.renderArea.offset = {0, 0};
+  renderPassInfo.renderArea.extent = this->mSwapChainExtent;
+  // Clear color to attachment 1 of framebuffer.
+  // This parameters are for VK_ATTACHMENT_LOAD_OP_CLEAR;
+  std::array<VkClearValue, 2> clearAttachmentValues;
+  clearAttachmentValues[0].color        = {0, 0, 0, 1};
+  clearAttachmentValues[1].depthStencil = {1.0f, 0}; 
+  renderPassInfo.clearValueCount  = TU32(clearAttachmentValues.size()); 
+  renderPassInfo.pClearValues     = clearAttachmentValues.data();
+
+  // Begin a new render pass + Push commands. 
+  // Upper `vkBeginCommandBuffer` is just reset command buffer and start to recording commands.
+  // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/vkCmdBeginRenderPass.html
+  // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/VkSubpassContents.html
+  // INLINE must be executed on primary buffer.
+  vkCmdBeginRenderPass(this->mCommandBuffers[iImageIndex], &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+
+  // We can now bind the graphics pipeline.
+  // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/vkCmdBindPipeline.html
+  // specifies binding as a graphic pipeline.
+  vkCmdBindPipeline(this->mCommandBuffers[iImageIndex], VK_PIPELINE_BIND_POINT_GRAPHICS, this->mPipeline);
+
+  // Every mesh is in mesh buffer, so vertex region is bound once at offset 0 for every draw.
+  // Index region is bound again only when index type of mesh is changed.
+  std::vector<VkBuffer> vertexBuffers = {sMeshBufferObject};
+  std::vector<VkDeviceSize> offset = {0};
+  vkCmdBindVertexBuffers(this->mCommandBuffers[iImageIndex], 0, 1, vertexBuffers.data(), offset.data());
+  VkIndexType boundIndexType = VK_INDEX_TYPE_MAX_ENUM;
+
+  vkCmdBindDescriptorSets(
+      this->mCommandBuffers[iImageIndex], 
+      VK_PIPELINE_BIND_POINT_GRAPHICS, this->mPipelineLayout, 0, 1,
+      &this->mDescriptorSets[iImageIndex],0, nullptr);
+
+  // Draw!! (glDrawArrays)
+  // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/vkCmdDraw.html
+  //vkCmdDraw(this->mCommandBuffers[iImageIndex], static_cast<TU32>(sTempVertices.size()), 1, 0, 0);
+  // Each submesh of 16-bit indices, or visible part of it when meshlets are culled, is drawn with its vertex offset.
+  // Draws are relative to model mesh, so first index and vertex of mesh in mesh buffer are added.
+  // Other meshes are drawn whole, from first index and vertex of their ranges.
+  for (const auto& handle : sDrawMeshes)
+  {
+    const dy::DMeshAllocation* mesh = sMeshRegistry.Get(handle);
+    if (mesh == nullptr || mesh->mIndexCount == 0) { continue; }
+
+    const VkIndexType indexType = mesh->mIndexSize == sizeof(TU16) ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+    if (indexType != boundIndexType)
     {
-      throw std::runtime_error("Failed to begin recording command buffer.");
+      vkCmdBindIndexBuffer(this->mCommandBuffers[iImageIndex], sMeshBufferObject, kMeshBufferIndexOffset, indexType);
+      boundIndexType = indexType;
     }
-
-    // Drawing starts by beginning the render pass with `vkCmdBeginRenderPass`.
-    // using `VkRenderPassBeginInfo`...
-    // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/VkRenderPassBeginInfo.html
-    VkRenderPassBeginInfo renderPassInfo = {};
-    renderPassInfo.sType      = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-    renderPassInfo.renderPass = this->mRenderPass;
-    renderPassInfo.framebuffer= this->mSwapChainFrameBuffers[i];
-    // Render area defines where shader loades and stores will take place.
-    // It should match the size of the attachments for performance.
-    renderPassInfo.renderArea.offset = {0, 0};
-    renderPassInfo.renderArea.extent = this->mSwapChainExtent;
-    // Clear color to attachment 1 of framebuffer.
-    // This parameters are for VK_ATTACHMENT_LOAD_OP_CLEAR;
-    std::array<VkClearValue, 2> clearAttachmentValues;
-    clearAttachmentValues[0].color        = {0, 0, 0, 1};
-    clearAttachmentValues[1].depthStencil = {1.0f, 0}; 
-    renderPassInfo.clearValueCount  = TU32(clearAttachmentValues.size()); 
-    renderPassInfo.pClearValues     = clearAttachmentValues.data();
-
-    // Begin a new render pass + Push commands. 
-    // Upper `vkBeginCommandBuffer` is just reset command buffer and start to recording commands.
-    // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/vkCmdBeginRenderPass.html
-    // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/VkSubpassContents.html
-    // INLINE must be executed on primary buffer.
-    vkCmdBeginRenderPass(this->mCommandBuffers[i], &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
-
-    // We can now bind the graphics pipeline.
-    // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/vkCmdBindPipeline.html
-    // specifies binding as a graphic pipeline.
-    vkCmdBindPipeline(this->mCommandBuffers[i], VK_PIPELINE_BIND_POINT_GRAPHICS, this->mPipeline);
-
-    std::vector<VkBuffer> vertexBuffers = {sVertexBufferObject};
-    std::vector<VkDeviceSize> offset = {0};
-    vkCmdBindVertexBuffers(this->mCommandBuffers[i], 0, 1, vertexBuffers.data(), offset.data());
-
-    std::vector<VkBuffer> indexBuffers = {sVertexElementObject};
-    vkCmdBindIndexBuffer(this->mCommandBuffers[i], sVertexElementObject, 0, VK_INDEX_TYPE_UINT32);
-
-    vkCmdBindDescriptorSets(
-        this->mCommandBuffers[i], 
-        VK_PIPELINE_BIND_POINT_GRAPHICS, this->mPipelineLayout, 0, 1,
-        &this->mDescriptorSets[i],0, nullptr);
-
-    // Draw!! (glDrawArrays)
-    // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/vkCmdDraw.html
-    //vkCmdDraw(this->mCommandBuffers[i], static_cast<TU32>(sTempVertices.size()), 1, 0, 0);
-    vkCmdDrawIndexed(this->mCommandBuffers[i], static_cast<TU32>(sModelIndices.size()), 1, 0, 0, 0);
-
-    // Finish render pass. 
-    vkCmdEndRenderPass(this->mCommandBuffers[i]);
-    if (vkEndCommandBuffer(this->mCommandBuffers[i]) != VK_SUCCESS)
+    if (handle != sModelMesh)
+    {
+      vkCmdDrawIndexed(this->mCommandBuffers[iImageIndex], mesh->mIndexCount, 1,
+          mesh->GetFirstIndex(), static_cast<TI32>(mesh->mFirstVertex), 0);
+      continue;
+    }
+    for (const auto& draw : sModelDraws)
     {
-      throw std::runtime_error("Failed to record command buffer.");
+      vkCmdDrawIndexed(this->mCommandBuffers[iImageIndex], draw.mIndexCount, 1,
+          mesh->GetFirstIndex() + draw.mFirstIndex,
+          static_cast<TI32>(mesh->mFirstVertex + draw.mVertexOffset), 0);
     }
   }
+  sImageDrawMeshVersions[iImageIndex] = sDrawMeshVersion;
+
+  // Finish render pass. 
+  vkCmdEndRenderPass(this->mCommandBuffers[iImageIndex]);
+  if (vkEndCommandBuffer(this->mCommandBuffers[iImageIndex]) != VK_SUCCESS)
+  {
+    throw std::runtime_error("Failed to record command buffer.");
+  }
 }
 
 void MVulkanRenderer::CreateDefaultSemaphores()
@@ -1591,38 +2005,46 @@ void MVulkanRenderer::CreateDefaultSemaphores()
   }
 }
 
-void MVulkanRenderer::CreateTextureImage()
+void* MVulkanRenderer::CreateTextureStagingBuffer()
 {
-  // (1) Read image buffer.
-  // We create staging buffer for texture.
-  VkBuffer stagingBuffer;
-  VkDeviceMemory stagingBufferMemory;
-  TU32 width, height;
-  {
-    dy::DDyImageBinaryDataBuffer imageBuffer{kTexturePath};
-    MDY_ASSERT(imageBuffer.IsBufferCreatedProperly() == true);
-
-    this->CreateBuffer(imageBuffer.GetBufferSize(), 
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-        stagingBuffer, stagingBufferMemory);
+  // Texture size was read by ReadTextureSize. Staging buffer has every level when mip chain is generated on CPU.
+  const VkDeviceSize bufferSize = kGenerateMipmapsOnCpu == true
+      ? VkDeviceSize(dy::GetMipChainSize(sTextureWidth, sTextureHeight, sRequireMipLevel))
+      : VkDeviceSize(sTextureWidth) * sTextureHeight * 4;
+  this->CreateBuffer(bufferSize, 
+      VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+      sTextureStagingBuffer, sTextureStagingMemory);
 
-    void* data;
-    vkMapMemory(this->mGraphicsDevice, stagingBufferMemory, 0, imageBuffer.GetBufferSize(), 0, &data);
-    memcpy(data, imageBuffer.GetBufferStartPoint(), imageBuffer.GetBufferSize());
-    vkUnmapMemory(this->mGraphicsDevice, stagingBufferMemory);
+  // Memory is kept mapped until CreateTextureImage, and is only written in order by decoder or chain copy.
+  void* data;
+  vkMapMemory(this->mGraphicsDevice, sTextureStagingMemory, 0, bufferSize, 0, &data);
+  return data;
+}
 
-    width  = imageBuffer.GetImageWidth();
-    height = imageBuffer.GetImageHeight();
-  }
+void MVulkanRenderer::CreateTextureImage()
+{
+  // (1) Pixels were decoded into staging buffer of CreateTextureStagingBuffer.
+  vkUnmapMemory(this->mGraphicsDevice, sTextureStagingMemory);
+  VkBuffer stagingBuffer = sTextureStagingBuffer;
+  VkDeviceMemory stagingBufferMemory = sTextureStagingMemory;
+  const TU32 width  = sTextureWidth;
+  const TU32 height = sTextureHeight;
 
   // (2) Create image create info.
   // Created image `this->mTextureImage` was created with VK_IMAGE_LAYOUT_UNDEFINED,
   // so we need transit it to VK_IMAGE_USAGE_TRANSFER_DST_BIT.
-  sRequireMipLevel = static_cast<TU32>(std::floor(std::log2(std::max(width, height)))) + 1;
+  // Image also needs storage usage when GenerateMipmaps writes levels by compute shader.
+  VkImageUsageFlags usage = 
+      VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+  if (kGenerateMipmapsOnCpu == false
+  &&  this->IsMipmapComputeSupported(VK_FORMAT_R8G8B8A8_UNORM, sRequireMipLevel) == true)
+  {
+    usage |= VK_IMAGE_USAGE_STORAGE_BIT;
+  }
   this->CreateImage(width, height, sRequireMipLevel,
       VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_TILING_OPTIMAL,
-      VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+      usage,
       VK_SAMPLE_COUNT_1_BIT,
       VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
       this->mTextureImage, this->mTextureImageMemory);
@@ -1633,16 +2055,32 @@ void MVulkanRenderer::CreateTextureImage()
       this->mTextureImage, 
       VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 
       sRequireMipLevel);
-  this->CopyBufferToImage(stagingBuffer, this->mTextureImage, width, height);
+  const TU32 copiedLevelCount = kGenerateMipmapsOnCpu == true ? sRequireMipLevel : 1;
+  this->CopyBufferToImage(stagingBuffer, this->mTextureImage, width, height, copiedLevelCount);
+  if constexpr (kCompareMipmapGeneration == true)
+  {
+    this->CompareMipmapGeneration(stagingBuffer, VK_FORMAT_R8G8B8A8_UNORM, width, height, sRequireMipLevel);
+  }
 
   // We also need to transit DST_LAYOUT image to SHADER_READ_ONLY
   // because we let it be able to be readen from shader access.
   vkFreeMemory(this->mGraphicsDevice, stagingBufferMemory, nullptr);
   vkDestroyBuffer(this->mGraphicsDevice, stagingBuffer, nullptr);
 
-  // We don't need to transit each mipmap's layout to SHADER_READ_BIT because
-  // This function will do transition command to each texture maps.
-  this->GenerateMipmaps(this->mTextureImage, VK_FORMAT_R8G8B8A8_UNORM, width, height, sRequireMipLevel);
+  // Every level was copied from CPU mip chain, so all levels are just transited.
+  if constexpr (kGenerateMipmapsOnCpu == true)
+  {
+    this->TransitImageLayout(
+        this->mTextureImage,
+        VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        sRequireMipLevel);
+  }
+  else
+  {
+    // We don't need to transit each mipmap's layout to SHADER_READ_BIT because
+    // This function will do transition command to each texture maps.
+    this->GenerateMipmaps(this->mTextureImage, VK_FORMAT_R8G8B8A8_UNORM, width, height, sRequireMipLevel);
+  }
 }
 
 void MVulkanRenderer::CreateTextureImageView()
@@ -1830,17 +2268,259 @@ void MVulkanRenderer::TransitImageLayout(
 void MVulkanRenderer::GenerateMipmaps(
     VkImage iImage, VkFormat iPreferredFormat, 
     TU32 iWidth, TU32 iHeight, TU32 iRequiredMipLevel)
+{
+  // Compute path does not need linear filtering, so format which can not be blitted uses it.
+  const auto begin = std::chrono::steady_clock::now();
+  const bool isBlittable = this->IsMipmapBlitSupported(iPreferredFormat);
+  const bool isCompute = (kGenerateMipmapsWithCompute == true || isBlittable == false)
+      && this->IsMipmapComputeSupported(iPreferredFormat, iRequiredMipLevel) == true;
+  if (isCompute == true)
+  {
+    this->GenerateMipmapsWithCompute(iImage, iPreferredFormat, iWidth, iHeight, iRequiredMipLevel);
+  }
+  else
+  {
+    if (isBlittable == false)
+    { throw std::runtime_error("Texture image format supports neither linear blitting nor compute mipmaps."); }
+
+    this->GenerateMipmapsWithBlit(iImage, iWidth, iHeight, iRequiredMipLevel);
+  }
+
+  // Both paths wait queue idle, so this is GPU time of mipmap generation with submission overhead.
+  std::printf("Mipmap generation (%s, %u levels) : %.3f ms\n",
+      isCompute == true ? "compute" : "blit", iRequiredMipLevel,
+      std::chrono::duration<TF64, std::milli>(std::chrono::steady_clock::now() - begin).count());
+}
+
+bool MVulkanRenderer::IsMipmapBlitSupported(VkFormat iFormat)
 {
   // Check if image format supports linear blitting.
   VkFormatProperties formatProperties;
-  vkGetPhysicalDeviceFormatProperties(this->mPhysicalDevice, iPreferredFormat, &formatProperties);
+  vkGetPhysicalDeviceFormatProperties(this->mPhysicalDevice, iFormat, &formatProperties);
   // We create a texture image with the optimal tiling format, so we need to check
   // optimalTilingFeatures.
-  if ((formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT)
-      == false)
-  { throw std::runtime_error("Texture image format does not support linear blitting."); }
+  return (formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT) != 0;
+}
+
+bool MVulkanRenderer::IsMipmapComputeSupported(VkFormat iFormat, TU32 iRequiredMipLevel)
+{
+  const auto* shader = FindMipmapComputeShader(iFormat);
+  if (shader == nullptr
+  ||  (shader->mIsExtended == true && sIsStorageImageFormatExtended == false)
+  ||  iRequiredMipLevel < 2 || iRequiredMipLevel > kMipmapComputeMaxLevel
+  ||  sIsStorageImageArrayIndexable == false)
+  { return false; }
+
+  VkFormatProperties formatProperties;
+  vkGetPhysicalDeviceFormatProperties(this->mPhysicalDevice, iFormat, &formatProperties);
+  if ((formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT) == false) { return false; }
+
+  // Command pool is of graphics queue family, so it must also accept compute dispatch.
+  TU32 queueFamilyCount = 0;
+  vkGetPhysicalDeviceQueueFamilyProperties(this->mPhysicalDevice, &queueFamilyCount, nullptr);
+  std::vector<VkQueueFamilyProperties> queueFamilyProperties(queueFamilyCount);
+  vkGetPhysicalDeviceQueueFamilyProperties(this->mPhysicalDevice, &queueFamilyCount, queueFamilyProperties.data());
+  const auto indices = this->GetFindQueueFamilies(this->mPhysicalDevice, VK_QUEUE_GRAPHICS_BIT);
+  if ((queueFamilyProperties[*indices.moptGraphicsQueueFamiliy].queueFlags & VK_QUEUE_COMPUTE_BIT) == 0)
+  { return false; }
+
+  // Shader is compiled from Resource/mipmap.comp by build, so it is missing only when build was skipped.
+  return ReadBinaryFile(shader->mPath).has_value() == true;
+}
+
+void MVulkanRenderer::GenerateMipmapsWithCompute(
+    VkImage iImage, VkFormat iFormat, TU32 iWidth, TU32 iHeight, TU32 iRequiredMipLevel)
+{
+  // (1) Create one storage view per level. Unused elements of `uMipLevels` refer to last level.
+  std::vector<VkImageView> levelViews(iRequiredMipLevel);
+  for (TU32 level = 0; level < iRequiredMipLevel; ++level)
+  {
+    levelViews[level] = this->CreateImageView(iImage, iFormat, VK_IMAGE_ASPECT_COLOR_BIT, 1, level);
+  }
+
+  // Counter of finished workgroups, which finds last workgroup to reduce levels after 6.
+  VkBuffer        counterBuffer;
+  VkDeviceMemory  counterMemory;
+  this->CreateBuffer(sizeof(TU32),
+      VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+      VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+      counterBuffer, counterMemory);
+
+  // (2) Create descriptor set layout, pool and set of `uMipLevels` and counter.
+  std::array<VkDescriptorSetLayoutBinding, 2> bindings = {};
+  bindings[0].binding         = 0;
+  bindings[0].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+  bindings[0].descriptorCount = kMipmapComputeMaxLevel;
+  bindings[0].stageFlags      = VK_SHADER_STAGE_COMPUTE_BIT;
+  bindings[1].binding         = 1;
+  bindings[1].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+  bindings[1].descriptorCount = 1;
+  bindings[1].stageFlags      = VK_SHADER_STAGE_COMPUTE_BIT;
+
+  VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+  layoutInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+  layoutInfo.bindingCount = static_cast<TU32>(bindings.size());
+  layoutInfo.pBindings    = bindings.data();
+  VkDescriptorSetLayout setLayout;
+  if (vkCreateDescriptorSetLayout(this->mGraphicsDevice, &layoutInfo, nullptr, &setLayout) != VK_SUCCESS)
+  { throw std::runtime_error("Failed to create mipmap descriptor set layout."); }
+
+  std::array<VkDescriptorPoolSize, 2> poolSizes = {};
+  poolSizes[0].type             = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+  poolSizes[0].descriptorCount  = kMipmapComputeMaxLevel;
+  poolSizes[1].type             = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+  poolSizes[1].descriptorCount  = 1;
+
+  VkDescriptorPoolCreateInfo poolInfo = {};
+  poolInfo.sType          = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+  poolInfo.poolSizeCount  = static_cast<TU32>(poolSizes.size());
+  poolInfo.pPoolSizes     = poolSizes.data();
+  poolInfo.maxSets        = 1;
+  VkDescriptorPool descriptorPool;
+  if (vkCreateDescriptorPool(this->mGraphicsDevice, &poolInfo, nullptr, &descriptorPool) != VK_SUCCESS)
+  { throw std::runtime_error("Failed to create mipmap descriptor pool."); }
 
+  VkDescriptorSetAllocateInfo allocInfo = {};
+  allocInfo.sType               = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+  allocInfo.descriptorPool      = descriptorPool;
+  allocInfo.descriptorSetCount  = 1;
+  allocInfo.pSetLayouts         = &setLayout;
+  VkDescriptorSet descriptorSet;
+  if (vkAllocateDescriptorSets(this->mGraphicsDevice, &allocInfo, &descriptorSet) != VK_SUCCESS)
+  { throw std::runtime_error("Failed to allocate mipmap descriptor set."); }
+
+  std::array<VkDescriptorImageInfo, kMipmapComputeMaxLevel> imageInfos = {};
+  for (TU32 i = 0; i < kMipmapComputeMaxLevel; ++i)
+  {
+    imageInfos[i].imageView   = levelViews[std::min(i, iRequiredMipLevel - 1)];
+    imageInfos[i].imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+  }
+  VkDescriptorBufferInfo counterInfo = {};
+  counterInfo.buffer  = counterBuffer;
+  counterInfo.offset  = 0;
+  counterInfo.range   = sizeof(TU32);
+
+  std::array<VkWriteDescriptorSet, 2> descriptorWrites = {};
+  descriptorWrites[0].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+  descriptorWrites[0].dstSet          = descriptorSet;
+  descriptorWrites[0].dstBinding      = 0;
+  descriptorWrites[0].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+  descriptorWrites[0].descriptorCount = kMipmapComputeMaxLevel;
+  descriptorWrites[0].pImageInfo      = imageInfos.data();
+  descriptorWrites[1].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+  descriptorWrites[1].dstSet          = descriptorSet;
+  descriptorWrites[1].dstBinding      = 1;
+  descriptorWrites[1].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+  descriptorWrites[1].descriptorCount = 1;
+  descriptorWrites[1].pBufferInfo     = &counterInfo;
+  vkUpdateDescriptorSets(this->mGraphicsDevice, 
+      static_cast<TU32>(descriptorWrites.size()), descriptorWrites.data(), 0, nullptr);
+
+  // (3) Create compute pipeline, with push constants of `DyMipmapConstants`.
+  struct DMipmapConstants final
+  {
+    TI32 mBaseWidth;
+    TI32 mBaseHeight;
+    TI32 mLevelCount;
+    TU32 mGroupCount;
+  };
+  VkPushConstantRange pushConstantRange = {};
+  pushConstantRange.stageFlags  = VK_SHADER_STAGE_COMPUTE_BIT;
+  pushConstantRange.offset      = 0;
+  pushConstantRange.size        = sizeof(DMipmapConstants);
+
+  VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+  pipelineLayoutInfo.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+  pipelineLayoutInfo.setLayoutCount         = 1;
+  pipelineLayoutInfo.pSetLayouts            = &setLayout;
+  pipelineLayoutInfo.pushConstantRangeCount = 1;
+  pipelineLayoutInfo.pPushConstantRanges    = &pushConstantRange;
+  VkPipelineLayout pipelineLayout;
+  if (vkCreatePipelineLayout(this->mGraphicsDevice, &pipelineLayoutInfo, nullptr, &pipelineLayout) != VK_SUCCESS)
+  { throw std::runtime_error("Failed to create mipmap pipeline layout."); }
+
+  auto shaderModule = this->CreateShaderModule(*ReadBinaryFile(FindMipmapComputeShader(iFormat)->mPath));
+  VkComputePipelineCreateInfo pipelineInfo = {};
+  pipelineInfo.sType        = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+  pipelineInfo.stage.sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+  pipelineInfo.stage.stage  = VK_SHADER_STAGE_COMPUTE_BIT;
+  pipelineInfo.stage.module = shaderModule;
+  pipelineInfo.stage.pName  = "main";
+  pipelineInfo.layout       = pipelineLayout;
+  VkPipeline pipeline;
+  if (vkCreateComputePipelines(this->mGraphicsDevice, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline) != VK_SUCCESS)
+  { throw std::runtime_error("Failed to create mipmap compute pipeline."); }
+  vkDestroyShaderModule(this->mGraphicsDevice, shaderModule, nullptr);
+
+  // (4) Record. Each workgroup makes 32 x 32 texels of level 1 from 64 x 64 texels of level 0.
+  const TU32 groupCountX = (std::max(iWidth / 2, 1u) + 31) / 32;
+  const TU32 groupCountY = (std::max(iHeight / 2, 1u) + 31) / 32;
+  const DMipmapConstants constants = {
+      TI32(iWidth), TI32(iHeight), TI32(iRequiredMipLevel), groupCountX * groupCountY};
+
+  VkCommandBuffer commandBuffer = this->BeginSingleTimeCommands();
+  WriteMipmapTimestamp(commandBuffer, 0);
+
+  vkCmdFillBuffer(commandBuffer, counterBuffer, 0, sizeof(TU32), 0);
+  VkBufferMemoryBarrier counterBarrier = {};
+  counterBarrier.sType                = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+  counterBarrier.srcAccessMask        = VK_ACCESS_TRANSFER_WRITE_BIT;
+  counterBarrier.dstAccessMask        = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+  counterBarrier.srcQueueFamilyIndex  = VK_QUEUE_FAMILY_IGNORED;
+  counterBarrier.dstQueueFamilyIndex  = VK_QUEUE_FAMILY_IGNORED;
+  counterBarrier.buffer               = counterBuffer;
+  counterBarrier.offset               = 0;
+  counterBarrier.size                 = VK_WHOLE_SIZE;
+
+  // Every level is transited to GENERAL at once, after copy of level 0 is done.
+  VkImageMemoryBarrier barrier = {};
+  barrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+  barrier.image               = iImage;
+  barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+  barrier.subresourceRange.baseMipLevel   = 0;
+  barrier.subresourceRange.levelCount     = iRequiredMipLevel;
+  barrier.subresourceRange.baseArrayLayer = 0;
+  barrier.subresourceRange.layerCount     = 1;
+  barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+  barrier.newLayout     = VK_IMAGE_LAYOUT_GENERAL;
+  barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+  barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+  vkCmdPipelineBarrier(commandBuffer,
+      VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+      0, 0, nullptr, 1, &counterBarrier, 1, &barrier);
+
+  vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+  vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, 0, 1, &descriptorSet, 0, nullptr);
+  vkCmdPushConstants(commandBuffer, pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(constants), &constants);
+  vkCmdDispatch(commandBuffer, groupCountX, groupCountY, 1);
+
+  barrier.oldLayout     = VK_IMAGE_LAYOUT_GENERAL;
+  barrier.newLayout     = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+  barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+  barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+  vkCmdPipelineBarrier(commandBuffer,
+      VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+      0, 0, nullptr, 0, nullptr, 1, &barrier);
+  WriteMipmapTimestamp(commandBuffer, 1);
+  this->EndSingleTimeCommands(commandBuffer);
+
+  // (5) Queue is idle after EndSingleTimeCommands, so temporary objects are destroyed now.
+  vkDestroyPipeline(this->mGraphicsDevice, pipeline, nullptr);
+  vkDestroyPipelineLayout(this->mGraphicsDevice, pipelineLayout, nullptr);
+  vkDestroyDescriptorPool(this->mGraphicsDevice, descriptorPool, nullptr);
+  vkDestroyDescriptorSetLayout(this->mGraphicsDevice, setLayout, nullptr);
+  for (auto& view : levelViews) { vkDestroyImageView(this->mGraphicsDevice, view, nullptr); }
+  vkDestroyBuffer(this->mGraphicsDevice, counterBuffer, nullptr);
+  vkFreeMemory(this->mGraphicsDevice, counterMemory, nullptr);
+}
+
+void MVulkanRenderer::GenerateMipmapsWithBlit(
+    VkImage iImage, TU32 iWidth, TU32 iHeight, TU32 iRequiredMipLevel)
+{
   VkCommandBuffer commandBuffer = this->BeginSingleTimeCommands();
+  WriteMipmapTimestamp(commandBuffer, 0);
 
   VkImageMemoryBarrier barrier = {};
   barrier.sType     = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
@@ -1917,14 +2597,94 @@ void MVulkanRenderer::GenerateMipmaps(
   vkCmdPipelineBarrier(commandBuffer, 
       VK_PIPELINE_STAGE_TRANSFER_BIT, 
       VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+  WriteMipmapTimestamp(commandBuffer, 1);
   this->EndSingleTimeCommands(commandBuffer);
 }
 
+void MVulkanRenderer::CompareMipmapGeneration(
+    VkBuffer iStagingBuffer, VkFormat iFormat, TU32 iWidth, TU32 iHeight, TU32 iRequiredMipLevel)
+{
+  // (1) Timestamps need valid bits on queue family of command pool.
+  TU32 queueFamilyCount = 0;
+  vkGetPhysicalDeviceQueueFamilyProperties(this->mPhysicalDevice, &queueFamilyCount, nullptr);
+  std::vector<VkQueueFamilyProperties> queueFamilyProperties(queueFamilyCount);
+  vkGetPhysicalDeviceQueueFamilyProperties(this->mPhysicalDevice, &queueFamilyCount, queueFamilyProperties.data());
+  const auto indices = this->GetFindQueueFamilies(this->mPhysicalDevice, VK_QUEUE_GRAPHICS_BIT);
+  const TU32 validBits = queueFamilyProperties[*indices.moptGraphicsQueueFamiliy].timestampValidBits;
+  if (validBits == 0)
+  {
+    std::printf("Mipmap generation comparison is skipped, queue does not support timestamps.\n");
+    return;
+  }
+  const TU64 validMask = validBits >= 64 ? ~TU64(0) : (TU64(1) << validBits) - 1;
+  VkPhysicalDeviceProperties properties;
+  vkGetPhysicalDeviceProperties(this->mPhysicalDevice, &properties);
+
+  VkQueryPoolCreateInfo queryPoolInfo = {};
+  queryPoolInfo.sType       = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+  queryPoolInfo.queryType   = VK_QUERY_TYPE_TIMESTAMP;
+  queryPoolInfo.queryCount  = 2;
+  if (vkCreateQueryPool(this->mGraphicsDevice, &queryPoolInfo, nullptr, &sMipmapQueryPool) != VK_SUCCESS)
+  { throw std::runtime_error("Failed to create mipmap query pool."); }
+
+  // (2) Each path makes whole chain of new image from level 0 of staging buffer.
+  // Pipeline of compute path is created before its command buffer, so it is not timed.
+  const bool isBlittable  = this->IsMipmapBlitSupported(iFormat);
+  const bool isComputable = this->IsMipmapComputeSupported(iFormat, iRequiredMipLevel);
+  for (const bool isCompute : {false, true})
+  {
+    if ((isCompute == true ? isComputable : isBlittable) == false) { continue; }
+
+    VkImageUsageFlags usage = 
+        VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+    if (isCompute == true) { usage |= VK_IMAGE_USAGE_STORAGE_BIT; }
+    TF64 minTime = std::numeric_limits<TF64>::max();
+    for (TU32 i = 0; i < kMipmapComparisonCount; ++i)
+    {
+      VkImage image;
+      VkDeviceMemory imageMemory;
+      this->CreateImage(iWidth, iHeight, iRequiredMipLevel,
+          iFormat, VK_IMAGE_TILING_OPTIMAL, usage, VK_SAMPLE_COUNT_1_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+          image, imageMemory);
+      this->TransitImageLayout(
+          image, iFormat, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, iRequiredMipLevel);
+      this->CopyBufferToImage(iStagingBuffer, image, iWidth, iHeight, 1);
+      if (isCompute == true)
+      {
+        this->GenerateMipmapsWithCompute(image, iFormat, iWidth, iHeight, iRequiredMipLevel);
+      }
+      else
+      {
+        this->GenerateMipmapsWithBlit(image, iWidth, iHeight, iRequiredMipLevel);
+      }
+
+      // Queue is idle after EndSingleTimeCommands, so results are already available.
+      std::array<TU64, 2> timestamps = {};
+      if (vkGetQueryPoolResults(this->mGraphicsDevice, sMipmapQueryPool, 0, 2, 
+              sizeof(timestamps), timestamps.data(), sizeof(TU64), 
+              VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT) != VK_SUCCESS)
+      { throw std::runtime_error("Failed to get mipmap timestamps."); }
+      const TU64 ticks = (timestamps[1] - timestamps[0]) & validMask;
+      minTime = std::min(minTime, TF64(ticks) * properties.limits.timestampPeriod / 1e6);
+
+      vkDestroyImage(this->mGraphicsDevice, image, nullptr);
+      vkFreeMemory(this->mGraphicsDevice, imageMemory, nullptr);
+    }
+
+    std::printf("Mipmap generation GPU time (%s, %ux%u, %u levels, min of %u) : %.3f ms\n",
+        isCompute == true ? "compute" : "blit", iWidth, iHeight, iRequiredMipLevel, kMipmapComparisonCount, minTime);
+  }
+
+  vkDestroyQueryPool(this->mGraphicsDevice, sMipmapQueryPool, nullptr);
+  sMipmapQueryPool = VK_NULL_HANDLE;
+}
+
 VkImageView MVulkanRenderer::CreateImageView(
     VkImage iImage, 
     VkFormat iFormat, 
     VkImageAspectFlagBits iAspectMaskFlag,
-    TU32 iRequireMipLevel)
+    TU32 iRequireMipLevel,
+    TU32 iBaseMipLevel)
 {
   // We also create VkImageView using VkImageViewCreateInfo and vkCreateImageView function.
   // VkImageViewCreateInfo : 
@@ -1946,7 +2706,7 @@ VkImageView MVulkanRenderer::CreateImageView(
   // and which part of the image should be accessed...
   // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/VkImageAspectFlagBits.html
   createInfo.subresourceRange.aspectMask      = iAspectMaskFlag;
-  createInfo.subresourceRange.baseMipLevel    = 0;
+  createInfo.subresourceRange.baseMipLevel    = iBaseMipLevel;
   createInfo.subresourceRange.levelCount      = iRequireMipLevel;
   createInfo.subresourceRange.baseArrayLayer  = 0;
   createInfo.subresourceRange.layerCount      = 1;
@@ -1995,112 +2755,279 @@ void MVulkanRenderer::CreateTextureSampler()
 
 void MVulkanRenderer::LoadModel(const std::string& iModelPath)
 {
-  // In tiny_obj_loader, 
-  // attrib : specifies holds all of the position, normals and texture coordinates 
-  // in .vertices, .normal, .texcoords.
-  // shape : contains all of the separate object and their faces.
-  tinyobj::attrib_t attrib;
-  std::vector<tinyobj::shape_t> shapes;
-  std::vector<tinyobj::material_t> materials;
-  std::string warn, err;
-
-  if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, iModelPath.c_str()))
-  { throw std::runtime_error(warn + err); }
-
-  std::unordered_map<dy::DDefaultVertex, TU32> uniqueVertices = {};
+  // Warm start skips parsing, deduplication and conversion to upload format. Cache is invalidated when OBJ is
+  // changed, and cache of other vertex format is refused by its stride.
+  const auto cachePath = dy::DMeshCache::GetCachePath(iModelPath);
+  sModelCache.emplace(cachePath, iModelPath, static_cast<TU32>(kMeshVertexSize));
+  if (sModelCache->IsValid() == true)
+  {
+    sModelVertexCount = sModelCache->GetVertexCount();
+    sModelIndexCount  = sModelCache->GetIndexCount();
+    sModelBounds      = sModelCache->GetBounds();
+    // Vertices of cache are already written by vertex remap of layout, so layout has no remap.
+    sModelIndexLayout = {};
+    sModelIndexLayout.mIs16Bit = sModelCache->GetIndexSize() == sizeof(TU16);
+    sModelIndexLayout.mSubmeshes.assign(
+        sModelCache->GetSubmeshes(), sModelCache->GetSubmeshes() + sModelCache->GetSubmeshCount());
+    sModelIndexLayout.mSourceVertexCount = sModelVertexCount;
+    sModelDequantization = sModelCache->GetDequantization();
+    // LODs and meshlets are kept after cache is released, because they are selected each frame.
+    sModelLods.assign(sModelCache->GetLods(), sModelCache->GetLods() + sModelCache->GetLodCount());
+    sModelMeshlets.assign(sModelCache->GetMeshlets(), sModelCache->GetMeshlets() + sModelCache->GetMeshletCount());
+    sModelMeshletBounds.assign(
+        sModelCache->GetMeshletBounds(), sModelCache->GetMeshletBounds() + sModelCache->GetMeshletCount());
+    std::printf("Model cache loaded (%s) : %u vertices, %u indices, %u LODs, %u meshlets\n",
+        cachePath.c_str(), sModelVertexCount, sModelIndexCount, sModelCache->GetLodCount(), sModelCache->GetMeshletCount());
+    return;
+  }
+  // Unmap invalid cache before it is overwritten.
+  sModelCache.reset();
+
+  if constexpr (kStreamModelObj == true)
+  {
+    // Vertices are written to model arrays while file is read, so tinyobj arrays and expanded corners are not made.
+    // Corners are deduplicated by their position and texture coordinate indices.
+    const TU32 threadCount = kStreamModelObjParallel == true ? std::max(1u, std::thread::hardware_concurrency()) : 1u;
+    FModelObjSink sink;
+    dy::DObjStreamOptions options;
+    options.mMaxMemorySize = kModelStreamMemorySize;
+    dy::DObjStreamStats stats;
+    std::string error;
+    sModelVertices.clear();
+    sModelIndices.clear();
+    const bool isRead = threadCount > 1
+        ? dy::ReadObjStreamParallel(iModelPath, threadCount, sink, options, &stats, &error)
+        : dy::ReadObjStream(iModelPath, sink, options, &stats, &error);
+    if (isRead == false)
+    {
+      throw std::runtime_error(error);
+    }
 
-  for (const auto& shape : shapes)
+    sModelBounds = stats.mBounds;
+    std::printf("Model stream (%u threads) : %llu corners -> %llu vertices, peak memory %llu KiB\n",
+        threadCount, static_cast<unsigned long long>(stats.mCornerCount), static_cast<unsigned long long>(stats.mVertexCount),
+        static_cast<unsigned long long>(stats.mPeakMemorySize / 1024));
+  }
+  else
   {
-    for (const auto& index : shape.mesh.indices)
+    // In tiny_obj_loader, 
+    // attrib : specifies holds all of the position, normals and texture coordinates 
+    // in .vertices, .normal, .texcoords.
+    // shape : contains all of the separate object and their faces.
+    tinyobj::attrib_t attrib;
+    std::vector<tinyobj::shape_t> shapes;
+    std::vector<tinyobj::material_t> materials;
+    std::string warn, err;
+
+    if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, iModelPath.c_str()))
+    { throw std::runtime_error(warn + err); }
+
+    // tinyobj stores positions as packed (x, y, z) floats, same layout to DVector3 array.
+    sModelBounds = dy::ComputeBounds(
+        reinterpret_cast<const dy::DVector3*>(attrib.vertices.data()), attrib.vertices.size() / 3);
+
+    // Expand triangle corners, then deduplicate them into unique vertices and indices.
+    std::size_t cornerCount = 0;
+    for (const auto& shape : shapes) { cornerCount += shape.mesh.indices.size(); }
+    std::vector<dy::DDefaultVertex> corners;
+    corners.reserve(cornerCount);
+    for (const auto& shape : shapes)
     {
-      dy::DDefaultVertex vertex = {};
-      vertex.mPosition = dy::DVector3{
-        attrib.vertices[3 * index.vertex_index + 0],
-        attrib.vertices[3 * index.vertex_index + 1],
-        attrib.vertices[3 * index.vertex_index + 2],
-      };
-      vertex.mTextureUv0 = dy::DVector2{
-        attrib.texcoords[2 * index.texcoord_index + 0],
-        attrib.texcoords[2 * index.texcoord_index + 1],
-      };
-      vertex.mBaseColor = dy::DVector3{ 1, 1, 1 }; 
-
-      if (uniqueVertices.count(vertex) == 0)
+      for (const auto& index : shape.mesh.indices)
       {
-        uniqueVertices[vertex] = static_cast<TU32>(sModelVertices.size());
-        sModelVertices.emplace_back(vertex);
+        dy::DDefaultVertex& vertex = corners.emplace_back();
+        vertex.mPosition = dy::DVector3{
+          attrib.vertices[3 * index.vertex_index + 0],
+          attrib.vertices[3 * index.vertex_index + 1],
+          attrib.vertices[3 * index.vertex_index + 2],
+        };
+        vertex.mTextureUv0 = dy::DVector2{
+          attrib.texcoords[2 * index.texcoord_index + 0],
+          attrib.texcoords[2 * index.texcoord_index + 1],
+        };
+        vertex.mBaseColor = dy::DVector3{ 1, 1, 1 }; 
       }
+    }
 
-      sModelIndices.emplace_back(uniqueVertices[vertex]);
+    dy::DVertexDedupStats dedupStats;
+    const TU32 threadCount = std::max(1u, std::thread::hardware_concurrency());
+    dy::DeduplicateVerticesParallel(
+        corners.data(), corners.size(), threadCount, sModelVertices, sModelIndices, &dedupStats);
+    std::printf("Model dedup (%u threads) : %u corners -> %u vertices, "
+        "probe average %.3f, max %u, collisions %llu, load %.3f\n",
+        threadCount, static_cast<TU32>(corners.size()), static_cast<TU32>(sModelVertices.size()),
+        dedupStats.GetAverageProbeLength(), dedupStats.mMaxProbeLength,
+        static_cast<unsigned long long>(dedupStats.mCollisionCount),
+        TF64(dedupStats.mUniqueCount) / TF64(dedupStats.mCapacity));
+  }
+
+  sModelVertexCount = static_cast<TU32>(sModelVertices.size());
+  sModelIndexCount  = static_cast<TU32>(sModelIndices.size());
+  if (kOptimizeModelMesh == true && sModelVertices.empty() == false)
+  {
+    const auto before = dy::AnalyzeVertexCache(sModelIndices.data(), sModelIndexCount, sModelVertexCount);
+    dy::OptimizeVertexCache(sModelIndices.data(), sModelIndexCount, sModelVertexCount, sModelIndices.data());
+    const auto afterCache = dy::AnalyzeVertexCache(sModelIndices.data(), sModelIndexCount, sModelVertexCount);
+    dy::OptimizeOverdraw(sModelIndices.data(), sModelIndexCount,
+        sModelVertices[0].mPosition.Data(), sizeof(dy::DDefaultVertex), sModelVertexCount, sModelIndices.data());
+    const auto afterOverdraw = dy::AnalyzeVertexCache(sModelIndices.data(), sModelIndexCount, sModelVertexCount);
+    dy::OptimizeVertexFetch(sModelVertices.data(), sModelVertexCount, sizeof(dy::DDefaultVertex),
+        sModelIndices.data(), sModelIndexCount);
+    std::printf("Model vertex cache (FIFO %u) : ACMR %.3f -> %.3f -> %.3f, ATVR %.3f -> %.3f -> %.3f\n",
+        dy::kDefaultVertexCacheSize,
+        before.mAcmr, afterCache.mAcmr, afterOverdraw.mAcmr,
+        before.mAtvr, afterCache.mAtvr, afterOverdraw.mAtvr);
+  }
+
+  // LODs are simplified from final mesh and reference its vertices, so only indices are appended.
+  // Moving texture coordinate over whole texture costs as much as moving position over whole model.
+  if (sModelVertices.empty() == false)
+  {
+    const auto modelSize = sModelBounds.mMax - sModelBounds.mMin;
+    std::vector<TU32> lodIndices;
+    dy::BuildLodChain(sModelIndices.data(), sModelIndexCount,
+        sModelVertices[0].mPosition.Data(), sModelVertices[0].mTextureUv0.Data(), sizeof(dy::DDefaultVertex),
+        sModelVertexCount, std::max({modelSize.X, modelSize.Y, modelSize.Z}), lodIndices, sModelLods);
+    sModelIndices = std::move(lodIndices);
+    sModelIndexCount = static_cast<TU32>(sModelIndices.size());
+    for (std::size_t lodId = 0; lodId < sModelLods.size(); ++lodId)
+    {
+      std::printf("Model LOD %u : %u triangles, error %f\n",
+          static_cast<TU32>(lodId), sModelLods[lodId].mIndexCount / 3, sModelLods[lodId].mError);
     }
   }
-}
-
-void MVulkanRenderer::CreateVertexBuffer()
-{
-  const VkDeviceSize bufferSize = sizeof(sModelVertices[0]) * sModelVertices.size();
-
-  // (0) We're now going to use a host visible buffer (CPU) as temporary buffer to transfer buffer data
-  // into Client buffer that only visible in GPU so as actual vertex buffer.
-  // HOST VISIBLE BUFFER is called to Staging buffer.
-  VkBuffer stagingBuffer;
-  VkDeviceMemory stagingBufferMemory;
-  // VK_BUFFER_USAGE_TRANSFER_SRC_BIT specifies buffer can be used as the source of a transfer command,
-  // so, stagingBuffer can be source buffer that can be moved to other buffer.
-  this->CreateBuffer(bufferSize, 
-      VK_BUFFER_USAGE_TRANSFER_SRC_BIT, 
-      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-      stagingBuffer,
-      stagingBufferMemory);
 
-  // (4) Copy the vertex data to the VRAM buffer.
-  // This is done by mapping the buffer memory into CPU accessible memory `vkMapMemory`.
-  // So,... using `vkMapMemory`, VRAM buffer memory will be mapped into CPU memory to be accessible
-  // from CPU code.
-  void* data;
-  // `vkMapMemory` function allows us to access a region of the specified memory resource
-  // defined by an [s := sVertexBufferMemory + offset, s + bufferInfo.size). 
-  // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/vkMapMemory.html
-  vkMapMemory(this->mGraphicsDevice, stagingBufferMemory, 0, bufferSize, 0, &data);
+  // Meshlets are built per LOD from final triangle order, and stored in cache with them.
+  sModelMeshlets.clear();
+  for (auto& lod : sModelLods)
+  {
+    auto meshlets = dy::BuildMeshlets(sModelIndices.data() + lod.mFirstIndex, lod.mIndexCount, sModelVertexCount);
+    for (auto& meshlet : meshlets) { meshlet.mFirstIndex += lod.mFirstIndex; }
+    lod.mFirstMeshlet = static_cast<TU32>(sModelMeshlets.size());
+    lod.mMeshletCount = static_cast<TU32>(meshlets.size());
+    sModelMeshlets.insert(sModelMeshlets.end(), meshlets.begin(), meshlets.end());
+  }
+  if (sModelMeshlets.empty() == false)
+  {
+    sModelMeshletBounds.resize(sModelMeshlets.size());
+    dy::ComputeMeshletBounds(sModelMeshlets.data(), sModelMeshlets.size(), sModelIndices.data(),
+        sModelVertices[0].mPosition.Data(), sizeof(dy::DDefaultVertex), sModelMeshletBounds.data());
+    std::printf("Model meshlets (%u vertices, %u triangles) : %u meshlets\n",
+        dy::kDefaultMeshletMaxVertexCount, dy::kDefaultMeshletMaxTriangleCount,
+        static_cast<TU32>(sModelMeshlets.size()));
+  }
+
+  // Index layout is decided with final triangle order, because 16-bit submeshes may have own copy of vertices.
+  // Vertices and indices are converted into upload format here once, and cached in that format.
+  sModelIndexLayout = dy::CreateIndexBufferLayout(
+      sModelIndices.data(), sModelIndexCount, sModelVertexCount, kMeshVertexSize);
+  const TU32 bufferVertexCount = sModelIndexLayout.GetVertexCount();
+  std::printf("Model indices : %u-bit, %u submeshes, %u -> %u vertices\n",
+      sModelIndexLayout.mIs16Bit == true ? 16u : 32u, static_cast<TU32>(sModelIndexLayout.mSubmeshes.size()),
+      sModelVertexCount, bufferVertexCount);
+  sModelBufferVertices.resize(kMeshVertexSize * bufferVertexCount);
+  sModelBufferIndices.resize(sModelIndexLayout.GetIndexSize() * sModelIndexCount);
+  if constexpr (kUseCompactVertex == true)
+  {
+    const dy::DDefaultVertex* vertices = sModelVertices.data();
+    std::vector<dy::DDefaultVertex> remappedVertices;
+    if (sModelIndexLayout.mVertexRemap.empty() == false)
+    {
+      remappedVertices.resize(bufferVertexCount);
+      dy::WriteVertexBuffer(
+          sModelVertices.data(), sizeof(dy::DDefaultVertex), sModelIndexLayout, remappedVertices.data());
+      vertices = remappedVertices.data();
+    }
+    sModelDequantization = dy::QuantizeVertices(
+        vertices->mPosition.Data(), vertices->mBaseColor.Data(), vertices->mTextureUv0.Data(), sizeof(dy::DDefaultVertex),
+        bufferVertexCount, reinterpret_cast<dy::DCompactVertex*>(sModelBufferVertices.data()));
+  }
+  else
+  {
+    sModelDequantization = {};
+    dy::WriteVertexBuffer(
+        sModelVertices.data(), sizeof(dy::DDefaultVertex), sModelIndexLayout, sModelBufferVertices.data());
+  }
+  dy::WriteIndexBuffer(sModelIndices.data(), sModelIndexCount, sModelIndexLayout, sModelBufferIndices.data());
 
-  // Unfortunately the driver may not immediately copy the data into the buffer memory, 
-  // for example because of caching. 
-  // It is also possible that writes to the buffer are not visible in the mapped memory yet. 
-  // There are two ways to deal with that problem:
-  //
-  // 1. Use a memory heap that is host coherent, indicated with VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
-  // 2. Call vkFlushMappedMemoryRanges to after writing to the mapped memory, 
-  // and call vkInvalidateMappedMemoryRanges before reading from the mapped memory
-  // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/vkFlushMappedMemoryRanges.html
-  memcpy(data, sModelVertices.data(), static_cast<size_t>(bufferSize));
-  vkUnmapMemory(this->mGraphicsDevice, stagingBufferMemory);
+  // Vertices of buffer are already written by vertex remap, same to layout read from cache.
+  sModelIndexLayout.mVertexRemap.clear();
+  sModelIndexLayout.mSourceVertexCount = bufferVertexCount;
+  sModelVertexCount = bufferVertexCount;
+  sModelVertices.clear();
+  sModelVertices.shrink_to_fit();
+  sModelIndices.clear();
+  sModelIndices.shrink_to_fit();
 
-  // Flushing memory ranges or using a coherent memory heap means that 
-  // the driver will be aware of our writes to the buffer, 
-  // BUT IT DOESN'T MEAN THAT THEY ARE ACTUALLY VISIBLE ON THE GPU YET. 
-  // The transfer of data to the GPU is an operation that happens in the background 
-  // and the specification simply tells us that it is guaranteed to be complete 
-  // as of the next call to `vkQueueSubmit`.
-  // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/vkQueueSubmit.html
+  if (dy::DMeshCache::Write(cachePath, iModelPath,
+      sModelBufferVertices.data(), static_cast<TU32>(kMeshVertexSize), sModelVertexCount,
+      sModelBufferIndices.data(), static_cast<TU32>(sModelIndexLayout.GetIndexSize()), sModelIndexCount,
+      sModelIndexLayout.mSubmeshes.data(), static_cast<TU32>(sModelIndexLayout.mSubmeshes.size()),
+      sModelBounds, sModelDequantization,
+      sModelMeshlets.data(), sModelMeshletBounds.data(), static_cast<TU32>(sModelMeshlets.size()),
+      sModelLods.data(), static_cast<TU32>(sModelLods.size())) == false)
+  {
+    std::printf("Failed to write model cache %s.\n", cachePath.c_str());
+  }
+}
 
+void MVulkanRenderer::CreateMeshBuffer()
+{
+  const VkDeviceSize bufferSize = kMeshBufferIndexOffset + sizeof(TU32) * VkDeviceSize(kMeshBufferIndexWordCapacity);
   this->CreateBuffer(
     bufferSize,
-    // VBO in OpenGL but transferred from SRC_BIT buffer.
-    VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,     
+    // VBO and EBO in OpenGL but transferred from SRC_BIT buffer.
+    VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
     VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,  // Local buffer of VRAM we can not use vkMapMemory to LOCAL_BIT.
-    sVertexBufferObject,
-    sVertexBufferMemory
+    sMeshBufferObject,
+    sMeshBufferMemory
   );
+}
 
-  // We can copy data from the stagingBuffer to the vertexBuffer (sVertexBufferObject).
-  this->CopyBuffer(stagingBuffer, bufferSize, sVertexBufferObject);
-  vkFreeMemory(this->mGraphicsDevice, stagingBufferMemory, nullptr);
-  vkDestroyBuffer(this->mGraphicsDevice, stagingBuffer, nullptr);
+void MVulkanRenderer::CreateModelMesh()
+{
+  // Vertices and indices are in upload format of cache or LoadModel, so they are only copied into staging buffer.
+  const void* vertices = sModelCache.has_value() == true ? sModelCache->GetVertices() : sModelBufferVertices.data();
+  const void* indices = sModelCache.has_value() == true ? sModelCache->GetIndices() : sModelBufferIndices.data();
+  const std::size_t indexSize = sModelIndexLayout.GetIndexSize();
+  // Finest LOD is drawn until draws are selected in UpdateUniformBuffer.
+  if (sModelLods.empty() == false)
+  {
+    const dy::DIndexSubmesh finestLod = {sModelLods[0].mFirstIndex, sModelLods[0].mIndexCount, 0};
+    dy::SplitRangesBySubmesh({finestLod}, sModelIndexLayout, sModelDraws);
+  }
+
+  sModelMesh = this->AddMesh(
+      sModelVertexCount, sModelIndexCount, static_cast<TU32>(indexSize),
+      [&](void* outVertices, void* outIndices)
+  {
+    std::memcpy(outVertices, vertices, kMeshVertexSize * sModelVertexCount);
+    std::memcpy(outIndices, indices, indexSize * sModelIndexCount);
+  });
+  sModelBufferVertices.clear();
+  sModelBufferVertices.shrink_to_fit();
+  sModelBufferIndices.clear();
+  sModelBufferIndices.shrink_to_fit();
 }
 
-void MVulkanRenderer::CreateIndiceBuffer()
+dy::DMeshHandle MVulkanRenderer::AddMesh(
+    TU32 iVertexCount, TU32 iIndexCount, TU32 iIndexSize,
+    const std::function<void(void* outVertices, void* outIndices)>& iWriteMesh)
 {
-  const VkDeviceSize bufferSize = sizeof(sModelIndices[0]) * sModelIndices.size();
+  const dy::DMeshHandle handle = sMeshRegistry.Add(iVertexCount, iIndexCount, iIndexSize);
+  const dy::DMeshAllocation* allocation = sMeshRegistry.Get(handle);
+  if (allocation == nullptr)
+  {
+    throw std::runtime_error("Failed to allocate mesh in mesh buffer.");
+  }
+
+  // Vertices and indices are written into one staging buffer, and indices follow vertices at 4-byte word.
+  const VkDeviceSize vertexSize = kMeshVertexSize * allocation->mVertexCount;
+  const VkDeviceSize indexSize  = sizeof(TU32) * VkDeviceSize(allocation->mIndexWordCount);
+  const VkDeviceSize stagingSize = vertexSize + indexSize;
+  sDrawMeshes.push_back(handle);
+  ++sDrawMeshVersion;
+  if (stagingSize == 0) { return handle; }
 
   // (0) We're now going to use a host visible buffer (CPU) as temporary buffer to transfer buffer data
   // into Client buffer that only visible in GPU so as actual vertex buffer.
@@ -2109,7 +3036,7 @@ void MVulkanRenderer::CreateIndiceBuffer()
   VkDeviceMemory stagingBufferMemory;
   // VK_BUFFER_USAGE_TRANSFER_SRC_BIT specifies buffer can be used as the source of a transfer command,
   // so, stagingBuffer can be source buffer that can be moved to other buffer.
-  this->CreateBuffer(bufferSize, 
+  this->CreateBuffer(stagingSize, 
       VK_BUFFER_USAGE_TRANSFER_SRC_BIT, 
       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
       stagingBuffer,
@@ -2121,9 +3048,9 @@ void MVulkanRenderer::CreateIndiceBuffer()
   // from CPU code.
   void* data;
   // `vkMapMemory` function allows us to access a region of the specified memory resource
-  // defined by an [s := sVertexBufferMemory + offset, s + bufferInfo.size). 
+  // defined by an [s := stagingBufferMemory + offset, s + bufferInfo.size). 
   // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/vkMapMemory.html
-  vkMapMemory(this->mGraphicsDevice, stagingBufferMemory, 0, bufferSize, 0, &data);
+  vkMapMemory(this->mGraphicsDevice, stagingBufferMemory, 0, stagingSize, 0, &data);
 
   // Unfortunately the driver may not immediately copy the data into the buffer memory, 
   // for example because of caching. 
@@ -2134,7 +3061,7 @@ void MVulkanRenderer::CreateIndiceBuffer()
   // 2. Call vkFlushMappedMemoryRanges to after writing to the mapped memory, 
   // and call vkInvalidateMappedMemoryRanges before reading from the mapped memory
   // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/vkFlushMappedMemoryRanges.html
-  memcpy(data, sModelIndices.data(), static_cast<size_t>(bufferSize));
+  iWriteMesh(data, static_cast<unsigned char*>(data) + vertexSize);
   vkUnmapMemory(this->mGraphicsDevice, stagingBufferMemory);
 
   // Flushing memory ranges or using a coherent memory heap means that 
@@ -2145,19 +3072,25 @@ void MVulkanRenderer::CreateIndiceBuffer()
   // as of the next call to `vkQueueSubmit`.
   // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/vkQueueSubmit.html
 
-  this->CreateBuffer(
-    bufferSize,
-    // VBO in OpenGL but transferred from SRC_BIT buffer.
-    VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,     
-    VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,  // Local buffer of VRAM we can not use vkMapMemory to LOCAL_BIT.
-    sVertexElementObject,
-    sVertexElementMemory
-  );
-
-  // We can copy data from the stagingBuffer to the vertexBuffer (sVertexBufferObject).
-  this->CopyBuffer(stagingBuffer, bufferSize, sVertexElementObject);
+  // We can copy data from the stagingBuffer to ranges of mesh in sMeshBufferObject.
+  const VkBufferCopy vertexRegion = {0, kMeshVertexSize * allocation->mFirstVertex, vertexSize};
+  const VkBufferCopy indexRegion  = {
+      vertexSize, kMeshBufferIndexOffset + sizeof(TU32) * VkDeviceSize(allocation->mIndexWord), indexSize};
+  this->CopyBuffer(stagingBuffer, {vertexRegion, indexRegion}, sMeshBufferObject);
   vkFreeMemory(this->mGraphicsDevice, stagingBufferMemory, nullptr);
   vkDestroyBuffer(this->mGraphicsDevice, stagingBuffer, nullptr);
+  return handle;
+}
+
+void MVulkanRenderer::RemoveMesh(const dy::DMeshHandle& iHandle)
+{
+  const auto it = std::find(sDrawMeshes.begin(), sDrawMeshes.end(), iHandle);
+  if (it == sDrawMeshes.end()) { return; }
+
+  // Frames from now are recorded without the mesh, so only frames submitted until now may draw it.
+  sDrawMeshes.erase(it);
+  ++sDrawMeshVersion;
+  sPendingMeshRemovals.push_back({iHandle, sFrameSerial});
 }
 
 void MVulkanRenderer::CreateUniformBuffers()
@@ -2378,41 +3311,50 @@ void MVulkanRenderer::CreateBuffer(
   }
 }
 
-void MVulkanRenderer::CopyBuffer(VkBuffer inSourceBuffer, VkDeviceSize inSize, VkBuffer outDestBuffer)
+void MVulkanRenderer::CopyBuffer(VkBuffer inSourceBuffer, const std::vector<VkBufferCopy>& inRegions, VkBuffer outDestBuffer)
 {
+  // Size of each region must be greater than 0.
+  std::vector<VkBufferCopy> copyRegions;
+  for (const auto& region : inRegions)
+  {
+    if (region.size > 0) { copyRegions.push_back(region); }
+  }
+  if (copyRegions.empty() == true) { return; }
+
   // (1) To copy buffer from SRC_BIT to DST_BIT buffer,
   // we need to command buffer for copying buffer to buffer.
   // Create buffer.
   const VkCommandBuffer commandBuffer = this->BeginSingleTimeCommands(); 
 
-  VkBufferCopy copyRegion;
-  copyRegion.srcOffset = 0;
-  copyRegion.dstOffset = 0;
-  copyRegion.size = inSize;
-  vkCmdCopyBuffer(commandBuffer, inSourceBuffer, outDestBuffer, 1, &copyRegion);
+  vkCmdCopyBuffer(commandBuffer, inSourceBuffer, outDestBuffer, TU32(copyRegions.size()), copyRegions.data());
 
   this->EndSingleTimeCommands(commandBuffer);
 }
 
-void MVulkanRenderer::CopyBufferToImage(VkBuffer iBuffer, VkImage iImage, TU32 iWidth, TU32 iHeight)
+void MVulkanRenderer::CopyBufferToImage(
+    VkBuffer iBuffer, VkImage iImage, TU32 iWidth, TU32 iHeight, TU32 iMipLevelCount)
 {
   VkCommandBuffer commandBuffer = this->BeginSingleTimeCommands();
 
   // like a buffer copy, need to specify which part of the buffer is going to be copied
-  // to which part of the image.
-  VkBufferImageCopy region;
-  region.bufferOffset       = 0;
-  region.bufferRowLength    = 0;
-  region.bufferImageHeight  = 0;
-
-  VkImageSubresourceLayers imageSubresource;
-  imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
-  imageSubresource.mipLevel       = 0;
-  imageSubresource.baseArrayLayer = 0;
-  imageSubresource.layerCount     = 1;
-  region.imageSubresource = imageSubresource;
-  region.imageOffset = {0, 0, 0};
-  region.imageExtent = {iWidth, iHeight, 1};
+  // to which part of the image. Each level is one region.
+  std::vector<VkBufferImageCopy> regions(iMipLevelCount);
+  for (TU32 level = 0; level < iMipLevelCount; ++level)
+  {
+    auto& region = regions[level];
+    region.bufferOffset       = dy::GetMipLevelOffset(iWidth, iHeight, level);
+    region.bufferRowLength    = 0;
+    region.bufferImageHeight  = 0;
+
+    VkImageSubresourceLayers imageSubresource;
+    imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+    imageSubresource.mipLevel       = level;
+    imageSubresource.baseArrayLayer = 0;
+    imageSubresource.layerCount     = 1;
+    region.imageSubresource = imageSubresource;
+    region.imageOffset = {0, 0, 0};
+    region.imageExtent = {std::max(iWidth >> level, 1u), std::max(iHeight >> level, 1u), 1};
+  }
 
   // The fourth parameter indicates which layout the image is currently using.
   // VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
@@ -2424,7 +3366,7 @@ void MVulkanRenderer::CopyBufferToImage(VkBuffer iBuffer, VkImage iImage, TU32 i
   // https://www.khronos.org/registry/vulkan/specs/1.0/man/html/VkBufferImageCopy.html
   vkCmdCopyBufferToImage(
       commandBuffer, iBuffer, iImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-      1, &region);
+      static_cast<TU32>(regions.size()), regions.data());
 
   EndSingleTimeCommands(commandBuffer);
 }
@@ -2551,10 +3493,8 @@ void MVulkanRenderer::CleanUp()
 
   vkDestroyDescriptorSetLayout(this->mGraphicsDevice, this->mDescriptorSetLayout, nullptr);
 
-  vkFreeMemory(this->mGraphicsDevice, sVertexElementMemory, nullptr);
-  vkDestroyBuffer(this->mGraphicsDevice, sVertexElementObject, nullptr);
-  vkFreeMemory(this->mGraphicsDevice, sVertexBufferMemory, nullptr);
-  vkDestroyBuffer(this->mGraphicsDevice, sVertexBufferObject, nullptr);
+  vkFreeMemory(this->mGraphicsDevice, sMeshBufferMemory, nullptr);
+  vkDestroyBuffer(this->mGraphicsDevice, sMeshBufferObject, nullptr);
 
   for (auto& fence : this->mFencesInFlight)
   {
@@ -2618,6 +3558,17 @@ void MVulkanRenderer::DrawFrame()
       &this->mFencesInFlight[this->mCurrentRenderFrame], 
       VK_TRUE, NumericalMax<TU64>); // Check already (Unsignal => Signaled)
 
+  // Frame of this fence, sFrameSerial - kMaxFramesInFlight, is finished and frames before it are finished too.
+  // Mesh is freed when last frame which may have recorded it, mFrameSerial - 1, is one of them.
+  std::size_t freedCount = 0;
+  while (freedCount < sPendingMeshRemovals.size()
+      && sPendingMeshRemovals[freedCount].mFrameSerial + kMaxFramesInFlight <= sFrameSerial + 1)
+  {
+    sMeshRegistry.Remove(sPendingMeshRemovals[freedCount].mHandle);
+    ++freedCount;
+  }
+  sPendingMeshRemovals.erase(sPendingMeshRemovals.begin(), sPendingMeshRemovals.begin() + freedCount);
+
   // (1) Acquire an image from the swap chain.
   // https://vulkan.lunarg.com/doc/view/1.0.33.0/linux/vkspec.chunked/ch29s06.html
   //
@@ -2647,9 +3598,21 @@ void MVulkanRenderer::DrawFrame()
     throw std::runtime_error("Failed to acquire swap chain image.");
   }
   
+  // Image may be acquired out of order, so previous frame which used this image must be finished
+  // before its uniform buffer and command buffer are written.
+  if (this->mImagesInFlight[imageIndex] != VK_NULL_HANDLE)
+  {
+    vkWaitForFences(this->mGraphicsDevice, 1, &this->mImagesInFlight[imageIndex], VK_TRUE, NumericalMax<TU64>);
+  }
+  this->mImagesInFlight[imageIndex] = this->mFencesInFlight[this->mCurrentRenderFrame];
+
   // If we get imageIndex, imageIndex refers to the `VkImage` in member variable.
   // (If we align list of VkImage, RIP)
   UpdateUniformBuffer(imageIndex);
+  if (kRecordModelDrawsPerFrame == true || sImageDrawMeshVersions[imageIndex] != sDrawMeshVersion)
+  {
+    this->RecordCommandBuffer(imageIndex);
+  }
 
   // (2) Queue submission and synchronization is configured using `VkSubmitIfo` structure.
   // https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/VkSubmitInfo.html
@@ -2690,6 +3653,7 @@ void MVulkanRenderer::DrawFrame()
   {
     throw std::runtime_error("Failed to submit draw command buffer.");
   }
+  ++sFrameSerial;
 
   // (3) Presentation
   VkPresentInfoKHR presentInfo = {};
@@ -2720,18 +3684,55 @@ void MVulkanRenderer::UpdateUniformBuffer(TU32 iCurrentImageIndex)
   ).count();
 
   dy::UUniformBufferObject ubo = {};
-  ubo.uModel = glm::rotate(glm::mat4(1.0f), time * glm::radians(90.0f), glm::vec3(.0f, .0f, 1.f));
-  ubo.uView  = glm::lookAt(glm::vec3(2.0f), glm::vec3(0.0f), glm::vec3(.0f, .0f, 1.f));
+  const auto model = dy::DMatrix3x4::CreateWithTransform(
+      dy::DVector3{0.0f},
+      dy::DQuaternion::CreateWithAxisAngle(dy::DVector3{.0f, .0f, 1.f}, time * 90.0f),
+      dy::DVector3{1.0f});
+  // Dequantization of position is folded into model matrix.
+  ubo.uModel = model.Multiply(sModelDequantization.GetPositionMatrix());
+  // Texture is uploaded in top-down row order of file, so v is flipped here instead of rows.
+  const auto uvTransform = sModelDequantization.GetUvTransform();
+  ubo.uTextureUvTransform = dy::DVector4{uvTransform.X, -uvTransform.Y, uvTransform.Z, 1.0f - uvTransform.W};
+  ubo.uView  = glm::lookAt(static_cast<glm::vec3>(kCameraPosition), glm::vec3(0.0f), glm::vec3(.0f, .0f, 1.f));
   ubo.uProj  = glm::perspective(
       glm::radians(45.f), 
       this->mSwapChainExtent.width / (float) this->mSwapChainExtent.height,
-      0.1f,
+      kNearPlane,
       10.0f);
 
   // We need invert y to negative, because vulkan NDC has negative y axis.
   // https://stackoverflow.com/questions/48036410/why-doesnt-vulkan-use-the-standard-cartesian-coordinate-system
   ubo.uProj[1][1] *= -1; 
 
+  // LOD errors and meshlet bounds are in local space of model, so frustum and camera are moved into it.
+  if (kRecordModelDrawsPerFrame == true && sModelLods.empty() == false)
+  {
+    const auto cameraPosition = model.Inverse().MultiplyPoint(kCameraPosition);
+    if constexpr (kSelectModelLod == true)
+    {
+      // Error is projected at nearest point of model bounds, where one unit covers
+      // (height / 2) * proj[1][1] / distance pixels.
+      const float distance = std::max(
+          (cameraPosition - sModelBounds.GetCenter()).GetLength() - sModelBounds.GetExtent().GetLength(), kNearPlane);
+      const float pixelsPerUnit = 0.5f * this->mSwapChainExtent.height * std::abs(ubo.uProj[1][1]) / distance;
+      sModelLod = dy::SelectLod(sModelLods.data(), sModelLods.size(), kModelLodPixelError / pixelsPerUnit);
+    }
+
+    const auto& lod = sModelLods[sModelLod];
+    if constexpr (kCullModelMeshlets == true)
+    {
+      const dy::DFrustum frustum{ubo.uProj.Multiply(ubo.uView).Multiply(static_cast<dy::DMatrix4>(model))};
+      dy::CullMeshlets(
+          sModelMeshlets.data() + lod.mFirstMeshlet, sModelMeshletBounds.data() + lod.mFirstMeshlet, lod.mMeshletCount,
+          frustum, cameraPosition, sModelVisibleRanges, &sModelCullStats);
+    }
+    else
+    {
+      sModelVisibleRanges.assign(1, dy::DIndexSubmesh{lod.mFirstIndex, lod.mIndexCount, 0});
+    }
+    dy::SplitRangesBySubmesh(sModelVisibleRanges, sModelIndexLayout, sModelDraws);
+  }
+
   void* data;
   vkMapMemory(
       this->mGraphicsDevice, 
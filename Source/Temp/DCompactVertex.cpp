@@ -0,0 +1,64 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include "Temp/DCompactVertex.h"
+
+#include <cstddef>
+
+namespace dy
+{
+
+VkVertexInputBindingDescription& GetCompactVertexBindingDescription()
+{
+  static VkVertexInputBindingDescription bindingDescription = {};
+  static bool isFilled = false;
+  if (isFilled == false)
+  {
+    bindingDescription.binding    = 0;
+    bindingDescription.stride     = sizeof(DCompactVertex);
+    bindingDescription.inputRate  = VK_VERTEX_INPUT_RATE_VERTEX;
+    isFilled = true;
+  }
+  return bindingDescription;
+}
+
+std::vector<VkVertexInputAttributeDescription>& GetCompactVertexAttributeDescriptions()
+{
+  // UNORM formats are converted to [0, 1] float by input assembly, and extra components
+  // not consumed by shader input are discarded. Every format here is mandatory for vertex buffer.
+  static std::vector<VkVertexInputAttributeDescription> attributeDescription = {};
+  static bool isFilled = false;
+  if (isFilled == false)
+  {
+    attributeDescription.resize(3);
+    attributeDescription[0].binding   = 0;
+    attributeDescription[0].location  = 0;
+    attributeDescription[0].format    = VK_FORMAT_R16G16B16A16_UNORM;
+    attributeDescription[0].offset    = offsetof(DCompactVertex, mPosition);
+
+    attributeDescription[1].binding   = 0;
+    attributeDescription[1].location  = 1;
+    attributeDescription[1].format    = VK_FORMAT_R8G8B8A8_UNORM;
+    attributeDescription[1].offset    = offsetof(DCompactVertex, mBaseColor);
+
+    attributeDescription[2].binding   = 0;
+    attributeDescription[2].location  = 2;
+    attributeDescription[2].format    = VK_FORMAT_R16G16_UNORM;
+    attributeDescription[2].offset    = offsetof(DCompactVertex, mTextureUv0);
+    isFilled = true;
+  }
+
+  return attributeDescription;
+}
+
+} /// ::dy namespace
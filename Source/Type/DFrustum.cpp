@@ -0,0 +1,282 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+/// Header file
+#include "Type/DFrustum.h"
+
+#include <cmath>
+#include "Type/FHelperSimd.h"
+
+using dy::simd::MulAdd;
+using dy::simd::Shuffle;
+
+namespace
+{
+
+//!
+//! Overloads to write one kernel for both __m128 and __m256.
+//!
+
+template <typename TRegister> TRegister Set1(float iValue) noexcept;
+
+template <> inline __m128 Set1<__m128>(float iValue) noexcept { return _mm_set1_ps(iValue); }
+inline __m128 Negate(const __m128& a) noexcept { return _mm_sub_ps(_mm_setzero_ps(), a); }
+inline __m128 CmpGe(const __m128& a, const __m128& b) noexcept { return _mm_cmpge_ps(a, b); }
+inline __m128 And(const __m128& a, const __m128& b) noexcept { return _mm_and_ps(a, b); }
+inline int    MoveMask(const __m128& a) noexcept { return _mm_movemask_ps(a); }
+
+#if defined(MDY_SIMD_AVX)
+template <> inline __m256 Set1<__m256>(float iValue) noexcept { return _mm256_set1_ps(iValue); }
+inline __m256 Negate(const __m256& a) noexcept { return _mm256_sub_ps(_mm256_setzero_ps(), a); }
+inline __m256 CmpGe(const __m256& a, const __m256& b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+inline __m256 And(const __m256& a, const __m256& b) noexcept { return _mm256_and_ps(a, b); }
+inline int    MoveMask(const __m256& a) noexcept { return _mm256_movemask_ps(a); }
+
+/// @brief Combine two 4-wide registers into (lower | upper).
+inline __m256 Combine(const __m128& iLower, const __m128& iUpper) noexcept
+{
+  return _mm256_insertf128_ps(_mm256_castps128_ps256(iLower), iUpper, 1);
+}
+#endif
+
+/// @brief Load 4 spheres as (x, y, z, radius) streams.
+inline void Load4(const dy::DSphere* iSpheres, __m128& outX, __m128& outY, __m128& outZ, __m128& outRadius) noexcept
+{
+  outX = _mm_loadu_ps(iSpheres[0].mCenter.Data());
+  outY = _mm_loadu_ps(iSpheres[1].mCenter.Data());
+  outZ = _mm_loadu_ps(iSpheres[2].mCenter.Data());
+  outRadius = _mm_loadu_ps(iSpheres[3].mCenter.Data());
+  _MM_TRANSPOSE4_PS(outX, outY, outZ, outRadius);
+}
+
+/// @brief Load 4 boxes as center (x, y, z) and extent (x, y, z) streams.
+inline void Load4(
+    const dy::DAabb* iBoxes,
+    __m128& outX, __m128& outY, __m128& outZ,
+    __m128& outExtentX, __m128& outExtentY, __m128& outExtentZ) noexcept
+{
+  using dy::simd::TransposeAosToSoa3;
+  // 4 boxes are 8 DVector3 of (min0, max0, min1, max1), (min2, max2, min3, max3).
+  const float* data = iBoxes[0].mMin.Data();
+  __m128 x0, y0, z0, x1, y1, z1;
+  TransposeAosToSoa3(_mm_loadu_ps(data),      _mm_loadu_ps(data + 4),  _mm_loadu_ps(data + 8),  x0, y0, z0);
+  TransposeAosToSoa3(_mm_loadu_ps(data + 12), _mm_loadu_ps(data + 16), _mm_loadu_ps(data + 20), x1, y1, z1);
+
+  const __m128 half = _mm_set1_ps(0.5f);
+  const auto minX = Shuffle<0, 2, 0, 2>(x0, x1), maxX = Shuffle<1, 3, 1, 3>(x0, x1);
+  const auto minY = Shuffle<0, 2, 0, 2>(y0, y1), maxY = Shuffle<1, 3, 1, 3>(y0, y1);
+  const auto minZ = Shuffle<0, 2, 0, 2>(z0, z1), maxZ = Shuffle<1, 3, 1, 3>(z0, z1);
+  outX = _mm_mul_ps(_mm_add_ps(minX, maxX), half);
+  outY = _mm_mul_ps(_mm_add_ps(minY, maxY), half);
+  outZ = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half);
+  outExtentX = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+  outExtentY = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+  outExtentZ = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+}
+
+/// @struct DFrustumKernel
+/// @brief Broadcasted planes to test `sizeof(TRegister) / 4` volumes at once.
+template <typename TRegister>
+struct DFrustumKernel final
+{
+  TRegister mNormal[6][3];
+  TRegister mAbsNormal[6][3];
+  TRegister mDistance[6];
+
+  explicit DFrustumKernel(const dy::DFrustum& iFrustum) noexcept
+  {
+    for (std::size_t p = 0; p < 6; ++p)
+    {
+      const auto& plane = iFrustum.GetPlane(static_cast<dy::DFrustum::EPlane>(p));
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+        this->mNormal[p][i] = Set1<TRegister>(plane[i]);
+        this->mAbsNormal[p][i] = Set1<TRegister>(std::abs(plane[i]));
+      }
+      this->mDistance[p] = Set1<TRegister>(plane.W);
+    }
+  }
+
+  /// @brief Signed distance of center to plane `p`. Same order to scalar `SignedDistance`.
+  TRegister GetDistance(std::size_t p, const TRegister& x, const TRegister& y, const TRegister& z) const noexcept
+  {
+    return MulAdd(this->mNormal[p][2], z, MulAdd(this->mNormal[p][1], y, MulAdd(this->mNormal[p][0], x, this->mDistance[p])));
+  }
+
+  /// @brief Return bit mask of visible spheres.
+  int Test(const TRegister& x, const TRegister& y, const TRegister& z, const TRegister& iRadius) const noexcept
+  {
+    const TRegister negativeRadius = Negate(iRadius);
+    TRegister inside = CmpGe(this->GetDistance(0, x, y, z), negativeRadius);
+    for (std::size_t p = 1; p < 6; ++p)
+    {
+      inside = And(inside, CmpGe(this->GetDistance(p, x, y, z), negativeRadius));
+    }
+    return MoveMask(inside);
+  }
+
+  /// @brief Return bit mask of visible boxes. Projected radius of box to plane is |n|.extent.
+  int Test(
+      const TRegister& x, const TRegister& y, const TRegister& z,
+      const TRegister& ex, const TRegister& ey, const TRegister& ez) const noexcept
+  {
+    const auto isInside = [&](std::size_t p)
+    {
+      const auto& n = this->mAbsNormal[p];
+      const TRegister radius = MulAdd(n[2], ez, MulAdd(n[1], ey, MulAdd(n[0], ex, Set1<TRegister>(0.0f))));
+      return CmpGe(this->GetDistance(p, x, y, z), Negate(radius));
+    };
+
+    TRegister inside = isInside(0);
+    for (std::size_t p = 1; p < 6; ++p) { inside = And(inside, isInside(p)); }
+    return MoveMask(inside);
+  }
+};
+
+template <typename TRegister>
+DFrustumKernel<TRegister> CreateKernel(const dy::DFrustum& iFrustum) noexcept
+{
+  return DFrustumKernel<TRegister>{iFrustum};
+}
+
+/// @brief Append `iBase + k` for each set bit k of `iMask` without branches. \n
+/// Index is always written but count advances only for visible lane,
+/// so written position never exceeds tested index and fits in `iCount` sized buffer.
+inline std::size_t AppendVisible(int iMask, std::size_t iLaneCount, std::size_t iBase, TU32* outIndices, std::size_t iCount) noexcept
+{
+  for (std::size_t k = 0; k < iLaneCount; ++k)
+  {
+    outIndices[iCount] = static_cast<TU32>(iBase + k);
+    iCount += static_cast<std::size_t>((iMask >> k) & 1);
+  }
+  return iCount;
+}
+
+inline float SignedDistance(const dy::DVector4& iPlane, const dy::DVector3& iPoint) noexcept
+{
+  return ((iPlane.X * iPoint.X + iPlane.W) + iPlane.Y * iPoint.Y) + iPlane.Z * iPoint.Z;
+}
+
+} /// anonymous namespace
+
+namespace dy
+{
+
+DFrustum::DFrustum(const DMatrix4& iViewProjection, EDepthRange iDepthRange) noexcept
+{
+  // Row i of column-major matrix. Clip space x = row0.p, w = row3.p and so on.
+  const auto& m = iViewProjection;
+  const DVector4 rows[4] = {
+      {m[0][0], m[1][0], m[2][0], m[3][0]},
+      {m[0][1], m[1][1], m[2][1], m[3][1]},
+      {m[0][2], m[1][2], m[2][2], m[3][2]},
+      {m[0][3], m[1][3], m[2][3], m[3][3]}};
+
+  this->mPlanes[EPlane::Left]   = rows[3] + rows[0];
+  this->mPlanes[EPlane::Right]  = rows[3] - rows[0];
+  this->mPlanes[EPlane::Bottom] = rows[3] + rows[1];
+  this->mPlanes[EPlane::Top]    = rows[3] - rows[1];
+  this->mPlanes[EPlane::Near]   = (iDepthRange == EDepthRange::ZeroToOne) ? rows[2] : rows[3] + rows[2];
+  this->mPlanes[EPlane::Far]    = rows[3] - rows[2];
+
+  for (auto& plane : this->mPlanes)
+  {
+    const float length = std::sqrt(plane.X * plane.X + plane.Y * plane.Y + plane.Z * plane.Z);
+    plane = plane * (1.0f / length);
+  }
+}
+
+bool DFrustum::IsVisible(const DSphere& iSphere) const noexcept
+{
+  for (const auto& plane : this->mPlanes)
+  {
+    if (SignedDistance(plane, iSphere.mCenter) < -iSphere.mRadius) { return false; }
+  }
+  return true;
+}
+
+bool DFrustum::IsVisible(const DAabb& iBox) const noexcept
+{
+  const auto center = iBox.GetCenter();
+  const auto extent = iBox.GetExtent();
+  for (const auto& plane : this->mPlanes)
+  {
+    const float radius = ((std::abs(plane.X) * extent.X) + std::abs(plane.Y) * extent.Y) + std::abs(plane.Z) * extent.Z;
+    if (SignedDistance(plane, center) < -radius) { return false; }
+  }
+  return true;
+}
+
+std::size_t DFrustum::CullSpheres(const DSphere* iSpheres, std::size_t iCount, TU32* outVisibleIndices) const noexcept
+{
+  std::size_t visibleCount = 0;
+  std::size_t i = 0;
+#if defined(MDY_SIMD_AVX)
+  const auto kernel8 = CreateKernel<__m256>(*this);
+  for (; i + 8 <= iCount; i += 8)
+  {
+    __m128 x0, y0, z0, r0, x1, y1, z1, r1;
+    Load4(iSpheres + i, x0, y0, z0, r0);
+    Load4(iSpheres + i + 4, x1, y1, z1, r1);
+    const int mask = kernel8.Test(Combine(x0, x1), Combine(y0, y1), Combine(z0, z1), Combine(r0, r1));
+    visibleCount = AppendVisible(mask, 8, i, outVisibleIndices, visibleCount);
+  }
+#endif
+  const auto kernel4 = CreateKernel<__m128>(*this);
+  for (; i + 4 <= iCount; i += 4)
+  {
+    __m128 x, y, z, radius;
+    Load4(iSpheres + i, x, y, z, radius);
+    visibleCount = AppendVisible(kernel4.Test(x, y, z, radius), 4, i, outVisibleIndices, visibleCount);
+  }
+  for (; i < iCount; ++i)
+  {
+    outVisibleIndices[visibleCount] = static_cast<TU32>(i);
+    visibleCount += this->IsVisible(iSpheres[i]) ? 1 : 0;
+  }
+  return visibleCount;
+}
+
+std::size_t DFrustum::CullAabbs(const DAabb* iBoxes, std::size_t iCount, TU32* outVisibleIndices) const noexcept
+{
+  std::size_t visibleCount = 0;
+  std::size_t i = 0;
+#if defined(MDY_SIMD_AVX)
+  const auto kernel8 = CreateKernel<__m256>(*this);
+  for (; i + 8 <= iCount; i += 8)
+  {
+    __m128 x0, y0, z0, ex0, ey0, ez0, x1, y1, z1, ex1, ey1, ez1;
+    Load4(iBoxes + i, x0, y0, z0, ex0, ey0, ez0);
+    Load4(iBoxes + i + 4, x1, y1, z1, ex1, ey1, ez1);
+    const int mask = kernel8.Test(
+        Combine(x0, x1), Combine(y0, y1), Combine(z0, z1),
+        Combine(ex0, ex1), Combine(ey0, ey1), Combine(ez0, ez1));
+    visibleCount = AppendVisible(mask, 8, i, outVisibleIndices, visibleCount);
+  }
+#endif
+  const auto kernel4 = CreateKernel<__m128>(*this);
+  for (; i + 4 <= iCount; i += 4)
+  {
+    __m128 x, y, z, ex, ey, ez;
+    Load4(iBoxes + i, x, y, z, ex, ey, ez);
+    visibleCount = AppendVisible(kernel4.Test(x, y, z, ex, ey, ez), 4, i, outVisibleIndices, visibleCount);
+  }
+  for (; i < iCount; ++i)
+  {
+    outVisibleIndices[visibleCount] = static_cast<TU32>(i);
+    visibleCount += this->IsVisible(iBoxes[i]) ? 1 : 0;
+  }
+  return visibleCount;
+}
+
+} /// ::dy namespace
@@ -0,0 +1,176 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+/// Header file
+#include "Type/DMatrix3x4.h"
+
+#include <glm/gtc/quaternion.hpp>
+#include "Type/FHelperSimd.h"
+
+using dy::simd::MulAdd;
+using dy::simd::Shuffle;
+using dy::simd::Splat;
+
+namespace
+{
+
+/// @brief Get (0, 0, 0, v.w).
+inline __m128 MaskW(const __m128& iVector) noexcept
+{
+  return _mm_and_ps(iVector, _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0)));
+}
+
+/// @brief Cross product of xyz. w of result is 0 when inputs are finite.
+inline __m128 Cross3(const __m128& a, const __m128& b) noexcept
+{
+  const __m128 aYzx = Shuffle<1, 2, 0, 3>(a, a), bYzx = Shuffle<1, 2, 0, 3>(b, b);
+  const __m128 aZxy = Shuffle<2, 0, 1, 3>(a, a), bZxy = Shuffle<2, 0, 1, 3>(b, b);
+  return _mm_sub_ps(_mm_mul_ps(aYzx, bZxy), _mm_mul_ps(aZxy, bYzx));
+}
+
+/// @brief Dot product of xyz, broadcasted.
+inline __m128 Dot3(const __m128& a, const __m128& b) noexcept
+{
+  const __m128 product = _mm_mul_ps(a, b);
+  return _mm_add_ps(_mm_add_ps(Splat<0>(product), Splat<1>(product)), Splat<2>(product));
+}
+
+} /// anonymous namespace
+
+namespace dy
+{
+
+DMatrix3x4::DMatrix3x4(const DMatrix4& iMatrix) noexcept
+{
+  __m128 c0 = iMatrix[0].__Simd, c1 = iMatrix[1].__Simd, c2 = iMatrix[2].__Simd, c3 = iMatrix[3].__Simd;
+  _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+  this->mRows = {DVector4{c0}, DVector4{c1}, DVector4{c2}};
+}
+
+DMatrix3x4::operator DMatrix4() const noexcept
+{
+  __m128 r0 = this->mRows[0].__Simd, r1 = this->mRows[1].__Simd, r2 = this->mRows[2].__Simd;
+  __m128 r3 = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+  return DMatrix4{DVector4{r0}, DVector4{r1}, DVector4{r2}, DVector4{r3}};
+}
+
+DMatrix3x4 DMatrix3x4::Multiply(const DMatrix3x4& rhs) const noexcept
+{
+  // result row i = lhs[i][0] * rhs row 0 + lhs[i][1] * rhs row 1 + lhs[i][2] * rhs row 2 + (0, 0, 0, lhs[i][3])
+  const auto& r = rhs.mRows;
+  DMatrix3x4 result;
+  for (std::size_t i = 0; i < 3; ++i)
+  {
+    const __m128 row = this->mRows[i].__Simd;
+    __m128 value = _mm_mul_ps(Splat<0>(row), r[0].__Simd);
+    value = MulAdd(Splat<1>(row), r[1].__Simd, value);
+    value = MulAdd(Splat<2>(row), r[2].__Simd, value);
+    result.mRows[i] = _mm_add_ps(value, MaskW(row));
+  }
+  return result;
+}
+
+DVector3 DMatrix3x4::MultiplyPoint(const DVector3& iPoint) const noexcept
+{
+  __m128 c0 = this->mRows[0].__Simd, c1 = this->mRows[1].__Simd, c2 = this->mRows[2].__Simd;
+  __m128 c3 = _mm_setzero_ps();
+  _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+  __m128 result = _mm_mul_ps(c0, _mm_set1_ps(iPoint.X));
+  result = MulAdd(c1, _mm_set1_ps(iPoint.Y), result);
+  result = MulAdd(c2, _mm_set1_ps(iPoint.Z), result);
+  const DVector4 value{_mm_add_ps(result, c3)};
+  return DVector3{value.X, value.Y, value.Z};
+}
+
+DVector3 DMatrix3x4::MultiplyDirection(const DVector3& iDirection) const noexcept
+{
+  __m128 c0 = this->mRows[0].__Simd, c1 = this->mRows[1].__Simd, c2 = this->mRows[2].__Simd;
+  __m128 c3 = _mm_setzero_ps();
+  _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+  __m128 result = _mm_mul_ps(c0, _mm_set1_ps(iDirection.X));
+  result = MulAdd(c1, _mm_set1_ps(iDirection.Y), result);
+  const DVector4 value{MulAdd(c2, _mm_set1_ps(iDirection.Z), result)};
+  return DVector3{value.X, value.Y, value.Z};
+}
+
+DMatrix3x4 DMatrix3x4::Inverse() const noexcept
+{
+  // For upper 3x3 A which has rows r0, r1, r2,
+  // columns of inverse(A) are (r1 x r2, r2 x r0, r0 x r1) / det(A).
+  const __m128 r0 = this->mRows[0].__Simd, r1 = this->mRows[1].__Simd, r2 = this->mRows[2].__Simd;
+  const __m128 inverseDet = _mm_div_ps(_mm_set1_ps(1.0f), Dot3(r0, Cross3(r1, r2)));
+  __m128 c0 = _mm_mul_ps(Cross3(r1, r2), inverseDet);
+  __m128 c1 = _mm_mul_ps(Cross3(r2, r0), inverseDet);
+  __m128 c2 = _mm_mul_ps(Cross3(r0, r1), inverseDet);
+
+  // Translation of inverse is -inverse(A) * t.
+  __m128 translation = _mm_mul_ps(c0, Splat<3>(r0));
+  translation = MulAdd(c1, Splat<3>(r1), translation);
+  translation = MulAdd(c2, Splat<3>(r2), translation);
+  translation = _mm_sub_ps(_mm_setzero_ps(), translation);
+
+  _MM_TRANSPOSE4_PS(c0, c1, c2, translation);
+  return DMatrix3x4{DVector4{c0}, DVector4{c1}, DVector4{c2}};
+}
+
+bool DMatrix3x4::Decompose(DVector3& outTranslation, DQuaternion& outRotation, DVector3& outScale) const noexcept
+{
+  const __m128 r0 = this->mRows[0].__Simd, r1 = this->mRows[1].__Simd, r2 = this->mRows[2].__Simd;
+  outTranslation = this->GetTranslation();
+
+  // Sum of squared rows is squared length of each column.
+  __m128 square = _mm_mul_ps(r0, r0);
+  square = MulAdd(r1, r1, square);
+  square = MulAdd(r2, r2, square);
+  DVector4 scale{_mm_sqrt_ps(square)};
+  if (_mm_cvtss_f32(Dot3(r0, Cross3(r1, r2))) < 0.0f) { scale.X = -scale.X; }
+  outScale = DVector3{scale.X, scale.Y, scale.Z};
+
+  if (scale.X == 0.0f || scale.Y == 0.0f || scale.Z == 0.0f)
+  {
+    outRotation = DQuaternion{};
+    return false;
+  }
+
+  // Remove scale from columns, then get quaternion of pure rotation matrix.
+  scale.W = 1.0f;
+  const DVector4 n0{_mm_div_ps(r0, scale.__Simd)};
+  const DVector4 n1{_mm_div_ps(r1, scale.__Simd)};
+  const DVector4 n2{_mm_div_ps(r2, scale.__Simd)};
+  const glm::mat3 rotation{
+      glm::vec3{n0.X, n1.X, n2.X},
+      glm::vec3{n0.Y, n1.Y, n2.Y},
+      glm::vec3{n0.Z, n1.Z, n2.Z}};
+  outRotation = DQuaternion{glm::quat_cast(rotation)};
+  return true;
+}
+
+DMatrix3x4 DMatrix3x4::CreateWithTransform(
+    const DVector3& iPosition, const DQuaternion& iRotation, const DVector3& iScale) noexcept
+{
+  // Same expressions to DQuaternion::GetRotationMatrix4x4, then scaled per column.
+  const float x = iRotation.X, y = iRotation.Y, z = iRotation.Z, w = iRotation.W;
+  const float xx = x * x, yy = y * y, zz = z * z;
+  const float xy = x * y, xz = x * z, yz = y * z;
+  const float wx = w * x, wy = w * y, wz = w * z;
+
+  const __m128 scale = _mm_set_ps(1.0f, iScale.Z, iScale.Y, iScale.X);
+  return DMatrix3x4{
+      DVector4{_mm_mul_ps(_mm_set_ps(iPosition.X, 2.0f * (xz + wy), 2.0f * (xy - wz), 1.0f - 2.0f * (yy + zz)), scale)},
+      DVector4{_mm_mul_ps(_mm_set_ps(iPosition.Y, 2.0f * (yz - wx), 1.0f - 2.0f * (xx + zz), 2.0f * (xy + wz)), scale)},
+      DVector4{_mm_mul_ps(_mm_set_ps(iPosition.Z, 1.0f - 2.0f * (xx + yy), 2.0f * (yz + wx), 2.0f * (xz - wy)), scale)}};
+}
+
+} /// ::dy namespace
@@ -16,13 +16,190 @@
 
 #include <glm/gtc/matrix_transform.hpp>
 #include "FMacro.h"
+#include "Type/DQuaternion.h"
+#include "Type/FHelperSimd.h"
 
-namespace dy
+namespace
+{
+
+using dy::simd::Splat;
+using dy::simd::Shuffle;
+
+/// @brief Get linear combination of matrix columns with elements of `iVector`. \n
+/// r = c[0] * v.x + c[1] * v.y + c[2] * v.z + c[3] * v.w \n
+/// Summation order is same to glm mat4 * mat4, so result is bit-exact when FMA is off.
+inline __m128 CombineColumns(const std::array<dy::DVector4, 4>& iColumns, const __m128& iVector) noexcept
+{
+  __m128 result = _mm_mul_ps(iColumns[0].__Simd, Splat<0>(iVector));
+#if defined(MDY_SIMD_FMA)
+  result = _mm_fmadd_ps(iColumns[1].__Simd, Splat<1>(iVector), result);
+  result = _mm_fmadd_ps(iColumns[2].__Simd, Splat<2>(iVector), result);
+  result = _mm_fmadd_ps(iColumns[3].__Simd, Splat<3>(iVector), result);
+#else
+  result = _mm_add_ps(result, _mm_mul_ps(iColumns[1].__Simd, Splat<1>(iVector)));
+  result = _mm_add_ps(result, _mm_mul_ps(iColumns[2].__Simd, Splat<2>(iVector)));
+  result = _mm_add_ps(result, _mm_mul_ps(iColumns[3].__Simd, Splat<3>(iVector)));
+#endif
+  return result;
+}
+
+#if defined(MDY_SIMD_AVX)
+/// @brief AVX version of `CombineColumns` that processes two vectors in each 128-bit lane.
+inline __m256 CombineColumns(const std::array<dy::DVector4, 4>& iColumns, const __m256& iVectors) noexcept
+{
+  const __m256 c0 = _mm256_broadcast_ps(&iColumns[0].__Simd);
+  const __m256 c1 = _mm256_broadcast_ps(&iColumns[1].__Simd);
+  const __m256 c2 = _mm256_broadcast_ps(&iColumns[2].__Simd);
+  const __m256 c3 = _mm256_broadcast_ps(&iColumns[3].__Simd);
+  // _mm256_shuffle_ps shuffles in each lane, so each column is broadcasted in its own lane.
+  const __m256 x = _mm256_shuffle_ps(iVectors, iVectors, _MM_SHUFFLE(0, 0, 0, 0));
+  const __m256 y = _mm256_shuffle_ps(iVectors, iVectors, _MM_SHUFFLE(1, 1, 1, 1));
+  const __m256 z = _mm256_shuffle_ps(iVectors, iVectors, _MM_SHUFFLE(2, 2, 2, 2));
+  const __m256 w = _mm256_shuffle_ps(iVectors, iVectors, _MM_SHUFFLE(3, 3, 3, 3));
+
+  __m256 result = _mm256_mul_ps(c0, x);
+#if defined(MDY_SIMD_FMA)
+  result = _mm256_fmadd_ps(c1, y, result);
+  result = _mm256_fmadd_ps(c2, z, result);
+  result = _mm256_fmadd_ps(c3, w, result);
+#else
+  result = _mm256_add_ps(result, _mm256_mul_ps(c1, y));
+  result = _mm256_add_ps(result, _mm256_mul_ps(c2, z));
+  result = _mm256_add_ps(result, _mm256_mul_ps(c3, w));
+#endif
+  return result;
+}
+#endif
+
+//!
+//! 2x2 sub matrix helper functions for inverse. 
+//! 2x2 matrix is packed into one vector as (m00, m01, m10, m11).
+//! https://lxjk.github.io/2017/09/03/Fast-4x4-Matrix-Inverse-with-SSE-SIMD-Explained.html
+//!
+
+/// @brief 2x2 matrix multiplication lhs * rhs.
+inline __m128 Mat2Mul(const __m128& lhs, const __m128& rhs) noexcept
+{
+  return _mm_add_ps(
+      _mm_mul_ps(lhs, Shuffle<0, 3, 0, 3>(rhs, rhs)),
+      _mm_mul_ps(Shuffle<1, 0, 3, 2>(lhs, lhs), Shuffle<2, 1, 2, 1>(rhs, rhs)));
+}
+
+/// @brief 2x2 matrix multiplication adj(lhs) * rhs.
+inline __m128 Mat2AdjMul(const __m128& lhs, const __m128& rhs) noexcept
 {
+  return _mm_sub_ps(
+      _mm_mul_ps(Shuffle<3, 3, 0, 0>(lhs, lhs), rhs),
+      _mm_mul_ps(Shuffle<1, 1, 2, 2>(lhs, lhs), Shuffle<2, 3, 0, 1>(rhs, rhs)));
+}
 
-DMatrix4::DMatrix4(const DVector4& column1, const DVector4& column2,
-                   const DVector4& column3, const DVector4& column4) :
-    mMatrixValue{ column1, column2, column3, column4 } { }
+/// @brief 2x2 matrix multiplication lhs * adj(rhs).
+inline __m128 Mat2MulAdj(const __m128& lhs, const __m128& rhs) noexcept
+{
+  return _mm_sub_ps(
+      _mm_mul_ps(lhs, Shuffle<3, 0, 3, 0>(rhs, rhs)),
+      _mm_mul_ps(Shuffle<1, 0, 3, 2>(lhs, lhs), Shuffle<2, 1, 2, 1>(rhs, rhs)));
+}
+
+/// @brief Inverse general 4x4 matrix with block-wise adjugate. \n
+/// Algorithm is written for row-major matrix, but (M^T)^-1 = (M^-1)^T so columns can be used as rows.
+/// `iColumns` and `outColumns` may be same.
+inline void InverseGeneral(const std::array<dy::DVector4, 4>& iColumns, std::array<dy::DVector4, 4>& outColumns) noexcept
+{
+  const __m128 c0 = iColumns[0].__Simd;
+  const __m128 c1 = iColumns[1].__Simd;
+  const __m128 c2 = iColumns[2].__Simd;
+  const __m128 c3 = iColumns[3].__Simd;
+
+  // M = | A B |
+  //     | C D |
+  const __m128 a = _mm_movelh_ps(c0, c1);
+  const __m128 b = _mm_movehl_ps(c1, c0);
+  const __m128 c = _mm_movelh_ps(c2, c3);
+  const __m128 d = _mm_movehl_ps(c3, c2);
+
+  // Determinants of sub matrices as (|A|, |B|, |C|, |D|).
+  const __m128 detSub = _mm_sub_ps(
+      _mm_mul_ps(Shuffle<0, 2, 0, 2>(c0, c2), Shuffle<1, 3, 1, 3>(c1, c3)),
+      _mm_mul_ps(Shuffle<1, 3, 1, 3>(c0, c2), Shuffle<0, 2, 0, 2>(c1, c3)));
+  const __m128 detA = Splat<0>(detSub);
+  const __m128 detB = Splat<1>(detSub);
+  const __m128 detC = Splat<2>(detSub);
+  const __m128 detD = Splat<3>(detSub);
+
+  // M^-1 = 1/|M| * | X Y |
+  //                | Z W |
+  const __m128 adjDC = Mat2AdjMul(d, c);
+  const __m128 adjAB = Mat2AdjMul(a, b);
+  // X# = |D|A - B(D#C), W# = |A|D - C(A#B)
+  __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Mat2Mul(b, adjDC));
+  __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Mat2Mul(c, adjAB));
+  // Y# = |B|C - D(A#B)#, Z# = |C|B - A(D#C)#
+  __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), Mat2MulAdj(d, adjAB));
+  __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), Mat2MulAdj(a, adjDC));
+
+  // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+  __m128 trace = _mm_mul_ps(adjAB, Shuffle<0, 2, 1, 3>(adjDC, adjDC));
+  trace = _mm_add_ps(trace, _mm_movehl_ps(trace, trace));
+  trace = _mm_add_ps(trace, Splat<1>(trace));
+  __m128 detM = _mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC));
+  detM = _mm_sub_ps(detM, Splat<0>(trace));
+
+  // Apply sign of adjugate to reciprocal of determinant.
+  const __m128 rcpDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+  x = _mm_mul_ps(x, rcpDetM);
+  y = _mm_mul_ps(y, rcpDetM);
+  z = _mm_mul_ps(z, rcpDetM);
+  w = _mm_mul_ps(w, rcpDetM);
+
+  // Adjugate shuffle and store shuffle are combined.
+  outColumns[0].__Simd = Shuffle<3, 1, 3, 1>(x, y);
+  outColumns[1].__Simd = Shuffle<2, 0, 2, 0>(x, y);
+  outColumns[2].__Simd = Shuffle<3, 1, 3, 1>(z, w);
+  outColumns[3].__Simd = Shuffle<2, 0, 2, 0>(z, w);
+}
+
+/// @brief Inverse affine matrix which does not have shear. \n
+/// Upper 3x3 A = RS, so A^-1 = S^-2 A^T and squared scale is squared length of each column.
+/// `iColumns` and `outColumns` may be same.
+inline void InverseNoShearAffine(const std::array<dy::DVector4, 4>& iColumns, std::array<dy::DVector4, 4>& outColumns) noexcept
+{
+  __m128 t0 = iColumns[0].__Simd;
+  __m128 t1 = iColumns[1].__Simd;
+  __m128 t2 = iColumns[2].__Simd;
+  __m128 t3 = _mm_setzero_ps();
+  const __m128 translation = iColumns[3].__Simd;
+  _MM_TRANSPOSE4_PS(t0, t1, t2, t3);
+
+  // Squared scale as (|c0|^2, |c1|^2, |c2|^2, 0).
+  __m128 sizeSqr = _mm_mul_ps(t0, t0);
+  sizeSqr = _mm_add_ps(sizeSqr, _mm_mul_ps(t1, t1));
+  sizeSqr = _mm_add_ps(sizeSqr, _mm_mul_ps(t2, t2));
+  // Avoid division by zero for w lane, and for degenerated column.
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 isNearZero = _mm_cmplt_ps(sizeSqr, _mm_set1_ps(1.e-8f));
+  const __m128 rcpSizeSqr = _mm_div_ps(one, _mm_or_ps(_mm_and_ps(isNearZero, one), _mm_andnot_ps(isNearZero, sizeSqr)));
+
+  t0 = _mm_mul_ps(t0, rcpSizeSqr);
+  t1 = _mm_mul_ps(t1, rcpSizeSqr);
+  t2 = _mm_mul_ps(t2, rcpSizeSqr);
+
+  // -A^-1 * t
+  __m128 inversedTranslation = _mm_mul_ps(t0, Splat<0>(translation));
+  inversedTranslation = _mm_add_ps(inversedTranslation, _mm_mul_ps(t1, Splat<1>(translation)));
+  inversedTranslation = _mm_add_ps(inversedTranslation, _mm_mul_ps(t2, Splat<2>(translation)));
+  inversedTranslation = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), inversedTranslation);
+
+  outColumns[0].__Simd = t0;
+  outColumns[1].__Simd = t1;
+  outColumns[2].__Simd = t2;
+  outColumns[3].__Simd = inversedTranslation;
+}
+
+} /// anonymous namespace
+
+namespace dy
+{
 
 DMatrix4::DMatrix4(const glm::mat4& glmMatrix) noexcept
 {
@@ -205,81 +382,55 @@ DMatrix4& DMatrix4::operator-=(const DMatrix4& rhs) noexcept
   return *this;
 }
 
-DMatrix4 DMatrix4::Transpose() const noexcept
+DMatrix4 DMatrix4::MultiplySimd(const DMatrix4& rhs) const noexcept
 {
-  return DMatrix4{
-      this->mMatrixValue[0][0], this->mMatrixValue[0][1], this->mMatrixValue[0][2], this->mMatrixValue[0][3],
-      this->mMatrixValue[1][0], this->mMatrixValue[1][1], this->mMatrixValue[1][2], this->mMatrixValue[1][3],
-      this->mMatrixValue[2][0], this->mMatrixValue[2][1], this->mMatrixValue[2][2], this->mMatrixValue[2][3],
-      this->mMatrixValue[3][0], this->mMatrixValue[3][1], this->mMatrixValue[3][2], this->mMatrixValue[3][3]
-  };
-}
-
-DMatrix4 DMatrix4::Multiply(const DMatrix4& rhs) const noexcept
-{
-  // Naive! O(N^3)
-  return DMatrix4{
-      (*this)[0][0] * rhs[0][0] + (*this)[1][0] * rhs[0][1] + (*this)[2][0] * rhs[0][2] + (*this)[3][0] * rhs[0][3],
-      (*this)[0][0] * rhs[1][0] + (*this)[1][0] * rhs[1][1] + (*this)[2][0] * rhs[1][2] + (*this)[3][0] * rhs[1][3],
-      (*this)[0][0] * rhs[2][0] + (*this)[1][0] * rhs[2][1] + (*this)[2][0] * rhs[2][2] + (*this)[3][0] * rhs[2][3],
-      (*this)[0][0] * rhs[3][0] + (*this)[1][0] * rhs[3][1] + (*this)[2][0] * rhs[3][2] + (*this)[3][0] * rhs[3][3],
-
-      (*this)[0][1] * rhs[0][0] + (*this)[1][1] * rhs[0][1] + (*this)[2][1] * rhs[0][2] + (*this)[3][1] * rhs[0][3],
-      (*this)[0][1] * rhs[1][0] + (*this)[1][1] * rhs[1][1] + (*this)[2][1] * rhs[1][2] + (*this)[3][1] * rhs[1][3],
-      (*this)[0][1] * rhs[2][0] + (*this)[1][1] * rhs[2][1] + (*this)[2][1] * rhs[2][2] + (*this)[3][1] * rhs[2][3],
-      (*this)[0][1] * rhs[3][0] + (*this)[1][1] * rhs[3][1] + (*this)[2][1] * rhs[3][2] + (*this)[3][1] * rhs[3][3],
-
-      (*this)[0][2] * rhs[0][0] + (*this)[1][2] * rhs[0][1] + (*this)[2][2] * rhs[0][2] + (*this)[3][2] * rhs[0][3],
-      (*this)[0][2] * rhs[1][0] + (*this)[1][2] * rhs[1][1] + (*this)[2][2] * rhs[1][2] + (*this)[3][2] * rhs[1][3],
-      (*this)[0][2] * rhs[2][0] + (*this)[1][2] * rhs[2][1] + (*this)[2][2] * rhs[2][2] + (*this)[3][2] * rhs[2][3],
-      (*this)[0][2] * rhs[3][0] + (*this)[1][2] * rhs[3][1] + (*this)[2][2] * rhs[3][2] + (*this)[3][2] * rhs[3][3],
-
-      (*this)[0][3] * rhs[0][0] + (*this)[1][3] * rhs[0][1] + (*this)[2][3] * rhs[0][2] + (*this)[3][3] * rhs[0][3],
-      (*this)[0][3] * rhs[1][0] + (*this)[1][3] * rhs[1][1] + (*this)[2][3] * rhs[1][2] + (*this)[3][3] * rhs[1][3],
-      (*this)[0][3] * rhs[2][0] + (*this)[1][3] * rhs[2][1] + (*this)[2][3] * rhs[2][2] + (*this)[3][3] * rhs[2][3],
-      (*this)[0][3] * rhs[3][0] + (*this)[1][3] * rhs[3][1] + (*this)[2][3] * rhs[3][2] + (*this)[3][3] * rhs[3][3]
-  };
-}
-
-DVector4 DMatrix4::MultiplyVector(const DVector4& rhs) const noexcept
-{
-  return DVector4{
-      (*this)[0][0] * rhs.X + (*this)[1][0] * rhs.Y + (*this)[2][0] * rhs.Z + (*this)[3][0] * rhs.W,
-      (*this)[0][1] * rhs.X + (*this)[1][1] * rhs.Y + (*this)[2][1] * rhs.Z + (*this)[3][1] * rhs.W,
-      (*this)[0][2] * rhs.X + (*this)[1][2] * rhs.Y + (*this)[2][2] * rhs.Z + (*this)[3][2] * rhs.W,
-      (*this)[0][3] * rhs.X + (*this)[1][3] * rhs.Y + (*this)[2][3] * rhs.Z + (*this)[3][3] * rhs.W
-  };
+  DMatrix4 result;
+#if defined(MDY_SIMD_AVX)
+  // Lower lane is column i, and upper lane is column i + 1.
+  // Columns are contiguous in std::array, so two columns can be loaded at once.
+  for (std::size_t i = 0; i < 4; i += 2)
+  {
+    const __m256 columns = _mm256_loadu_ps(rhs.mMatrixValue[i].Data());
+    _mm256_storeu_ps(result.mMatrixValue[i].Data(), CombineColumns(this->mMatrixValue, columns));
+  }
+#else
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    result.mMatrixValue[i].__Simd = CombineColumns(this->mMatrixValue, rhs.mMatrixValue[i].__Simd);
+  }
+#endif
+  return result;
 }
 
 DMatrix4 DMatrix4::Inverse() const
 {
-  // temporary
-  const glm::mat4 mat = static_cast<glm::mat4>(*this);
-  return glm::inverse(mat);
+  DMatrix4 result;
+  InverseGeneral(this->mMatrixValue, result.mMatrixValue);
+  return result;
 }
 
-DMatrix4 DMatrix4::Identity() noexcept
+DMatrix4 DMatrix4::InverseAffine() const noexcept
 {
-  static DMatrix4 staticInstance { true };
-  return staticInstance;
+  DMatrix4 result;
+  InverseNoShearAffine(this->mMatrixValue, result.mMatrixValue);
+  return result;
 }
 
-DMatrix4 DMatrix4::CreateWithScale(const DVector3& scaleVector)
+void DMatrix4::InverseBatch(const DMatrix4* iMatrices, std::size_t iCount, DMatrix4* outMatrices)
 {
-  return DMatrix4{
-    scaleVector.X, 0, 0, 0,
-    0, scaleVector.Y, 0, 0,
-    0, 0, scaleVector.Z, 0,
-    0, 0, 0,             1};
+  for (std::size_t i = 0; i < iCount; ++i)
+  {
+    // Kernel reads all columns before writing, so in-place inversion is safe.
+    InverseGeneral(iMatrices[i].mMatrixValue, outMatrices[i].mMatrixValue);
+  }
 }
 
-DMatrix4 DMatrix4::CreateWithTranslation(const DVector3& translationPoint)
+void DMatrix4::InverseAffineBatch(const DMatrix4* iMatrices, std::size_t iCount, DMatrix4* outMatrices) noexcept
 {
-  return DMatrix4{
-    1, 0, 0, translationPoint.X,
-    0, 1, 0, translationPoint.Y,
-    0, 0, 1, translationPoint.Z,
-    0, 0, 0, 1};
+  for (std::size_t i = 0; i < iCount; ++i)
+  {
+    InverseNoShearAffine(iMatrices[i].mMatrixValue, outMatrices[i].mMatrixValue);
+  }
 }
 
 DMatrix4 DMatrix4::OrthoProjection(float left, float right, float bottom, float top, float near, float far)
@@ -296,10 +447,7 @@ DMatrix4& DMatrix4::Scale( const DVector3& iScaleFactor)
 
 DMatrix4& DMatrix4::Rotate(const DVector3& iRotationDegreeAngle)
 {
-  MCR_NOTUSED(iRotationDegreeAngle);
-  MDY_NOT_IMPLEMENTED_ASSERT();
-  //const auto mat = this->Multiply(DDyQuaternion(iRotationDegreeAngle).GetRotationMatrix4x4());
-  //(*this)[0] = mat[0]; (*this)[1] = mat[1]; (*this)[2] = mat[2]; (*this)[3] = mat[3];
+  *this = this->Multiply(DQuaternion(iRotationDegreeAngle).GetRotationMatrix4x4());
   return *this;
 }
 
@@ -311,17 +459,6 @@ DMatrix4& DMatrix4::Translate( const DVector3& iPosition)
   return *this;
 }
 
-DMatrix4::DMatrix4(bool)
-{
-  this->mMatrixValue[0][0] = 1;
-  this->mMatrixValue[0][3] = 0;
-  this->mMatrixValue[1][1] = 1;
-  this->mMatrixValue[1][3] = 0;
-  this->mMatrixValue[2][2] = 1;
-  this->mMatrixValue[2][3] = 0;
-  this->mMatrixValue[3][3] = 1;
-}
-
 bool operator==( const DMatrix4& lhs,  const DMatrix4& rhs) noexcept
 {
   for (size_t i = 0; i < 4; ++i)
@@ -0,0 +1,155 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include "Type/DMeshRegistry.h"
+
+#include <algorithm>
+
+namespace dy
+{
+
+DMeshRegistry::DRegion::DRegion(TU32 iCapacity)
+  : mCapacity{iCapacity}
+{
+  if (iCapacity > 0) { this->mFreeRanges.push_back({0, iCapacity}); }
+}
+
+bool DMeshRegistry::DRegion::Allocate(TU32 iCount, TU32& outOffset)
+{
+  if (iCount == 0) { outOffset = 0; return true; }
+
+  for (auto it = this->mFreeRanges.begin(); it != this->mFreeRanges.end(); ++it)
+  {
+    if (it->mCount < iCount) { continue; }
+
+    outOffset = it->mOffset;
+    it->mOffset += iCount;
+    it->mCount  -= iCount;
+    if (it->mCount == 0) { this->mFreeRanges.erase(it); }
+
+    this->mUsedCount += iCount;
+    return true;
+  }
+  return false;
+}
+
+void DMeshRegistry::DRegion::Free(TU32 iOffset, TU32 iCount)
+{
+  if (iCount == 0) { return; }
+  this->mUsedCount -= iCount;
+
+  // Insert before first range after freed range, then merge with previous and next range if adjacent.
+  auto next = std::upper_bound(
+      this->mFreeRanges.begin(), this->mFreeRanges.end(), iOffset,
+      [](TU32 iValue, const DRange& iRange) { return iValue < iRange.mOffset; });
+
+  const bool isPrevAdjacent = next != this->mFreeRanges.begin()
+      && std::prev(next)->mOffset + std::prev(next)->mCount == iOffset;
+  const bool isNextAdjacent = next != this->mFreeRanges.end() && iOffset + iCount == next->mOffset;
+
+  if (isPrevAdjacent == true && isNextAdjacent == true)
+  {
+    std::prev(next)->mCount += iCount + next->mCount;
+    this->mFreeRanges.erase(next);
+  }
+  else if (isPrevAdjacent == true)
+  {
+    std::prev(next)->mCount += iCount;
+  }
+  else if (isNextAdjacent == true)
+  {
+    next->mOffset = iOffset;
+    next->mCount += iCount;
+  }
+  else
+  {
+    this->mFreeRanges.insert(next, {iOffset, iCount});
+  }
+}
+
+TU32 DMeshRegistry::DRegion::GetLargestFreeCount() const noexcept
+{
+  TU32 largest = 0;
+  for (const auto& range : this->mFreeRanges) { largest = std::max(largest, range.mCount); }
+  return largest;
+}
+
+DMeshRegistry::DMeshRegistry(TU32 iVertexCapacity, TU32 iIndexWordCapacity)
+  : mVertexRegion{iVertexCapacity},
+    mIndexRegion{iIndexWordCapacity}
+{ }
+
+DMeshHandle DMeshRegistry::Add(TU32 iVertexCount, TU32 iIndexCount, TU32 iIndexSize)
+{
+  if (iIndexSize != sizeof(TU16) && iIndexSize != sizeof(TU32)) { return {}; }
+
+  // Two 16-bit indices are packed in one word, so odd count takes last word partially.
+  const TU32 indexWordCount = TU32((TU64(iIndexCount) * iIndexSize + 3) / 4);
+
+  DMeshAllocation allocation;
+  if (this->mVertexRegion.Allocate(iVertexCount, allocation.mFirstVertex) == false) { return {}; }
+  if (this->mIndexRegion.Allocate(indexWordCount, allocation.mIndexWord) == false)
+  {
+    this->mVertexRegion.Free(allocation.mFirstVertex, iVertexCount);
+    return {};
+  }
+  allocation.mVertexCount     = iVertexCount;
+  allocation.mIndexWordCount  = indexWordCount;
+  allocation.mIndexCount      = iIndexCount;
+  allocation.mIndexSize       = iIndexSize;
+
+  TU32 slot = 0;
+  if (this->mFreeSlots.empty() == false)
+  {
+    slot = this->mFreeSlots.back();
+    this->mFreeSlots.pop_back();
+  }
+  else
+  {
+    slot = TU32(this->mSlots.size());
+    this->mSlots.emplace_back();
+  }
+
+  auto& item = this->mSlots[slot];
+  item.mAllocation  = allocation;
+  item.mIsUsed      = true;
+  ++this->mMeshCount;
+  return {slot, item.mGeneration};
+}
+
+bool DMeshRegistry::Remove(const DMeshHandle& iHandle)
+{
+  if (this->Get(iHandle) == nullptr) { return false; }
+
+  auto& item = this->mSlots[iHandle.mSlot];
+  this->mVertexRegion.Free(item.mAllocation.mFirstVertex, item.mAllocation.mVertexCount);
+  this->mIndexRegion.Free(item.mAllocation.mIndexWord, item.mAllocation.mIndexWordCount);
+
+  // Bump generation so handles of removed mesh do not find mesh which reuses the slot.
+  item.mIsUsed = false;
+  ++item.mGeneration;
+  this->mFreeSlots.push_back(iHandle.mSlot);
+  --this->mMeshCount;
+  return true;
+}
+
+const DMeshAllocation* DMeshRegistry::Get(const DMeshHandle& iHandle) const noexcept
+{
+  if (iHandle.mSlot >= this->mSlots.size()) { return nullptr; }
+
+  const auto& item = this->mSlots[iHandle.mSlot];
+  if (item.mIsUsed == false || item.mGeneration != iHandle.mGeneration) { return nullptr; }
+  return &item.mAllocation;
+}
+
+} /// ::dy namespace
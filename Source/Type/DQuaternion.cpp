@@ -0,0 +1,156 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+/// Header file
+#include "Type/DQuaternion.h"
+
+#include <cmath>
+#include "Type/FHelperSimd.h"
+
+using dy::simd::Dot4;
+using dy::simd::FlipSign;
+using dy::simd::MulAdd;
+using dy::simd::Shuffle;
+using dy::simd::Splat;
+
+namespace
+{
+
+/// If dot product of two quaternions is bigger than this, Slerp falls back to Nlerp.
+constexpr float kSlerpThreshold = 1.0f - 1e-4f;
+
+/// @brief Negate `iTo` when dot product is negative, to interpolate through shortest path.
+__m128 ChooseShortestPath(const __m128& iTo, const __m128& iDot) noexcept
+{
+  const __m128 sign = _mm_and_ps(iDot, _mm_castsi128_ps(_mm_set1_epi32(int(0x80000000))));
+  return _mm_xor_ps(iTo, sign);
+}
+
+__m128 NormalizeQuaternion(const __m128& iQuaternion) noexcept
+{
+  return _mm_div_ps(iQuaternion, _mm_sqrt_ps(Dot4(iQuaternion, iQuaternion)));
+}
+
+} /// anonymous namespace
+
+namespace dy
+{
+
+DQuaternion::DQuaternion(const DVector3& iEulerDegreeAngle) noexcept
+{
+  constexpr float kHalfDegreeToRadian = 3.14159265358979f / 360.0f;
+  const float sx = std::sin(iEulerDegreeAngle.X * kHalfDegreeToRadian);
+  const float cx = std::cos(iEulerDegreeAngle.X * kHalfDegreeToRadian);
+  const float sy = std::sin(iEulerDegreeAngle.Y * kHalfDegreeToRadian);
+  const float cy = std::cos(iEulerDegreeAngle.Y * kHalfDegreeToRadian);
+  const float sz = std::sin(iEulerDegreeAngle.Z * kHalfDegreeToRadian);
+  const float cz = std::cos(iEulerDegreeAngle.Z * kHalfDegreeToRadian);
+
+  this->X = sx * cy * cz - cx * sy * sz;
+  this->Y = cx * sy * cz + sx * cy * sz;
+  this->Z = cx * cy * sz - sx * sy * cz;
+  this->W = cx * cy * cz + sx * sy * sz;
+}
+
+DQuaternion DQuaternion::Multiply(const DQuaternion& rhs) const noexcept
+{
+  // r = lw * r + lx * (rw, rz, ry, rx)(+-+-) + ly * (rz, rw, rx, ry)(++--) + lz * (ry, rx, rw, rz)(-++-)
+  const __m128& l = this->__Simd;
+  const __m128& r = rhs.__Simd;
+
+  __m128 result = _mm_mul_ps(Splat<3>(l), r);
+  result = MulAdd(Splat<0>(l), FlipSign<0b1010>(Shuffle<3, 2, 1, 0>(r, r)), result);
+  result = MulAdd(Splat<1>(l), FlipSign<0b1100>(Shuffle<2, 3, 0, 1>(r, r)), result);
+  result = MulAdd(Splat<2>(l), FlipSign<0b1001>(Shuffle<1, 0, 3, 2>(r, r)), result);
+  return DQuaternion{result};
+}
+
+float DQuaternion::GetSquareLength() const noexcept
+{
+  return _mm_cvtss_f32(Dot4(this->__Simd, this->__Simd));
+}
+
+DQuaternion DQuaternion::Normalize() const noexcept
+{
+  MDY_ASSERT(this->GetSquareLength() > 0.0f);
+  return DQuaternion{NormalizeQuaternion(this->__Simd)};
+}
+
+DQuaternion DQuaternion::Conjugate() const noexcept
+{
+  return DQuaternion{FlipSign<0b0111>(this->__Simd)};
+}
+
+DVector3 DQuaternion::RotateVector(const DVector3& iVector) const noexcept
+{
+  // v' = v + 2w(u x v) + 2u x (u x v), u = (X, Y, Z).
+  const DVector3 u{this->X, this->Y, this->Z};
+  const DVector3 uv{
+      u.Y * iVector.Z - u.Z * iVector.Y,
+      u.Z * iVector.X - u.X * iVector.Z,
+      u.X * iVector.Y - u.Y * iVector.X};
+  const DVector3 uuv{
+      u.Y * uv.Z - u.Z * uv.Y,
+      u.Z * uv.X - u.X * uv.Z,
+      u.X * uv.Y - u.Y * uv.X};
+  return iVector + (uv * this->W + uuv) * 2.0f;
+}
+
+DMatrix4 DQuaternion::GetRotationMatrix4x4() const noexcept
+{
+  const float xx = this->X * this->X, yy = this->Y * this->Y, zz = this->Z * this->Z;
+  const float xy = this->X * this->Y, xz = this->X * this->Z, yz = this->Y * this->Z;
+  const float wx = this->W * this->X, wy = this->W * this->Y, wz = this->W * this->Z;
+
+  return DMatrix4{
+      1.0f - 2.0f * (yy + zz), 2.0f * (xy - wz),        2.0f * (xz + wy),        0.0f,
+      2.0f * (xy + wz),        1.0f - 2.0f * (xx + zz), 2.0f * (yz - wx),        0.0f,
+      2.0f * (xz - wy),        2.0f * (yz + wx),        1.0f - 2.0f * (xx + yy), 0.0f,
+      0.0f,                    0.0f,                    0.0f,                    1.0f};
+}
+
+float DQuaternion::Dot(const DQuaternion& lhs, const DQuaternion& rhs) noexcept
+{
+  return _mm_cvtss_f32(Dot4(lhs.__Simd, rhs.__Simd));
+}
+
+DQuaternion DQuaternion::Nlerp(const DQuaternion& iFrom, const DQuaternion& iTo, float iOffset) noexcept
+{
+  const __m128 to = ChooseShortestPath(iTo.__Simd, Dot4(iFrom.__Simd, iTo.__Simd));
+  const __m128 result = MulAdd(_mm_set1_ps(iOffset), _mm_sub_ps(to, iFrom.__Simd), iFrom.__Simd);
+  return DQuaternion{NormalizeQuaternion(result)};
+}
+
+DQuaternion DQuaternion::Slerp(const DQuaternion& iFrom, const DQuaternion& iTo, float iOffset) noexcept
+{
+  const __m128 dot = Dot4(iFrom.__Simd, iTo.__Simd);
+  const float cosTheta = std::abs(_mm_cvtss_f32(dot));
+  if (cosTheta > kSlerpThreshold) { return Nlerp(iFrom, iTo, iOffset); }
+
+  const float theta = std::acos(cosTheta);
+  const float inverseSinTheta = 1.0f / std::sin(theta);
+  const float fromWeight = std::sin((1.0f - iOffset) * theta) * inverseSinTheta;
+  const float toWeight = std::sin(iOffset * theta) * inverseSinTheta;
+
+  const __m128 to = ChooseShortestPath(iTo.__Simd, dot);
+  return DQuaternion{MulAdd(_mm_set1_ps(toWeight), to, _mm_mul_ps(_mm_set1_ps(fromWeight), iFrom.__Simd))};
+}
+
+DQuaternion DQuaternion::CreateWithAxisAngle(const DVector3& iAxis, float iDegree) noexcept
+{
+  constexpr float kHalfDegreeToRadian = 3.14159265358979f / 360.0f;
+  const float s = std::sin(iDegree * kHalfDegreeToRadian);
+  return DQuaternion{iAxis.X * s, iAxis.Y * s, iAxis.Z * s, std::cos(iDegree * kHalfDegreeToRadian)};
+}
+
+} /// ::dy namespace
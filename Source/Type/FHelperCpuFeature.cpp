@@ -0,0 +1,84 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+/// Header file
+#include "Type/FHelperCpuFeature.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace
+{
+
+dy::ESimdLevel DetectSimdLevel() noexcept
+{
+#if defined(_MSC_VER)
+  int info[4] = {};
+  __cpuid(info, 0);
+  const int maxLeaf = info[0];
+
+  __cpuid(info, 1);
+  const bool hasFma     = (info[2] & (1 << 12)) != 0;
+  const bool hasOsxsave = (info[2] & (1 << 27)) != 0;
+  const bool hasAvx     = (info[2] & (1 << 28)) != 0;
+
+  // OS must save YMM (bit 1, 2) and ZMM (bit 5, 6, 7) register state on context switch.
+  const unsigned long long xcr0 = (hasOsxsave == true) ? _xgetbv(0) : 0;
+  const bool isYmmSaved = (xcr0 & 0x06) == 0x06;
+  const bool isZmmSaved = (xcr0 & 0xE6) == 0xE6;
+
+  bool hasAvx2 = false, hasAvx512 = false;
+  if (maxLeaf >= 7)
+  {
+    __cpuidex(info, 7, 0);
+    hasAvx2   = (info[1] & (1 << 5)) != 0;
+    hasAvx512 = (info[1] & (1 << 16)) != 0;
+  }
+
+  if (hasAvx512 == true && isZmmSaved == true)                                        { return dy::ESimdLevel::Avx512; }
+  if (hasAvx == true && hasAvx2 == true && hasFma == true && isYmmSaved == true)      { return dy::ESimdLevel::Avx2; }
+  return dy::ESimdLevel::Sse2;
+#else
+  // GCC and Clang check OS register state support in __builtin_cpu_supports.
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))                                { return dy::ESimdLevel::Avx512; }
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))  { return dy::ESimdLevel::Avx2; }
+  return dy::ESimdLevel::Sse2;
+#endif
+}
+
+} /// anonymous namespace
+
+namespace dy
+{
+
+ESimdLevel GetSupportedSimdLevel() noexcept
+{
+  static const ESimdLevel sLevel = DetectSimdLevel();
+  return sLevel;
+}
+
+const char* ToString(ESimdLevel iLevel) noexcept
+{
+  switch (iLevel)
+  {
+  case ESimdLevel::Sse2:    return "SSE2";
+  case ESimdLevel::Avx2:    return "AVX2";
+  case ESimdLevel::Avx512:  return "AVX-512";
+  }
+  return "Unknown";
+}
+
+} /// ::dy namespace
@@ -0,0 +1,218 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include "Type/FHelperIndexBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+
+/// Largest difference between vertices of one 16-bit submesh.
+constexpr TU32 kMaxVertexSpan16 = 0xFFFF;
+/// Largest vertex count of one submesh which has own vertices.
+constexpr TU32 kMaxSubmeshVertexCount16 = 0x10000;
+constexpr TU32 kNoSubmesh = 0xFFFFFFFF;
+
+dy::DIndexBufferLayout CreateIndexBufferLayout32(std::size_t iIndexCount, TU32 iVertexCount)
+{
+  dy::DIndexBufferLayout result;
+  result.mSourceVertexCount = iVertexCount;
+  result.mSubmeshes.push_back(dy::DIndexSubmesh{0, static_cast<TU32>(iIndexCount), 0});
+  return result;
+}
+
+/// @brief Split into submeshes which span at most 65536 vertices.
+/// Return false if any triangle spans more than that.
+bool SplitByVertexSpan(const TU32* iIndices, std::size_t iIndexCount, std::vector<dy::DIndexSubmesh>& outSubmeshes)
+{
+  TU32 minVertex = iIndices[0], maxVertex = iIndices[0];
+  std::size_t firstIndex = 0;
+  for (std::size_t triangle = 0; triangle < iIndexCount / 3; ++triangle)
+  {
+    const TU32* corners = iIndices + triangle * 3;
+    const TU32 triangleMin = std::min({corners[0], corners[1], corners[2]});
+    const TU32 triangleMax = std::max({corners[0], corners[1], corners[2]});
+    if (triangleMax - triangleMin > kMaxVertexSpan16) { return false; }
+
+    const TU32 newMin = std::min(minVertex, triangleMin);
+    const TU32 newMax = std::max(maxVertex, triangleMax);
+    if (newMax - newMin <= kMaxVertexSpan16) { minVertex = newMin; maxVertex = newMax; continue; }
+
+    outSubmeshes.push_back(dy::DIndexSubmesh{
+        static_cast<TU32>(firstIndex), static_cast<TU32>(triangle * 3 - firstIndex), minVertex});
+    firstIndex = triangle * 3;
+    minVertex = triangleMin;
+    maxVertex = triangleMax;
+  }
+  outSubmeshes.push_back(dy::DIndexSubmesh{
+      static_cast<TU32>(firstIndex), static_cast<TU32>(iIndexCount - firstIndex), minVertex});
+  return true;
+}
+
+/// @brief Split into submeshes which have own copy of at most 65536 vertices, in order of first use in submesh.
+void SplitByOwnVertices(
+    const TU32* iIndices, std::size_t iIndexCount, TU32 iVertexCount,
+    std::vector<dy::DIndexSubmesh>& outSubmeshes, std::vector<TU32>& outVertexRemap)
+{
+  // Submesh which has vertex as its own. Vertex is added to remap when it is first used in submesh.
+  std::vector<TU32> ownerSubmeshes(iVertexCount, kNoSubmesh);
+  TU32 submesh = 0;
+  std::size_t firstIndex = 0;
+  std::size_t firstVertex = 0;
+  for (std::size_t triangle = 0; triangle < iIndexCount / 3; ++triangle)
+  {
+    const TU32* corners = iIndices + triangle * 3;
+    TU32 newVertexCount = 0;
+    for (std::size_t corner = 0; corner < 3; ++corner)
+    {
+      const bool isDuplicated = (corner > 0 && corners[corner] == corners[0]) || (corner > 1 && corners[corner] == corners[1]);
+      newVertexCount += ownerSubmeshes[corners[corner]] != submesh && isDuplicated == false;
+    }
+
+    if (outVertexRemap.size() - firstVertex + newVertexCount > kMaxSubmeshVertexCount16)
+    {
+      outSubmeshes.push_back(dy::DIndexSubmesh{
+          static_cast<TU32>(firstIndex), static_cast<TU32>(triangle * 3 - firstIndex), static_cast<TU32>(firstVertex)});
+      ++submesh;
+      firstIndex = triangle * 3;
+      firstVertex = outVertexRemap.size();
+    }
+
+    for (std::size_t corner = 0; corner < 3; ++corner)
+    {
+      if (ownerSubmeshes[corners[corner]] == submesh) { continue; }
+      ownerSubmeshes[corners[corner]] = submesh;
+      outVertexRemap.push_back(corners[corner]);
+    }
+  }
+  outSubmeshes.push_back(dy::DIndexSubmesh{
+      static_cast<TU32>(firstIndex), static_cast<TU32>(iIndexCount - firstIndex), static_cast<TU32>(firstVertex)});
+}
+
+} /// anonymous namespace
+
+namespace dy
+{
+
+DIndexBufferLayout CreateIndexBufferLayout(
+    const TU32* iIndices, std::size_t iIndexCount, TU32 iVertexCount, std::size_t iVertexStride,
+    TU32 iMinSubmeshIndexCount)
+{
+  DIndexBufferLayout result;
+  result.mIs16Bit = true;
+  result.mSourceVertexCount = iVertexCount;
+  if (iIndexCount == 0) { return result; }
+
+  if (SplitByVertexSpan(iIndices, iIndexCount, result.mSubmeshes) == false)
+  {
+    result.mSubmeshes.clear();
+    SplitByOwnVertices(iIndices, iIndexCount, iVertexCount, result.mSubmeshes, result.mVertexRemap);
+
+    // Vertices referenced by several submeshes are duplicated, which must be paid by 16-bit indices.
+    const std::size_t remapCount = result.mVertexRemap.size();
+    const std::size_t duplicatedBytes = (remapCount - std::min<std::size_t>(remapCount, iVertexCount)) * iVertexStride;
+    if (duplicatedBytes >= (sizeof(TU32) - sizeof(TU16)) * iIndexCount)
+    {
+      return CreateIndexBufferLayout32(iIndexCount, iVertexCount);
+    }
+  }
+
+  if (result.mSubmeshes.size() > 1
+  &&  iIndexCount / result.mSubmeshes.size() < iMinSubmeshIndexCount)
+  {
+    return CreateIndexBufferLayout32(iIndexCount, iVertexCount);
+  }
+  return result;
+}
+
+void WriteIndexBuffer(const TU32* iIndices, std::size_t iIndexCount, const DIndexBufferLayout& iLayout, void* outIndices)
+{
+  if (iLayout.mIs16Bit == false)
+  {
+    std::memcpy(outIndices, iIndices, sizeof(TU32) * iIndexCount);
+    return;
+  }
+
+  auto* indices = static_cast<TU16*>(outIndices);
+  if (iLayout.mVertexRemap.empty() == true)
+  {
+    for (const auto& submesh : iLayout.mSubmeshes)
+    {
+      const TU32 end = submesh.mFirstIndex + submesh.mIndexCount;
+      for (TU32 i = submesh.mFirstIndex; i < end; ++i)
+      {
+        indices[i] = static_cast<TU16>(iIndices[i] - submesh.mVertexOffset);
+      }
+    }
+    return;
+  }
+
+  // Local index of source vertex in current submesh, restored from vertex remap.
+  std::vector<TU16> localIndices(iLayout.mSourceVertexCount, 0);
+  for (std::size_t submeshId = 0; submeshId < iLayout.mSubmeshes.size(); ++submeshId)
+  {
+    const auto& submesh = iLayout.mSubmeshes[submeshId];
+    const std::size_t vertexEnd = submeshId + 1 < iLayout.mSubmeshes.size()
+        ? iLayout.mSubmeshes[submeshId + 1].mVertexOffset
+        : iLayout.mVertexRemap.size();
+    for (std::size_t vertex = submesh.mVertexOffset; vertex < vertexEnd; ++vertex)
+    {
+      localIndices[iLayout.mVertexRemap[vertex]] = static_cast<TU16>(vertex - submesh.mVertexOffset);
+    }
+
+    const TU32 end = submesh.mFirstIndex + submesh.mIndexCount;
+    for (TU32 i = submesh.mFirstIndex; i < end; ++i) { indices[i] = localIndices[iIndices[i]]; }
+  }
+}
+
+void WriteVertexBuffer(const void* iVertices, std::size_t iVertexStride, const DIndexBufferLayout& iLayout, void* outVertices)
+{
+  if (iLayout.mVertexRemap.empty() == true)
+  {
+    std::memcpy(outVertices, iVertices, iVertexStride * iLayout.mSourceVertexCount);
+    return;
+  }
+
+  const auto* source = static_cast<const unsigned char*>(iVertices);
+  auto* destination = static_cast<unsigned char*>(outVertices);
+  for (const TU32 vertex : iLayout.mVertexRemap)
+  {
+    std::memcpy(destination, source + iVertexStride * vertex, iVertexStride);
+    destination += iVertexStride;
+  }
+}
+
+void SplitRangesBySubmesh(const std::vector<DIndexSubmesh>& iRanges, const DIndexBufferLayout& iLayout, std::vector<DIndexSubmesh>& outDraws)
+{
+  outDraws.clear();
+  std::size_t submeshId = 0;
+  for (const auto& range : iRanges)
+  {
+    TU32 first = range.mFirstIndex;
+    const TU32 end = range.mFirstIndex + range.mIndexCount;
+    while (first < end && submeshId < iLayout.mSubmeshes.size())
+    {
+      const auto& submesh = iLayout.mSubmeshes[submeshId];
+      const TU32 submeshEnd = submesh.mFirstIndex + submesh.mIndexCount;
+      if (first >= submeshEnd) { ++submeshId; continue; }
+
+      const TU32 drawEnd = std::min(end, submeshEnd);
+      outDraws.push_back(DIndexSubmesh{first, drawEnd - first, submesh.mVertexOffset});
+      first = drawEnd;
+    }
+  }
+}
+
+} /// ::dy namespace
@@ -0,0 +1,302 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include "Type/FHelperMeshOptimize.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include "Type/DVector3.h"
+
+namespace
+{
+
+/// @class FFifoCache
+/// @brief FIFO post-transform cache simulation by timestamps. Vertex is cached while
+/// less than `cache size` misses happened after it is inserted, because hit does not refresh FIFO entry.
+class FFifoCache final
+{
+public:
+  FFifoCache(TU32 iVertexCount, TU32 iCacheSize) : mInsertedAt(iVertexCount, 0), mCacheSize{iCacheSize} {}
+
+  /// @brief Access vertex and return true if it is missed and transformed.
+  bool Access(TU32 iVertex) noexcept
+  {
+    auto& insertedAt = this->mInsertedAt[iVertex];
+    if (insertedAt != 0 && this->mMissCount - insertedAt < this->mCacheSize) { return false; }
+    insertedAt = ++this->mMissCount;
+    return true;
+  }
+
+  /// @brief Evict all vertices.
+  void Flush() noexcept { this->mMissCount += this->mCacheSize; }
+
+private:
+  std::vector<TU64> mInsertedAt;
+  TU64 mMissCount = 0;
+  TU32 mCacheSize;
+};
+
+dy::DVector3 ReadPosition(const float* iPositions, std::size_t iPositionStride, TU32 iVertex) noexcept
+{
+  dy::DVector3 position;
+  std::memcpy(position.Data(),
+      reinterpret_cast<const unsigned char*>(iPositions) + iPositionStride * iVertex, sizeof(float) * 3);
+  return position;
+}
+
+/// @brief Append start triangle of each cluster of [iBegin, iEnd) to `outClusterStarts`.
+/// Cluster is split after the triangle where ACMR from cluster start is not over
+/// `iThreshold` times ACMR of whole range, so reordering clusters costs at most that ratio.
+void SplitSoftBoundaries(
+    const TU32* iIndices, std::size_t iBegin, std::size_t iEnd, float iThreshold,
+    FFifoCache& ioCache, std::vector<std::size_t>& outClusterStarts)
+{
+  ioCache.Flush();
+  TU64 rangeMissCount = 0;
+  for (std::size_t triangle = iBegin; triangle < iEnd; ++triangle)
+  {
+    for (std::size_t corner = 0; corner < 3; ++corner) { rangeMissCount += ioCache.Access(iIndices[triangle * 3 + corner]); }
+  }
+  const TF64 rangeAcmr = TF64(rangeMissCount) / TF64(iEnd - iBegin);
+
+  ioCache.Flush();
+  outClusterStarts.push_back(iBegin);
+  std::size_t clusterStart = iBegin;
+  TU64 missCount = 0;
+  for (std::size_t triangle = iBegin; triangle < iEnd; ++triangle)
+  {
+    for (std::size_t corner = 0; corner < 3; ++corner) { missCount += ioCache.Access(iIndices[triangle * 3 + corner]); }
+
+    const TF64 acmr = TF64(missCount) / TF64(triangle + 1 - clusterStart);
+    if (triangle + 1 < iEnd && acmr <= iThreshold * rangeAcmr)
+    {
+      clusterStart = triangle + 1;
+      missCount = 0;
+      ioCache.Flush();
+      outClusterStarts.push_back(clusterStart);
+    }
+  }
+}
+
+} /// anonymous namespace
+
+namespace dy
+{
+
+DVertexCacheStats AnalyzeVertexCache(
+    const TU32* iIndices, std::size_t iIndexCount, TU32 iVertexCount, TU32 iCacheSize)
+{
+  FFifoCache cache{iVertexCount, iCacheSize};
+  std::vector<bool> isReferenced(iVertexCount, false);
+  TU64 referencedCount = 0;
+
+  DVertexCacheStats result;
+  for (std::size_t i = 0; i < iIndexCount; ++i)
+  {
+    result.mTransformCount += cache.Access(iIndices[i]);
+    if (isReferenced[iIndices[i]] == false) { isReferenced[iIndices[i]] = true; ++referencedCount; }
+  }
+
+  const std::size_t triangleCount = iIndexCount / 3;
+  result.mAcmr = triangleCount == 0 ? 0.0 : TF64(result.mTransformCount) / TF64(triangleCount);
+  result.mAtvr = referencedCount == 0 ? 0.0 : TF64(result.mTransformCount) / TF64(referencedCount);
+  return result;
+}
+
+void OptimizeVertexCache(
+    const TU32* iIndices, std::size_t iIndexCount, TU32 iVertexCount, TU32* outIndices, TU32 iCacheSize)
+{
+  const std::size_t triangleCount = iIndexCount / 3;
+
+  // Triangles adjacent to each vertex, as offsets into packed list.
+  std::vector<TU32> adjacencyOffsets(iVertexCount + 1, 0);
+  for (std::size_t i = 0; i < iIndexCount; ++i) { ++adjacencyOffsets[iIndices[i] + 1]; }
+  for (TU32 vertex = 0; vertex < iVertexCount; ++vertex) { adjacencyOffsets[vertex + 1] += adjacencyOffsets[vertex]; }
+  std::vector<TU32> adjacency(iIndexCount);
+  {
+    std::vector<TU32> cursors(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+    for (std::size_t i = 0; i < iIndexCount; ++i) { adjacency[cursors[iIndices[i]]++] = static_cast<TU32>(i / 3); }
+  }
+
+  // Live triangle count, and timestamp of cache insertion of each vertex.
+  std::vector<TU32> liveCounts(iVertexCount);
+  for (TU32 vertex = 0; vertex < iVertexCount; ++vertex)
+  {
+    liveCounts[vertex] = adjacencyOffsets[vertex + 1] - adjacencyOffsets[vertex];
+  }
+  std::vector<TU32> cacheTimes(iVertexCount, 0);
+  TU32 time = iCacheSize + 1;
+
+  std::vector<bool> isEmitted(triangleCount, false);
+  std::vector<TU32> deadEnds;
+  std::vector<TU32> candidates;
+  std::vector<TU32> result;
+  result.reserve(triangleCount * 3);
+  TU32 cursor = 0;
+
+  // Return vertex which has live triangles from dead-end stack, or next vertex in input order.
+  const auto skipDeadEnd = [&]() -> TI64
+  {
+    while (deadEnds.empty() == false)
+    {
+      const TU32 vertex = deadEnds.back();
+      deadEnds.pop_back();
+      if (liveCounts[vertex] > 0) { return vertex; }
+    }
+    for (; cursor < iVertexCount; ++cursor)
+    {
+      if (liveCounts[cursor] > 0) { return cursor; }
+    }
+    return -1;
+  };
+
+  for (TI64 fanning = skipDeadEnd(); fanning != -1; )
+  {
+    // Emit all live triangles around fanning vertex.
+    candidates.clear();
+    for (TU32 item = adjacencyOffsets[fanning]; item < adjacencyOffsets[fanning + 1]; ++item)
+    {
+      const TU32 triangle = adjacency[item];
+      if (isEmitted[triangle] == true) { continue; }
+      for (std::size_t corner = 0; corner < 3; ++corner)
+      {
+        const TU32 vertex = iIndices[triangle * 3 + corner];
+        result.push_back(vertex);
+        deadEnds.push_back(vertex);
+        candidates.push_back(vertex);
+        --liveCounts[vertex];
+        if (time - cacheTimes[vertex] > iCacheSize) { cacheTimes[vertex] = time++; }
+      }
+      isEmitted[triangle] = true;
+    }
+
+    // Next fanning vertex is the oldest candidate which stays in cache after its live triangles are emitted.
+    TI64 next = -1;
+    TI64 bestPriority = -1;
+    for (const TU32 vertex : candidates)
+    {
+      if (liveCounts[vertex] == 0) { continue; }
+      TI64 priority = 0;
+      if (time - cacheTimes[vertex] + 2 * liveCounts[vertex] <= iCacheSize) { priority = time - cacheTimes[vertex]; }
+      if (priority > bestPriority) { bestPriority = priority; next = vertex; }
+    }
+    fanning = next != -1 ? next : skipDeadEnd();
+  }
+
+  std::copy(result.begin(), result.end(), outIndices);
+}
+
+void OptimizeOverdraw(
+    const TU32* iIndices, std::size_t iIndexCount,
+    const float* iPositions, std::size_t iPositionStride, TU32 iVertexCount,
+    TU32* outIndices, float iThreshold, TU32 iCacheSize)
+{
+  const std::size_t triangleCount = iIndexCount / 3;
+  if (triangleCount == 0) { return; }
+
+  // (1) Hard boundaries are triangles of which all vertices are missed, where cache is restarted.
+  FFifoCache cache{iVertexCount, iCacheSize};
+  std::vector<std::size_t> hardStarts;
+  for (std::size_t triangle = 0; triangle < triangleCount; ++triangle)
+  {
+    TU32 missCount = 0;
+    for (std::size_t corner = 0; corner < 3; ++corner) { missCount += cache.Access(iIndices[triangle * 3 + corner]); }
+    if (missCount == 3) { hardStarts.push_back(triangle); }
+  }
+  if (hardStarts.empty() == true || hardStarts.front() != 0) { hardStarts.insert(hardStarts.begin(), 0); }
+  hardStarts.push_back(triangleCount);
+
+  // (2) Soft boundaries inside of each hard cluster.
+  std::vector<std::size_t> clusterStarts;
+  for (std::size_t i = 0; i + 1 < hardStarts.size(); ++i)
+  {
+    SplitSoftBoundaries(iIndices, hardStarts[i], hardStarts[i + 1], iThreshold, cache, clusterStarts);
+  }
+  clusterStarts.push_back(triangleCount);
+  const std::size_t clusterCount = clusterStarts.size() - 1;
+
+  // (3) Area weighted centroid and normal of each cluster, and of whole mesh.
+  std::vector<DVector3> centroids(clusterCount, DVector3{0.0f});
+  std::vector<DVector3> normals(clusterCount, DVector3{0.0f});
+  std::vector<float> areas(clusterCount, 0.0f);
+  DVector3 meshCentroid{0.0f};
+  float meshArea = 0.0f;
+  for (std::size_t cluster = 0; cluster < clusterCount; ++cluster)
+  {
+    for (std::size_t triangle = clusterStarts[cluster]; triangle < clusterStarts[cluster + 1]; ++triangle)
+    {
+      const auto p0 = ReadPosition(iPositions, iPositionStride, iIndices[triangle * 3 + 0]);
+      const auto p1 = ReadPosition(iPositions, iPositionStride, iIndices[triangle * 3 + 1]);
+      const auto p2 = ReadPosition(iPositions, iPositionStride, iIndices[triangle * 3 + 2]);
+      const auto normal = DVector3::Cross(p1 - p0, p2 - p0);
+      const float area = normal.GetLength();
+
+      centroids[cluster] += (p0 + p1 + p2) * (area / 3.0f);
+      normals[cluster] += normal;
+      areas[cluster] += area;
+    }
+    meshCentroid += centroids[cluster];
+    meshArea += areas[cluster];
+  }
+  if (meshArea > 0.0f) { meshCentroid = meshCentroid * (1.0f / meshArea); }
+
+  // (4) Clusters facing away from mesh center are likely to occlude others, so draw them first.
+  std::vector<float> sortKeys(clusterCount, 0.0f);
+  for (std::size_t cluster = 0; cluster < clusterCount; ++cluster)
+  {
+    const float normalLength = normals[cluster].GetLength();
+    if (areas[cluster] <= 0.0f || normalLength <= 0.0f) { continue; }
+    const auto centroid = centroids[cluster] * (1.0f / areas[cluster]);
+    sortKeys[cluster] = DVector3::Dot(centroid - meshCentroid, normals[cluster] * (1.0f / normalLength));
+  }
+
+  std::vector<TU32> order(clusterCount);
+  for (std::size_t cluster = 0; cluster < clusterCount; ++cluster) { order[cluster] = static_cast<TU32>(cluster); }
+  std::stable_sort(order.begin(), order.end(), [&sortKeys](TU32 lhs, TU32 rhs) { return sortKeys[lhs] > sortKeys[rhs]; });
+
+  std::vector<TU32> result;
+  result.reserve(triangleCount * 3);
+  for (const TU32 cluster : order)
+  {
+    result.insert(result.end(), iIndices + clusterStarts[cluster] * 3, iIndices + clusterStarts[cluster + 1] * 3);
+  }
+  std::copy(result.begin(), result.end(), outIndices);
+}
+
+TU32 OptimizeVertexFetch(void* ioVertices, TU32 iVertexCount, std::size_t iVertexStride,
+    TU32* ioIndices, std::size_t iIndexCount)
+{
+  constexpr TU32 kUnused = 0xFFFFFFFF;
+  std::vector<TU32> remap(iVertexCount, kUnused);
+  TU32 referencedCount = 0;
+  for (std::size_t i = 0; i < iIndexCount; ++i)
+  {
+    auto& newIndex = remap[ioIndices[i]];
+    if (newIndex == kUnused) { newIndex = referencedCount++; }
+    ioIndices[i] = newIndex;
+  }
+
+  TU32 newIndex = referencedCount;
+  for (auto& item : remap) { if (item == kUnused) { item = newIndex++; } }
+
+  auto* vertices = static_cast<unsigned char*>(ioVertices);
+  const std::vector<unsigned char> source(vertices, vertices + iVertexStride * iVertexCount);
+  for (TU32 vertex = 0; vertex < iVertexCount; ++vertex)
+  {
+    std::memcpy(vertices + iVertexStride * remap[vertex], source.data() + iVertexStride * vertex, iVertexStride);
+  }
+  return referencedCount;
+}
+
+} /// ::dy namespace
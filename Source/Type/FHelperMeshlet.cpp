@@ -0,0 +1,177 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include "Type/FHelperMeshlet.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+
+constexpr TU32 kNoMeshlet = 0xFFFFFFFF;
+/// Cone test is disabled when normals spread more than acos(0.1) ~= 84 degrees from axis.
+constexpr float kMinConeDot = 0.1f;
+
+dy::DVector3 ReadPosition(const float* iPositions, std::size_t iPositionStride, TU32 iVertex) noexcept
+{
+  dy::DVector3 position;
+  std::memcpy(position.Data(),
+      reinterpret_cast<const unsigned char*>(iPositions) + iPositionStride * iVertex, sizeof(float) * 3);
+  return position;
+}
+
+/// @brief Check every triangle of meshlet is back-facing from `iCameraPosition`.
+bool IsBackfacing(const dy::DMeshletBounds& iBounds, const dy::DVector3& iCameraPosition) noexcept
+{
+  const auto toCenter = iBounds.mSphere.mCenter - iCameraPosition;
+  return dy::DVector3::Dot(toCenter, iBounds.mConeAxis)
+      >= iBounds.mConeCutoff * toCenter.GetLength() + iBounds.mSphere.mRadius;
+}
+
+} /// anonymous namespace
+
+namespace dy
+{
+
+std::vector<DMeshlet> BuildMeshlets(
+    const TU32* iIndices, std::size_t iIndexCount, TU32 iVertexCount, TU32 iMaxVertexCount, TU32 iMaxTriangleCount)
+{
+  std::vector<DMeshlet> result;
+  if (iIndexCount < 3) { return result; }
+
+  // Meshlet which last referenced vertex, so vertex set is not cleared for each meshlet.
+  std::vector<TU32> lastMeshlets(iVertexCount, kNoMeshlet);
+  DMeshlet current;
+  for (std::size_t triangle = 0; triangle < iIndexCount / 3; ++triangle)
+  {
+    const TU32* corners = iIndices + triangle * 3;
+    const auto meshletId = static_cast<TU32>(result.size());
+    TU32 newVertexCount = 0;
+    for (std::size_t corner = 0; corner < 3; ++corner)
+    {
+      const bool isDuplicated = (corner > 0 && corners[corner] == corners[0]) || (corner > 1 && corners[corner] == corners[1]);
+      newVertexCount += lastMeshlets[corners[corner]] != meshletId && isDuplicated == false;
+    }
+
+    if (current.mTriangleCount == iMaxTriangleCount || current.mVertexCount + newVertexCount > iMaxVertexCount)
+    {
+      result.push_back(current);
+      current = DMeshlet{static_cast<TU32>(triangle * 3), 0, 0};
+      // Every vertex is new in next meshlet.
+      newVertexCount = 3 - (corners[1] == corners[0]) - (corners[2] == corners[0] || corners[2] == corners[1]);
+    }
+
+    for (std::size_t corner = 0; corner < 3; ++corner) { lastMeshlets[corners[corner]] = static_cast<TU32>(result.size()); }
+    current.mTriangleCount += 1;
+    current.mVertexCount += newVertexCount;
+  }
+  result.push_back(current);
+  return result;
+}
+
+void ComputeMeshletBounds(
+    const DMeshlet* iMeshlets, std::size_t iMeshletCount, const TU32* iIndices,
+    const float* iPositions, std::size_t iPositionStride, DMeshletBounds* outBounds)
+{
+  std::vector<DVector3> normals;
+  for (std::size_t meshletId = 0; meshletId < iMeshletCount; ++meshletId)
+  {
+    const auto& meshlet = iMeshlets[meshletId];
+    const TU32* indices = iIndices + meshlet.mFirstIndex;
+    const std::size_t cornerCount = std::size_t{meshlet.mTriangleCount} * 3;
+    DMeshletBounds bounds;
+
+    // (1) Sphere of which center is center of bounding box.
+    auto minPosition = ReadPosition(iPositions, iPositionStride, indices[0]);
+    auto maxPosition = minPosition;
+    for (std::size_t i = 1; i < cornerCount; ++i)
+    {
+      const auto position = ReadPosition(iPositions, iPositionStride, indices[i]);
+      minPosition = DVector3{
+          std::min(minPosition.X, position.X), std::min(minPosition.Y, position.Y), std::min(minPosition.Z, position.Z)};
+      maxPosition = DVector3{
+          std::max(maxPosition.X, position.X), std::max(maxPosition.Y, position.Y), std::max(maxPosition.Z, position.Z)};
+    }
+    bounds.mSphere.mCenter = (minPosition + maxPosition) * 0.5f;
+    for (std::size_t i = 0; i < cornerCount; ++i)
+    {
+      const auto position = ReadPosition(iPositions, iPositionStride, indices[i]);
+      bounds.mSphere.mRadius = std::max(bounds.mSphere.mRadius, (position - bounds.mSphere.mCenter).GetLength());
+    }
+
+    // (2) Normal cone from unit normals of non-degenerate triangles.
+    normals.clear();
+    DVector3 axis{0.0f};
+    for (std::size_t i = 0; i < cornerCount; i += 3)
+    {
+      const auto p0 = ReadPosition(iPositions, iPositionStride, indices[i + 0]);
+      const auto p1 = ReadPosition(iPositions, iPositionStride, indices[i + 1]);
+      const auto p2 = ReadPosition(iPositions, iPositionStride, indices[i + 2]);
+      const auto normal = DVector3::Cross(p1 - p0, p2 - p0);
+      const float length = normal.GetLength();
+      if (length <= 0.0f) { continue; }
+      normals.push_back(normal * (1.0f / length));
+      axis += normals.back();
+    }
+
+    const float axisLength = axis.GetLength();
+    if (normals.empty() == false && axisLength > 0.0f)
+    {
+      axis = axis * (1.0f / axisLength);
+      float minDot = 1.0f;
+      for (const auto& normal : normals) { minDot = std::min(minDot, DVector3::Dot(normal, axis)); }
+      if (minDot > kMinConeDot)
+      {
+        bounds.mConeAxis = axis;
+        bounds.mConeCutoff = std::sqrt(1.0f - minDot * minDot);
+      }
+    }
+    outBounds[meshletId] = bounds;
+  }
+}
+
+void CullMeshlets(
+    const DMeshlet* iMeshlets, const DMeshletBounds* iBounds, std::size_t iMeshletCount,
+    const DFrustum& iFrustum, const DVector3& iCameraPosition,
+    std::vector<DIndexSubmesh>& outRanges, DMeshletCullStats* outStats)
+{
+  outRanges.clear();
+  DMeshletCullStats stats;
+  stats.mMeshletCount = static_cast<TU32>(iMeshletCount);
+
+  for (std::size_t meshletId = 0; meshletId < iMeshletCount; ++meshletId)
+  {
+    const auto& bounds = iBounds[meshletId];
+    if (iFrustum.IsVisible(bounds.mSphere) == false) { ++stats.mFrustumCulledCount; continue; }
+    if (IsBackfacing(bounds, iCameraPosition) == true) { ++stats.mBackfaceCulledCount; continue; }
+
+    const auto& meshlet = iMeshlets[meshletId];
+    const TU32 indexCount = meshlet.mTriangleCount * 3;
+    if (outRanges.empty() == false
+    &&  outRanges.back().mFirstIndex + outRanges.back().mIndexCount == meshlet.mFirstIndex)
+    {
+      outRanges.back().mIndexCount += indexCount;
+    }
+    else
+    {
+      outRanges.push_back(DIndexSubmesh{meshlet.mFirstIndex, indexCount, 0});
+    }
+  }
+
+  stats.mRangeCount = static_cast<TU32>(outRanges.size());
+  if (outStats != nullptr) { *outStats = stats; }
+}
+
+} /// ::dy namespace
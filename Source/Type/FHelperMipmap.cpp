@@ -0,0 +1,366 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+
+/// Header file
+#include "Type/FHelperMipmap.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "FHelperMipmapKernel.h"
+
+namespace
+{
+
+/// Radius of Kaiser filter in destination texels, and alpha which sets width of its window.
+constexpr double kKaiserRadius = 2.0;
+constexpr double kKaiserAlpha  = 4.0;
+/// Levels of less texels than this are filtered by calling thread only, because starting threads costs more.
+constexpr std::size_t kParallelTexelCount = 128 * 128;
+/// Linear value is quantized to 16 bits to index sRGB encode table. Step of darkest value is less than 1/20 of byte.
+constexpr std::size_t kSrgbEncodeTableSize = 65536;
+
+/// @struct DLookupTables
+/// @brief Decode tables are indexed by channel * 256 + byte, so alpha channel stays linear.
+struct DLookupTables final
+{
+  std::array<float, 1024>   mSrgbDecode;
+  std::array<float, 1024>   mLinearDecode;
+  std::vector<std::uint8_t> mSrgbEncode;
+};
+
+double SrgbToLinear(double iValue)
+{
+  return iValue <= 0.04045 ? iValue / 12.92 : std::pow((iValue + 0.055) / 1.055, 2.4);
+}
+
+double LinearToSrgb(double iValue)
+{
+  return iValue <= 0.0031308 ? iValue * 12.92 : 1.055 * std::pow(iValue, 1.0 / 2.4) - 0.055;
+}
+
+const DLookupTables& GetLookupTables()
+{
+  // Local static is initialized once even if threads race.
+  static const DLookupTables sTables = []
+  {
+    DLookupTables tables;
+    for (std::size_t channel = 0; channel < 4; ++channel)
+    {
+      for (std::size_t value = 0; value < 256; ++value)
+      {
+        const double linear = value / 255.0;
+        tables.mLinearDecode[channel * 256 + value] = static_cast<float>(linear);
+        tables.mSrgbDecode[channel * 256 + value] = static_cast<float>(channel == 3 ? linear : SrgbToLinear(linear));
+      }
+    }
+    tables.mSrgbEncode.resize(kSrgbEncodeTableSize);
+    for (std::size_t i = 0; i < kSrgbEncodeTableSize; ++i)
+    {
+      const double srgb = LinearToSrgb(double(i) / (kSrgbEncodeTableSize - 1));
+      tables.mSrgbEncode[i] = static_cast<std::uint8_t>(std::lround(srgb * 255.0));
+    }
+    return tables;
+  }();
+  return sTables;
+}
+
+const dy::DMipmapKernelTable& GetKernelOfLevel(dy::ESimdLevel iLevel) noexcept
+{
+  switch (iLevel)
+  {
+  case dy::ESimdLevel::Avx512:
+  case dy::ESimdLevel::Avx2:   return dy::GetMipmapKernelAvx2();
+  default:                     return dy::GetMipmapKernelSse();
+  }
+}
+
+/// Selected kernel table. Null until first call, then selected from CPUID.
+std::atomic<const dy::DMipmapKernelTable*> sKernel = nullptr;
+
+const dy::DMipmapKernelTable& GetKernel() noexcept
+{
+  auto* pKernel = sKernel.load(std::memory_order_acquire);
+  if (pKernel == nullptr)
+  {
+    // Racing threads select same table, so just overwrite.
+    pKernel = &GetKernelOfLevel(dy::GetSupportedSimdLevel());
+    sKernel.store(pKernel, std::memory_order_release);
+  }
+  return *pKernel;
+}
+
+/// @brief Modified Bessel function of first kind and order 0, by power series.
+double BesselI0(double iValue)
+{
+  const double quarterSquare = iValue * iValue * 0.25;
+  double sum = 1.0;
+  double term = 1.0;
+  for (int k = 1; term > sum * 1e-12; ++k)
+  {
+    term *= quarterSquare / (double(k) * k);
+    sum += term;
+  }
+  return sum;
+}
+
+/// @brief Kaiser windowed sinc of `iOffset` destination texels.
+double KaiserSinc(double iOffset)
+{
+  if (std::abs(iOffset) >= kKaiserRadius) { return 0.0; }
+
+  constexpr double kPi = 3.14159265358979323846;
+  const double sinc = iOffset == 0.0 ? 1.0 : std::sin(kPi * iOffset) / (kPi * iOffset);
+  const double normalized = iOffset / kKaiserRadius;
+  return sinc * BesselI0(kKaiserAlpha * std::sqrt(1.0 - normalized * normalized)) / BesselI0(kKaiserAlpha);
+}
+
+/// @struct DFilterAxis
+/// @brief Taps of one axis from source size to destination size.
+/// Every destination texel has `mTapCount` taps from source texel `mFirst[x]`, and unused taps have 0 weight.
+/// Taps may be outside of source by `mPadding` texels, which are clamped to edge.
+struct DFilterAxis final
+{
+  TU32 mTapCount = 0;
+  TI32 mPadding  = 0;
+  std::vector<TI32>   mFirst;
+  std::vector<float>  mWeights;
+};
+
+DFilterAxis CreateFilterAxis(TU32 iSource, TU32 iDestination, dy::EMipmapFilter iFilter)
+{
+  // Radius is in source texels. Box covers destination texel, Kaiser covers kKaiserRadius destination texels.
+  const double ratio = double(iSource) / iDestination;
+  const double radius = (iFilter == dy::EMipmapFilter::Box ? 0.5 : kKaiserRadius) * ratio;
+  const TU32 maxTapCount = static_cast<TU32>(std::ceil(2.0 * radius)) + 1;
+
+  std::vector<double> weights(std::size_t(iDestination) * maxTapCount, 0.0);
+  std::vector<TI32> first(iDestination);
+  TU32 minUsedTap = maxTapCount;
+  TU32 maxUsedTap = 0;
+  for (TU32 x = 0; x < iDestination; ++x)
+  {
+    const double center = (x + 0.5) * ratio;
+    first[x] = static_cast<TI32>(std::floor(center - radius));
+
+    double* texelWeights = &weights[std::size_t(x) * maxTapCount];
+    double sum = 0.0;
+    for (TU32 k = 0; k < maxTapCount; ++k)
+    {
+      const double source = double(first[x]) + k;
+      double weight = 0.0;
+      if (iFilter == dy::EMipmapFilter::Box)
+      {
+        weight = std::max(std::min(source + 1.0, center + radius) - std::max(source, center - radius), 0.0);
+      }
+      else
+      {
+        weight = KaiserSinc((source + 0.5 - center) / ratio);
+      }
+      // Drop rounding noise of coverage, so taps of nothing are trimmed below.
+      if (std::abs(weight) < 1e-7) { weight = 0.0; }
+
+      texelWeights[k] = weight;
+      sum += weight;
+      if (weight != 0.0)
+      {
+        minUsedTap = std::min(minUsedTap, k);
+        maxUsedTap = std::max(maxUsedTap, k);
+      }
+    }
+    for (TU32 k = 0; k < maxTapCount; ++k) { texelWeights[k] /= sum; }
+  }
+
+  // Trim taps which no destination texel uses.
+  DFilterAxis axis;
+  axis.mTapCount = maxUsedTap - minUsedTap + 1;
+  axis.mFirst.resize(iDestination);
+  axis.mWeights.resize(std::size_t(iDestination) * axis.mTapCount);
+  for (TU32 x = 0; x < iDestination; ++x)
+  {
+    axis.mFirst[x] = first[x] + static_cast<TI32>(minUsedTap);
+    for (TU32 k = 0; k < axis.mTapCount; ++k)
+    {
+      axis.mWeights[std::size_t(x) * axis.mTapCount + k]
+          = static_cast<float>(weights[std::size_t(x) * maxTapCount + minUsedTap + k]);
+    }
+    axis.mPadding = std::max({axis.mPadding, -axis.mFirst[x],
+        axis.mFirst[x] + static_cast<TI32>(axis.mTapCount) - static_cast<TI32>(iSource)});
+  }
+  return axis;
+}
+
+/// @struct DLevelJob
+/// @brief Source and destination level of one level filtering, shared by threads which filter its rows.
+struct DLevelJob final
+{
+  const dy::DMipmapKernelTable* mKernel;
+  const float*        mDecodeTable;
+  const std::uint8_t* mEncodeTable;
+  const std::uint8_t* mSource;
+  TU32                mSourceWidth;
+  TU32                mSourceHeight;
+  std::uint8_t*       mDestination;
+  TU32                mDestinationWidth;
+  DFilterAxis         mHorizontal;
+  DFilterAxis         mVertical;
+  /// First taps of mHorizontal in padded row.
+  std::vector<TI32>   mPaddedFirst;
+};
+
+/// @brief Filter destination rows from `iRowBegin` to `iRowEnd` of `iJob`.
+void FilterRows(const DLevelJob& iJob, TU32 iRowBegin, TU32 iRowEnd)
+{
+  const auto& kernel = *iJob.mKernel;
+  const std::size_t sourceFloatCount = std::size_t(iJob.mSourceWidth) * 4;
+  const std::size_t paddingFloatCount = std::size_t(iJob.mHorizontal.mPadding) * 4;
+
+  // Decoded source rows are cached in slot of (row % slot count), because next destination row reuses
+  // rows of overlapped taps. Taps of one row are contiguous, so they never share slot.
+  const auto& vertical = iJob.mVertical;
+  const std::size_t slotCount = std::size_t(vertical.mTapCount) + 3;
+  std::vector<float> decoded(sourceFloatCount * slotCount);
+  std::vector<TI32>  decodedRows(slotCount, -1);
+  std::vector<float> padded(sourceFloatCount + 2 * paddingFloatCount);
+  std::vector<float> filtered(std::size_t(iJob.mDestinationWidth) * 4);
+  float* row = padded.data() + paddingFloatCount;
+
+  for (TU32 y = iRowBegin; y < iRowEnd; ++y)
+  {
+    // (1) Vertical taps are accumulated into one source row. Rows outside of source are clamped to edge.
+    std::fill(row, row + sourceFloatCount, 0.0f);
+    for (TU32 k = 0; k < vertical.mTapCount; ++k)
+    {
+      const float weight = vertical.mWeights[std::size_t(y) * vertical.mTapCount + k];
+      if (weight == 0.0f) { continue; }
+
+      const TI32 sourceY = std::clamp(vertical.mFirst[y] + static_cast<TI32>(k), 0, static_cast<TI32>(iJob.mSourceHeight) - 1);
+      const std::size_t slot = std::size_t(sourceY) % slotCount;
+      float* decodedRow = decoded.data() + slot * sourceFloatCount;
+      if (decodedRows[slot] != sourceY)
+      {
+        kernel.mDecodeRow(iJob.mSource + std::size_t(sourceY) * sourceFloatCount, iJob.mSourceWidth, iJob.mDecodeTable, decodedRow);
+        decodedRows[slot] = sourceY;
+      }
+      kernel.mAccumulateRow(decodedRow, weight, sourceFloatCount, row);
+    }
+
+    // (2) Edge texels are repeated into padding, so horizontal taps read contiguous texels.
+    for (std::size_t i = 0; i < paddingFloatCount; i += 4)
+    {
+      std::copy(row, row + 4, padded.data() + i);
+      std::copy(row + sourceFloatCount - 4, row + sourceFloatCount, row + sourceFloatCount + i);
+    }
+    kernel.mFilterRow(padded.data(), iJob.mPaddedFirst.data(),
+        iJob.mHorizontal.mWeights.data(), iJob.mHorizontal.mTapCount, iJob.mDestinationWidth, filtered.data());
+    kernel.mEncodeRow(filtered.data(), iJob.mDestinationWidth, iJob.mEncodeTable,
+        iJob.mDestination + std::size_t(y) * iJob.mDestinationWidth * 4);
+  }
+}
+
+TU32 GetLevelSize(TU32 iSize, TU32 iLevel) noexcept
+{
+  return std::max(iSize >> iLevel, 1u);
+}
+
+} /// anonymous namespace
+
+namespace dy
+{
+
+TU32 GetMipLevelCount(TU32 iWidth, TU32 iHeight) noexcept
+{
+  TU32 count = 0;
+  for (TU32 size = std::max(iWidth, iHeight); size > 0; size >>= 1) { ++count; }
+  return count;
+}
+
+std::size_t GetMipLevelOffset(TU32 iWidth, TU32 iHeight, TU32 iLevel) noexcept
+{
+  return GetMipChainSize(iWidth, iHeight, iLevel);
+}
+
+std::size_t GetMipChainSize(TU32 iWidth, TU32 iHeight, TU32 iLevelCount) noexcept
+{
+  std::size_t size = 0;
+  for (TU32 level = 0; level < iLevelCount; ++level)
+  {
+    size += std::size_t(GetLevelSize(iWidth, level)) * GetLevelSize(iHeight, level) * 4;
+  }
+  return size;
+}
+
+bool GenerateMipChain(void* ioPixels, TU32 iWidth, TU32 iHeight, TU32 iLevelCount, const DMipmapOptions& iOptions)
+{
+  if (ioPixels == nullptr || iWidth == 0 || iHeight == 0
+  ||  iLevelCount == 0 || iLevelCount > GetMipLevelCount(iWidth, iHeight))
+  { return false; }
+
+  const auto& tables = GetLookupTables();
+  const TU32 threadCount = iOptions.mThreadCount > 0 
+      ? iOptions.mThreadCount 
+      : std::max(std::thread::hardware_concurrency(), 1u);
+  auto* pixels = static_cast<std::uint8_t*>(ioPixels);
+
+  // Each level is filtered from previous level, so levels are in order and rows of one level are split to threads.
+  for (TU32 level = 1; level < iLevelCount; ++level)
+  {
+    DLevelJob job;
+    job.mKernel           = &GetKernel();
+    job.mDecodeTable      = iOptions.mIsSrgb == true ? tables.mSrgbDecode.data() : tables.mLinearDecode.data();
+    job.mEncodeTable      = iOptions.mIsSrgb == true ? tables.mSrgbEncode.data() : nullptr;
+    job.mSource           = pixels + GetMipLevelOffset(iWidth, iHeight, level - 1);
+    job.mSourceWidth      = GetLevelSize(iWidth, level - 1);
+    job.mSourceHeight     = GetLevelSize(iHeight, level - 1);
+    job.mDestination      = pixels + GetMipLevelOffset(iWidth, iHeight, level);
+    job.mDestinationWidth = GetLevelSize(iWidth, level);
+    job.mHorizontal       = CreateFilterAxis(job.mSourceWidth, job.mDestinationWidth, iOptions.mFilter);
+    job.mVertical         = CreateFilterAxis(job.mSourceHeight, GetLevelSize(iHeight, level), iOptions.mFilter);
+    job.mPaddedFirst      = job.mHorizontal.mFirst;
+    for (auto& first : job.mPaddedFirst) { first += job.mHorizontal.mPadding; }
+
+    const TU32 rowCount = GetLevelSize(iHeight, level);
+    const std::size_t texelCount = std::size_t(job.mDestinationWidth) * rowCount;
+    const TU32 workerCount = texelCount < kParallelTexelCount ? 1 : std::min(threadCount, rowCount);
+
+    // Calling thread filters first range.
+    std::vector<std::thread> workers;
+    for (TU32 worker = 1; worker < workerCount; ++worker)
+    {
+      workers.emplace_back(FilterRows, std::cref(job),
+          TU32(TU64(rowCount) * worker / workerCount), TU32(TU64(rowCount) * (worker + 1) / workerCount));
+    }
+    FilterRows(job, 0, TU32(TU64(rowCount) / workerCount));
+    for (auto& worker : workers) { worker.join(); }
+  }
+  return true;
+}
+
+ESimdLevel GetMipmapSimdLevel() noexcept
+{
+  return GetKernel().mLevel;
+}
+
+void SetMipmapSimdLevel(ESimdLevel iLevel) noexcept
+{
+  const auto supportedLevel = GetSupportedSimdLevel();
+  const auto level = (iLevel < supportedLevel) ? iLevel : supportedLevel;
+  sKernel.store(&GetKernelOfLevel(level), std::memory_order_release);
+}
+
+} /// ::dy namespace
@@ -0,0 +1,82 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+
+//!
+//! AVX2 mipmap kernels, two RGBA pixels per register and gather for decode table.
+//! Only this file is built with AVX2 flags.
+//!
+
+#include <immintrin.h>
+#include "FHelperMipmapKernel.h"
+
+namespace
+{
+
+struct DIsaAvx2 final
+{
+  using TRegister = __m256;
+  static constexpr std::size_t kWidth = 8;
+  static constexpr std::size_t kPixels = 2;
+
+  static TRegister Load(const float* p) noexcept { return _mm256_loadu_ps(p); }
+  static void Store(float* p, const TRegister& v) noexcept { _mm256_storeu_ps(p, v); }
+  static TRegister Set1(float v) noexcept { return _mm256_set1_ps(v); }
+  static TRegister Zero() noexcept { return _mm256_setzero_ps(); }
+  static TRegister Add(const TRegister& a, const TRegister& b) noexcept { return _mm256_add_ps(a, b); }
+  static TRegister Mul(const TRegister& a, const TRegister& b) noexcept { return _mm256_mul_ps(a, b); }
+  static TRegister Min(const TRegister& a, const TRegister& b) noexcept { return _mm256_min_ps(a, b); }
+  static TRegister Max(const TRegister& a, const TRegister& b) noexcept { return _mm256_max_ps(a, b); }
+  static TRegister SetPixel(float r, float g, float b, float a) noexcept { return _mm256_setr_ps(r, g, b, a, r, g, b, a); }
+
+  static void StoreInt32(std::int32_t* p, const TRegister& v) noexcept
+  {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm256_cvtps_epi32(v));
+  }
+
+  /// Table index is byte + 256 * channel, for 8 channels at once.
+  static void Decode(const std::uint8_t* p, const float* iTable, float* out) noexcept
+  {
+    const __m256i bytes = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+    const __m256i index = _mm256_add_epi32(bytes, _mm256_setr_epi32(0, 256, 512, 768, 0, 256, 512, 768));
+    _mm256_storeu_ps(out, _mm256_i32gather_ps(iTable, index, 4));
+  }
+
+  /// Lane 0 is pixel of iFirst[0], lane 1 is pixel of iFirst[1].
+  static TRegister LoadPixels(const float* iRow, const std::int32_t* iFirst, std::uint32_t k) noexcept
+  {
+    return _mm256_insertf128_ps(
+        _mm256_castps128_ps256(_mm_loadu_ps(iRow + std::size_t(iFirst[0] + std::int32_t(k)) * 4)),
+        _mm_loadu_ps(iRow + std::size_t(iFirst[1] + std::int32_t(k)) * 4), 1);
+  }
+
+  static TRegister SetWeights(const float* iWeights, std::uint32_t iStride) noexcept
+  {
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(iWeights[0])), _mm_set1_ps(iWeights[iStride]), 1);
+  }
+};
+
+} /// anonymous namespace
+
+#include "FHelperMipmapKernel.inl"
+
+namespace dy
+{
+
+const DMipmapKernelTable& GetMipmapKernelAvx2() noexcept
+{
+  static constexpr DMipmapKernelTable kTable = CreateKernelTable<DIsaAvx2>(ESimdLevel::Avx2);
+  return kTable;
+}
+
+} /// ::dy namespace
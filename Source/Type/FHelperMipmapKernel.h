@@ -0,0 +1,48 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+//!
+//! Private header of FHelperMipmap. Same to FHelperVectorSpanKernel.h, kernel files are compiled with
+//! wider instruction set flags, so kernels only work on raw arrays and do not include FGlobalType.h.
+//! Rows are RGBA pixels of 4 floats (linear) or 4 bytes (encoded).
+//!
+
+#include <cstddef>
+#include <cstdint>
+#include "Type/FHelperCpuFeature.h"
+
+namespace dy
+{
+
+/// @struct DMipmapKernelTable
+/// @brief Kernel function table of one instruction set.
+struct DMipmapKernelTable final
+{
+  ESimdLevel mLevel;
+  /// out[i] = iTable[(i % 4) * 256 + iPixels[i]], for 4 * `iPixelCount` channels.
+  void (*mDecodeRow)(const std::uint8_t* iPixels, std::size_t iPixelCount, const float* iTable, float* outLinear);
+  /// ioSum[i] += iWeight * iRow[i]
+  void (*mAccumulateRow)(const float* iRow, float iWeight, std::size_t iFloatCount, float* ioSum);
+  /// Pixel x of out is sum of iWeights[x * iTapCount + k] * pixel (iFirst[x] + k) of iRow, for k < iTapCount.
+  void (*mFilterRow)(const float* iRow, const std::int32_t* iFirst, const float* iWeights, std::uint32_t iTapCount,
+      std::size_t iPixelCount, float* outRow);
+  /// Clamp to [0, 1] and encode. If `iSrgbTable` is not null, RGB is iSrgbTable[round(v * 65535)].
+  /// Otherwise RGB is round(v * 255) same to alpha.
+  void (*mEncodeRow)(const float* iLinear, std::size_t iPixelCount, const std::uint8_t* iSrgbTable, std::uint8_t* outPixels);
+};
+
+const DMipmapKernelTable& GetMipmapKernelSse() noexcept;
+const DMipmapKernelTable& GetMipmapKernelAvx2() noexcept;
+
+} /// ::dy namespace
@@ -0,0 +1,115 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+//!
+//! Kernel templates of FHelperMipmap. Included by each kernel file after `TIsa` traits are defined.
+//! `TIsa` provides TRegister, kWidth (floats per register), kPixels (RGBA pixels per register) and
+//! static functions Load, Store, Set1, Zero, Add, Mul, Min, Max, SetPixel(r, g, b, a) which repeats
+//! pixel in register, StoreInt32 which rounds to nearest, Decode which looks up kWidth channels, and
+//! LoadPixels(row, first, k) / SetWeights(weights, stride) which gather pixel first[p] + k and
+//! weights[p * stride] of each pixel p in register.
+//!
+
+#include "FHelperMipmapKernel.h"
+
+namespace
+{
+
+template <typename TIsa>
+void DecodeRowKernel(const std::uint8_t* iPixels, std::size_t iPixelCount, const float* iTable, float* outLinear)
+{
+  const std::size_t floatCount = iPixelCount * 4;
+  std::size_t i = 0;
+  for (; i + TIsa::kWidth <= floatCount; i += TIsa::kWidth) { TIsa::Decode(iPixels + i, iTable, outLinear + i); }
+  for (; i < floatCount; ++i) { outLinear[i] = iTable[(i & 3) * 256 + iPixels[i]]; }
+}
+
+template <typename TIsa>
+void AccumulateRowKernel(const float* iRow, float iWeight, std::size_t iFloatCount, float* ioSum)
+{
+  const auto weight = TIsa::Set1(iWeight);
+  std::size_t i = 0;
+  for (; i + TIsa::kWidth <= iFloatCount; i += TIsa::kWidth)
+  {
+    TIsa::Store(ioSum + i, TIsa::Add(TIsa::Load(ioSum + i), TIsa::Mul(TIsa::Load(iRow + i), weight)));
+  }
+  for (; i < iFloatCount; ++i) { ioSum[i] += iRow[i] * iWeight; }
+}
+
+template <typename TIsa>
+void FilterRowKernel(const float* iRow, const std::int32_t* iFirst, const float* iWeights, std::uint32_t iTapCount,
+    std::size_t iPixelCount, float* outRow)
+{
+  std::size_t x = 0;
+  for (; x + TIsa::kPixels <= iPixelCount; x += TIsa::kPixels)
+  {
+    const float* weights = iWeights + x * iTapCount;
+    auto sum = TIsa::Zero();
+    for (std::uint32_t k = 0; k < iTapCount; ++k)
+    {
+      sum = TIsa::Add(sum, TIsa::Mul(TIsa::LoadPixels(iRow, iFirst + x, k), TIsa::SetWeights(weights + k, iTapCount)));
+    }
+    TIsa::Store(outRow + x * 4, sum);
+  }
+  for (; x < iPixelCount; ++x)
+  {
+    float sum[4] = {};
+    for (std::uint32_t k = 0; k < iTapCount; ++k)
+    {
+      const float* pixel = iRow + std::size_t(iFirst[x] + std::int32_t(k)) * 4;
+      const float weight = iWeights[x * iTapCount + k];
+      for (std::size_t c = 0; c < 4; ++c) { sum[c] += pixel[c] * weight; }
+    }
+    for (std::size_t c = 0; c < 4; ++c) { outRow[x * 4 + c] = sum[c]; }
+  }
+}
+
+template <typename TIsa>
+void EncodeRowKernel(const float* iLinear, std::size_t iPixelCount, const std::uint8_t* iSrgbTable, std::uint8_t* outPixels)
+{
+  // RGB is scaled to index of sRGB table, alpha is scaled to byte.
+  const float rgbScale = iSrgbTable != nullptr ? 65535.0f : 255.0f;
+  const auto scale = TIsa::SetPixel(rgbScale, rgbScale, rgbScale, 255.0f);
+  const auto zero = TIsa::Zero();
+  const auto one = TIsa::Set1(1.0f);
+  const auto encode = [iSrgbTable](std::size_t iChannel, std::int32_t iValue)
+  {
+    return (iSrgbTable != nullptr && (iChannel & 3) != 3) ? iSrgbTable[iValue] : static_cast<std::uint8_t>(iValue);
+  };
+
+  const std::size_t floatCount = iPixelCount * 4;
+  std::size_t i = 0;
+  std::int32_t values[TIsa::kWidth];
+  for (; i + TIsa::kWidth <= floatCount; i += TIsa::kWidth)
+  {
+    // Max is first, so NaN becomes 0.
+    TIsa::StoreInt32(values, TIsa::Mul(TIsa::Min(TIsa::Max(TIsa::Load(iLinear + i), zero), one), scale));
+    for (std::size_t c = 0; c < TIsa::kWidth; ++c) { outPixels[i + c] = encode(c, values[c]); }
+  }
+  for (; i < floatCount; ++i)
+  {
+    const float value = iLinear[i] > 0.0f ? (iLinear[i] < 1.0f ? iLinear[i] : 1.0f) : 0.0f;
+    outPixels[i] = encode(i, static_cast<std::int32_t>(value * ((i & 3) != 3 ? rgbScale : 255.0f) + 0.5f));
+  }
+}
+
+/// @brief Create kernel table of `TIsa`.
+template <typename TIsa>
+constexpr dy::DMipmapKernelTable CreateKernelTable(dy::ESimdLevel iLevel) noexcept
+{
+  return dy::DMipmapKernelTable{
+      iLevel,
+      &DecodeRowKernel<TIsa>, &AccumulateRowKernel<TIsa>, &FilterRowKernel<TIsa>, &EncodeRowKernel<TIsa>};
+}
+
+} /// anonymous namespace
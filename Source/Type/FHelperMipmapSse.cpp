@@ -0,0 +1,73 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+
+//!
+//! Baseline 128-bit mipmap kernels, one RGBA pixel per register. Built without extra instruction set flags.
+//!
+
+#include <immintrin.h>
+#include "FHelperMipmapKernel.h"
+
+namespace
+{
+
+struct DIsaSse final
+{
+  using TRegister = __m128;
+  static constexpr std::size_t kWidth = 4;
+  static constexpr std::size_t kPixels = 1;
+
+  static TRegister Load(const float* p) noexcept { return _mm_loadu_ps(p); }
+  static void Store(float* p, const TRegister& v) noexcept { _mm_storeu_ps(p, v); }
+  static TRegister Set1(float v) noexcept { return _mm_set1_ps(v); }
+  static TRegister Zero() noexcept { return _mm_setzero_ps(); }
+  static TRegister Add(const TRegister& a, const TRegister& b) noexcept { return _mm_add_ps(a, b); }
+  static TRegister Mul(const TRegister& a, const TRegister& b) noexcept { return _mm_mul_ps(a, b); }
+  static TRegister Min(const TRegister& a, const TRegister& b) noexcept { return _mm_min_ps(a, b); }
+  static TRegister Max(const TRegister& a, const TRegister& b) noexcept { return _mm_max_ps(a, b); }
+  static TRegister SetPixel(float r, float g, float b, float a) noexcept { return _mm_setr_ps(r, g, b, a); }
+
+  static void StoreInt32(std::int32_t* p, const TRegister& v) noexcept
+  {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm_cvtps_epi32(v));
+  }
+
+  /// SSE has no gather, so channels are looked up one by one.
+  static void Decode(const std::uint8_t* p, const float* iTable, float* out) noexcept
+  {
+    _mm_storeu_ps(out, _mm_setr_ps(iTable[p[0]], iTable[256 + p[1]], iTable[512 + p[2]], iTable[768 + p[3]]));
+  }
+
+  static TRegister LoadPixels(const float* iRow, const std::int32_t* iFirst, std::uint32_t k) noexcept
+  {
+    return _mm_loadu_ps(iRow + std::size_t(iFirst[0] + std::int32_t(k)) * 4);
+  }
+
+  static TRegister SetWeights(const float* iWeights, std::uint32_t) noexcept { return _mm_set1_ps(iWeights[0]); }
+};
+
+} /// anonymous namespace
+
+#include "FHelperMipmapKernel.inl"
+
+namespace dy
+{
+
+const DMipmapKernelTable& GetMipmapKernelSse() noexcept
+{
+  static constexpr DMipmapKernelTable kTable = CreateKernelTable<DIsaSse>(ESimdLevel::Sse2);
+  return kTable;
+}
+
+} /// ::dy namespace
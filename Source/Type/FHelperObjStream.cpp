@@ -0,0 +1,823 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include "Type/FHelperObjStream.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <vector>
+#include "Type/FHelperVectorSpan.h"
+#include "Type/FHelperVertexDedup.h"
+
+namespace
+{
+
+/// Texture coordinate index of corner which has no texture coordinate.
+constexpr TU32 kNoUv = 0xFFFFFFFF;
+/// Largest mantissa and powers of ten of which product or quotient is correctly rounded in float.
+constexpr TU64 kMaxExactFloatMantissa = TU64(1) << 24;
+constexpr float kExactFloatPowersOf10[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+constexpr TI32 kMaxExactFloatExponent = 10;
+/// Significant decimal digits which fit in 64-bit mantissa.
+constexpr TU32 kMaxMantissaDigitCount = 19;
+
+bool IsSpace(char iChar) noexcept { return iChar == ' ' || iChar == '\t' || iChar == '\r'; }
+bool IsDigit(char iChar) noexcept { return iChar >= '0' && iChar <= '9'; }
+
+const char* SkipSpace(const char* iIt, const char* iEnd) noexcept
+{
+  while (iIt < iEnd && IsSpace(*iIt) == true) { ++iIt; }
+  return iIt;
+}
+
+/// @brief Parse decimal float after spaces from `ioIt` in the way of std::from_chars, without locale.
+/// Return false if there is no number. \n
+/// Mantissa of at most 2^24 is multiplied or divided by exact power of ten in one float operation, which
+/// is correctly rounded. Other numbers, which are rare in OBJ, fall back to std::strtof, so result is
+/// always same to std::strtof.
+bool ParseFloat(const char*& ioIt, const char* iEnd, float& outValue) noexcept
+{
+  const char* const begin = SkipSpace(ioIt, iEnd);
+  const char* it = begin;
+  const bool isNegative = it < iEnd && *it == '-';
+  if (it < iEnd && (*it == '-' || *it == '+')) { ++it; }
+
+  TU64 mantissa = 0;
+  TI32 exponent = 0;
+  TU32 digitCount = 0;
+  bool hasDigit = false;
+  bool isTruncated = false;
+  // Return false if digit does not fit in mantissa. Leading zeros are not counted.
+  const auto addDigit = [&](char iDigit)
+  {
+    hasDigit = true;
+    if (mantissa == 0 && iDigit == '0') { return true; }
+    if (digitCount == kMaxMantissaDigitCount) { isTruncated |= iDigit != '0'; return false; }
+    mantissa = mantissa * 10 + TU64(iDigit - '0');
+    ++digitCount;
+    return true;
+  };
+  for (; it < iEnd && IsDigit(*it) == true; ++it) { if (addDigit(*it) == false) { ++exponent; } }
+  if (it < iEnd && *it == '.')
+  {
+    for (++it; it < iEnd && IsDigit(*it) == true; ++it) { if (addDigit(*it) == true) { --exponent; } }
+  }
+
+  if (hasDigit == false)
+  {
+    // Only infinity and NaN are read by std::strtof without digit.
+    const char symbol = it < iEnd ? static_cast<char>(*it | 0x20) : '\0';
+    if (symbol != 'i' && symbol != 'n') { return false; }
+    char* end = nullptr;
+    outValue = std::strtof(begin, &end);
+    if (end == begin) { return false; }
+    ioIt = end;
+    return true;
+  }
+
+  if (it + 1 < iEnd && (*it == 'e' || *it == 'E'))
+  {
+    const char* exponentIt = it + 1;
+    const bool isNegativeExponent = *exponentIt == '-';
+    if (*exponentIt == '-' || *exponentIt == '+') { ++exponentIt; }
+    if (exponentIt < iEnd && IsDigit(*exponentIt) == true)
+    {
+      TI32 value = 0;
+      for (; exponentIt < iEnd && IsDigit(*exponentIt) == true; ++exponentIt)
+      {
+        value = std::min(value * 10 + TI32(*exponentIt - '0'), 100000);
+      }
+      exponent += isNegativeExponent == true ? -value : value;
+      it = exponentIt;
+    }
+  }
+
+  if (isTruncated == false && mantissa <= kMaxExactFloatMantissa
+  &&  exponent >= -kMaxExactFloatExponent && exponent <= kMaxExactFloatExponent)
+  {
+    float value = static_cast<float>(mantissa);
+    value = exponent < 0 ? value / kExactFloatPowersOf10[-exponent] : value * kExactFloatPowersOf10[exponent];
+    outValue = isNegative == true ? -value : value;
+    ioIt = it;
+    return true;
+  }
+
+  char* end = nullptr;
+  outValue = std::strtof(begin, &end);
+  ioIt = end;
+  return true;
+}
+
+/// @brief Parse nonzero OBJ index, which is 1-based or negative relative index.
+bool ParseRawIndex(const char*& ioIt, const char* iEnd, TI32& outIndex) noexcept
+{
+  const bool isNegative = ioIt < iEnd && *ioIt == '-';
+  const char* it = isNegative == true ? ioIt + 1 : ioIt;
+  const char* const digitBegin = it;
+  TI64 value = 0;
+  for (; it < iEnd && IsDigit(*it) == true && value <= NumericalMax<TI32>; ++it) { value = value * 10 + TI64(*it - '0'); }
+  if (it == digitBegin || value == 0 || value > NumericalMax<TI32>) { return false; }
+
+  outIndex = static_cast<TI32>(isNegative == true ? -value : value);
+  ioIt = it;
+  return true;
+}
+
+/// @struct DObjFace
+/// @brief Face of parsed range. Its corners follow corners of previous face.
+struct DObjFace final
+{
+  TU32 mCornerCount   = 0;
+  /// Count of positions and texture coordinates parsed in range before face.
+  TU32 mPositionCount = 0;
+  TU32 mUvCount       = 0;
+};
+
+/// @struct DObjRangeRecords
+/// @brief Records parsed from one range of lines. \n
+/// Corners keep raw OBJ indices, because they are resolved with attribute counts of previous ranges,
+/// which are known only when ranges are stitched in order.
+struct DObjRangeRecords final
+{
+  std::vector<dy::DVector3> mPositions;
+  std::vector<dy::DVector2> mUvs;
+  /// Raw (position, texture coordinate) index pair of each corner. Texture coordinate 0 means none.
+  std::vector<TI32>         mCorners;
+  std::vector<DObjFace>     mFaces;
+  /// Error of malformed line, which stops parsing of range.
+  const char* mError = nullptr;
+
+  void Clear() noexcept
+  {
+    this->mPositions.clear();
+    this->mUvs.clear();
+    this->mCorners.clear();
+    this->mFaces.clear();
+    this->mError = nullptr;
+  }
+
+  [[nodiscard]] std::size_t GetMemorySize() const noexcept
+  {
+    return this->mPositions.capacity() * sizeof(dy::DVector3)
+        + this->mUvs.capacity() * sizeof(dy::DVector2)
+        + this->mCorners.capacity() * sizeof(TI32)
+        + this->mFaces.capacity() * sizeof(DObjFace);
+  }
+};
+
+/// @brief Parse one line of [iBegin, iEnd) into `ioRecords`. Return false if line is malformed.
+bool ParseLine(const char* iBegin, const char* iEnd, DObjRangeRecords& ioRecords)
+{
+  const char* it = SkipSpace(iBegin, iEnd);
+  if (iEnd - it >= 3 && it[0] == 'v' && it[1] == 't' && IsSpace(it[2]) == true)
+  {
+    dy::DVector2 uv;
+    it += 3;
+    if (ParseFloat(it, iEnd, uv.X) == false) { ioRecords.mError = "Texture coordinate must have u coordinate."; return false; }
+    // 1D texture coordinate has only u.
+    if (ParseFloat(it, iEnd, uv.Y) == false) { uv.Y = 0.0f; }
+    ioRecords.mUvs.push_back(uv);
+    return true;
+  }
+  // Other statements, such as normal, group, material and comment, are skipped.
+  if (iEnd - it < 2 || IsSpace(it[1]) == false) { return true; }
+
+  if (it[0] == 'v')
+  {
+    dy::DVector3 position;
+    it += 2;
+    if (ParseFloat(it, iEnd, position.X) == false || ParseFloat(it, iEnd, position.Y) == false
+    ||  ParseFloat(it, iEnd, position.Z) == false)
+    {
+      ioRecords.mError = "Position must have 3 coordinates.";
+      return false;
+    }
+    ioRecords.mPositions.push_back(position);
+    return true;
+  }
+
+  if (it[0] == 'f')
+  {
+    DObjFace face;
+    face.mPositionCount = static_cast<TU32>(ioRecords.mPositions.size());
+    face.mUvCount       = static_cast<TU32>(ioRecords.mUvs.size());
+    for (it = SkipSpace(it + 2, iEnd); it < iEnd; it = SkipSpace(it, iEnd))
+    {
+      TI32 position = 0;
+      TI32 uv = 0;
+      if (ParseRawIndex(it, iEnd, position) == false) { ioRecords.mError = "Face references invalid position."; return false; }
+      // Normal index of `v/vt/vn` or `v//vn` is ignored.
+      if (it < iEnd && *it == '/')
+      {
+        ++it;
+        if (it < iEnd && *it != '/' && ParseRawIndex(it, iEnd, uv) == false)
+        {
+          ioRecords.mError = "Face references invalid texture coordinate.";
+          return false;
+        }
+        while (it < iEnd && IsSpace(*it) == false) { ++it; }
+      }
+      ioRecords.mCorners.insert(ioRecords.mCorners.end(), {position, uv});
+      ++face.mCornerCount;
+    }
+    if (face.mCornerCount < 3)
+    {
+      ioRecords.mCorners.resize(ioRecords.mCorners.size() - face.mCornerCount * 2);
+      ioRecords.mError = "Face must have 3 or more corners.";
+      return false;
+    }
+    ioRecords.mFaces.push_back(face);
+  }
+  return true;
+}
+
+/// @brief Parse lines of [iBegin, iEnd) into `outRecords`, until malformed line.
+void ParseRange(const char* iBegin, const char* iEnd, DObjRangeRecords& outRecords)
+{
+  outRecords.Clear();
+  for (const char* line = iBegin; line < iEnd; )
+  {
+    const auto* lineEnd = static_cast<const char*>(std::memchr(line, '\n', iEnd - line));
+    if (lineEnd == nullptr) { lineEnd = iEnd; }
+    if (ParseLine(line, lineEnd, outRecords) == false) { return; }
+    line = lineEnd + 1;
+  }
+}
+
+/// @brief Resolve raw OBJ index into 0-based index of `iCount` attributes before face.
+bool ResolveIndex(TI32 iRawIndex, std::size_t iCount, TU32& outIndex) noexcept
+{
+  const TI64 index = iRawIndex > 0 ? TI64(iRawIndex) - 1 : TI64(iCount) + iRawIndex;
+  if (index < 0 || index >= TI64(iCount)) { return false; }
+  outIndex = static_cast<TU32>(index);
+  return true;
+}
+
+/// @class FObjStitcher
+/// @brief Appends parsed ranges in file order, and deduplicates their corners on the fly.
+class FObjStitcher final
+{
+public:
+  FObjStitcher(dy::IObjStreamSink& ioSink, const dy::DObjStreamOptions& iOptions) :
+      mSink{ioSink},
+      mVertexBatchCount{std::max<std::size_t>(iOptions.mBatchCount, 1)},
+      // Batch holds whole triangles.
+      mIndexBatchCount{std::max<std::size_t>(iOptions.mBatchCount / 3, 1) * 3}
+  {
+    this->mVertexBatch.reserve(this->mVertexBatchCount);
+    this->mIndexBatch.reserve(this->mIndexBatchCount);
+  }
+
+  /// @brief Stitch ranges of one chunk in order.
+  bool StitchRanges(const std::vector<DObjRangeRecords>& iRecords)
+  {
+    for (const auto& range : iRecords) { if (this->Stitch(range) == false) { return false; } }
+    return true;
+  }
+
+  /// @brief Append attributes of range, and resolve corners of its faces with prefix-summed attribute counts.
+  bool Stitch(const DObjRangeRecords& iRecords)
+  {
+    const std::size_t positionBase = this->mPositions.size();
+    const std::size_t uvBase = this->mUvs.size();
+    this->mPositions.insert(this->mPositions.end(), iRecords.mPositions.begin(), iRecords.mPositions.end());
+    this->mUvs.insert(this->mUvs.end(), iRecords.mUvs.begin(), iRecords.mUvs.end());
+
+    const TI32* corner = iRecords.mCorners.data();
+    for (const auto& face : iRecords.mFaces)
+    {
+      this->mFaceCorners.clear();
+      for (TU32 i = 0; i < face.mCornerCount; ++i, corner += 2)
+      {
+        TU32 position = 0;
+        TU32 uv = kNoUv;
+        if (ResolveIndex(corner[0], positionBase + face.mPositionCount, position) == false)
+        {
+          return this->Fail("Face references invalid position.");
+        }
+        if (corner[1] != 0 && ResolveIndex(corner[1], uvBase + face.mUvCount, uv) == false)
+        {
+          return this->Fail("Face references invalid texture coordinate.");
+        }
+        TU32 vertex = 0;
+        if (this->GetVertex(position, uv, vertex) == false) { return false; }
+        this->mFaceCorners.push_back(vertex);
+      }
+      this->mCornerCount += face.mCornerCount;
+
+      // Triangulate polygon as fan from first corner.
+      for (std::size_t i = 2; i < this->mFaceCorners.size(); ++i)
+      {
+        if (this->mIndexBatch.size() == this->mIndexBatchCount && this->Flush() == false) { return false; }
+        this->mIndexBatch.insert(this->mIndexBatch.end(),
+            {this->mFaceCorners[0], this->mFaceCorners[i - 1], this->mFaceCorners[i]});
+        this->mIndexCount += 3;
+      }
+    }
+    return iRecords.mError == nullptr || this->Fail(iRecords.mError);
+  }
+
+  /// @brief Write remained vertices and indices to sink.
+  bool Flush()
+  {
+    if (this->FlushVertices() == false) { return false; }
+    if (this->mIndexBatch.empty() == false)
+    {
+      if (this->mSink.WriteIndices(this->mIndexBatch.data(), this->mIndexBatch.size()) == false)
+      {
+        return this->Fail("Sink stopped reading indices.");
+      }
+      this->mIndexBatch.clear();
+    }
+    return true;
+  }
+
+  /// @brief Get byte size of memory held by stitcher.
+  [[nodiscard]] std::size_t GetMemorySize() const noexcept
+  {
+    return this->mPositions.capacity() * sizeof(dy::DVector3)
+        + this->mUvs.capacity() * sizeof(dy::DVector2)
+        + this->mKeys.capacity() * sizeof(TU64)
+        + this->mTable.GetStats().mCapacity * sizeof(TU64)
+        + this->mVertexBatch.capacity() * sizeof(dy::DObjVertex)
+        + this->mIndexBatch.capacity() * sizeof(TU32)
+        + this->mFaceCorners.capacity() * sizeof(TU32);
+  }
+
+  /// @brief Fill statistics except memory size.
+  void GetStats(dy::DObjStreamStats& outStats) const noexcept
+  {
+    outStats.mPositionCount = this->mPositions.size();
+    outStats.mUvCount       = this->mUvs.size();
+    outStats.mCornerCount   = this->mCornerCount;
+    outStats.mVertexCount   = this->mKeys.size();
+    outStats.mIndexCount    = this->mIndexCount;
+    outStats.mBounds        = dy::ComputeBounds(this->mPositions.data(), this->mPositions.size());
+  }
+
+  bool Fail(const char* iError)
+  {
+    this->mError = iError;
+    return false;
+  }
+
+  std::string mError;
+
+private:
+  /// @brief Get vertex index of corner, and add vertex to batch when corner is first used.
+  bool GetVertex(TU32 iPosition, TU32 iUv, TU32& outIndex)
+  {
+    const TU64 key = (TU64(iUv) << 32) | iPosition;
+    const auto newIndex = static_cast<TU32>(this->mKeys.size());
+    outIndex = this->mTable.InsertOrGet(key, dy::HashObject(key), newIndex, this->mKeys.data());
+    if (outIndex != newIndex) { return true; }
+
+    this->mKeys.push_back(key);
+    if (this->mVertexBatch.size() == this->mVertexBatchCount && this->FlushVertices() == false) { return false; }
+    this->mVertexBatch.push_back(dy::DObjVertex{
+        this->mPositions[iPosition], iUv == kNoUv ? dy::DVector2{0.0f, 0.0f} : this->mUvs[iUv]});
+    return true;
+  }
+
+  bool FlushVertices()
+  {
+    if (this->mVertexBatch.empty() == true) { return true; }
+    if (this->mSink.WriteVertices(this->mVertexBatch.data(), this->mVertexBatch.size()) == false)
+    {
+      return this->Fail("Sink stopped reading vertices.");
+    }
+    this->mVertexBatch.clear();
+    return true;
+  }
+
+  dy::IObjStreamSink& mSink;
+  const std::size_t   mVertexBatchCount;
+  const std::size_t   mIndexBatchCount;
+
+  std::vector<dy::DVector3> mPositions;
+  std::vector<dy::DVector2> mUvs;
+  /// (texture coordinate, position) index pair of each vertex, which is storage of table.
+  std::vector<TU64>         mKeys;
+  dy::FVertexHashTable<TU64> mTable;
+  std::vector<dy::DObjVertex> mVertexBatch;
+  std::vector<TU32>         mIndexBatch;
+  std::vector<TU32>         mFaceCorners;
+  TU64 mCornerCount = 0;
+  TU64 mIndexCount  = 0;
+};
+
+
+/// @class FObjParallelStitcher
+/// @brief Multi-threaded FObjStitcher, which writes same vertices and indices. \n
+/// Vertex table is sharded by hash of corner key, same to DeduplicateVerticesParallel, and kept through chunks.
+/// Corners of chunk are resolved per range, looked up per shard in file order, and new vertices are numbered
+/// in file order, so result does not depend on thread scheduling. Chunk is written to sink after it is stitched.
+class FObjParallelStitcher final
+{
+public:
+  FObjParallelStitcher(dy::IObjStreamSink& ioSink, const dy::DObjStreamOptions& iOptions, TU32 iThreadCount) :
+      mSink{ioSink},
+      mVertexBatchCount{std::max<std::size_t>(iOptions.mBatchCount, 1)},
+      mIndexBatchCount{std::max<std::size_t>(iOptions.mBatchCount / 3, 1) * 3},
+      // Shard index is stored as 8 bits.
+      mShards(std::min<TU32>(std::max(iThreadCount, 1u), 256))
+  { }
+
+  /// @brief Stitch ranges of one chunk, and write its new vertices and indices to sink.
+  bool StitchRanges(const std::vector<DObjRangeRecords>& iRecords)
+  {
+    const auto rangeCount = static_cast<TU32>(iRecords.size());
+    const auto shardCount = static_cast<TU32>(this->mShards.size());
+
+    // (1) Append attributes. Ranges are resolved with prefix-summed counts of attributes, corners and indices.
+    std::vector<std::size_t> positionBases(rangeCount), uvBases(rangeCount);
+    std::vector<std::size_t> cornerBases(rangeCount + 1, 0), indexBases(rangeCount + 1, 0);
+    for (TU32 range = 0; range < rangeCount; ++range)
+    {
+      const auto& records = iRecords[range];
+      positionBases[range] = this->mPositions.size();
+      uvBases[range] = this->mUvs.size();
+      this->mPositions.insert(this->mPositions.end(), records.mPositions.begin(), records.mPositions.end());
+      this->mUvs.insert(this->mUvs.end(), records.mUvs.begin(), records.mUvs.end());
+
+      std::size_t indexCount = 0;
+      for (const auto& face : records.mFaces) { indexCount += std::size_t(face.mCornerCount - 2) * 3; }
+      cornerBases[range + 1] = cornerBases[range] + records.mCorners.size() / 2;
+      indexBases[range + 1] = indexBases[range] + indexCount;
+    }
+    const std::size_t cornerCount = cornerBases[rangeCount];
+    this->mCorners.resize(cornerCount);
+
+    // (2) Resolve corners of each range into key, and count corners of each shard in each range.
+    // Error of first range which has error is reported, same to FObjStitcher.
+    std::vector<const char*> errors(rangeCount, nullptr);
+    std::vector<TU32> shardCounts(std::size_t{rangeCount} * shardCount, 0);
+    ParallelFor(rangeCount, [&](TU32 iRange)
+    {
+      const auto& records = iRecords[iRange];
+      TU32* counts = &shardCounts[std::size_t{iRange} * shardCount];
+      DObjCorner* corner = this->mCorners.data() + cornerBases[iRange];
+      const TI32* rawCorner = records.mCorners.data();
+      for (const auto& face : records.mFaces)
+      {
+        for (TU32 i = 0; i < face.mCornerCount; ++i, rawCorner += 2, ++corner)
+        {
+          TU32 position = 0;
+          TU32 uv = kNoUv;
+          if (ResolveIndex(rawCorner[0], positionBases[iRange] + face.mPositionCount, position) == false)
+          {
+            errors[iRange] = "Face references invalid position.";
+            return;
+          }
+          if (rawCorner[1] != 0 && ResolveIndex(rawCorner[1], uvBases[iRange] + face.mUvCount, uv) == false)
+          {
+            errors[iRange] = "Face references invalid texture coordinate.";
+            return;
+          }
+          corner->mKey   = (TU64(uv) << 32) | position;
+          corner->mHash  = dy::HashObject(corner->mKey);
+          corner->mShard = static_cast<TU08>(((corner->mHash >> 24) & 0xFF) * shardCount >> 8);
+          ++counts[corner->mShard];
+        }
+      }
+      errors[iRange] = records.mError;
+    });
+    for (const char* error : errors) { if (error != nullptr) { return this->Fail(error); } }
+
+    // (3) Group corners by shard. Ranges are placed in order inside of each shard, so corners stay in file order.
+    std::vector<TU32> shardOffsets(shardCounts.size());
+    std::vector<TU32> shardBegins(shardCount + 1, 0);
+    TU32 offset = 0;
+    for (TU32 shard = 0; shard < shardCount; ++shard)
+    {
+      shardBegins[shard] = offset;
+      for (TU32 range = 0; range < rangeCount; ++range)
+      {
+        shardOffsets[std::size_t{range} * shardCount + shard] = offset;
+        offset += shardCounts[std::size_t{range} * shardCount + shard];
+      }
+    }
+    shardBegins[shardCount] = offset;
+
+    this->mShardCorners.resize(cornerCount);
+    ParallelFor(rangeCount, [&](TU32 iRange)
+    {
+      TU32* offsets = &shardOffsets[std::size_t{iRange} * shardCount];
+      for (std::size_t i = cornerBases[iRange]; i < cornerBases[iRange + 1]; ++i)
+      {
+        this->mShardCorners[offsets[this->mCorners[i].mShard]++] = static_cast<TU32>(i);
+      }
+    });
+
+    // (4) Each shard looks up its corners in file order, so first corner of new key is first use of vertex.
+    // Vertex index of new key is assigned in (5).
+    ParallelFor(shardCount, [&](TU32 iShard)
+    {
+      auto& shard = this->mShards[iShard];
+      for (TU32 item = shardBegins[iShard]; item < shardBegins[iShard + 1]; ++item)
+      {
+        DObjCorner& corner = this->mCorners[this->mShardCorners[item]];
+        const auto newItem = static_cast<TU32>(shard.mKeys.size());
+        corner.mItem = shard.mTable.InsertOrGet(corner.mKey, corner.mHash, newItem, shard.mKeys.data());
+        corner.mIsFirst = corner.mItem == newItem;
+        if (corner.mIsFirst == true)
+        {
+          shard.mKeys.push_back(corner.mKey);
+          shard.mVertices.push_back(0);
+        }
+      }
+    });
+
+    // (5) Number new vertices in file order. Count first corners of each range, and offset ranges by prefix sum.
+    std::vector<TU32> newCounts(rangeCount + 1, 0);
+    ParallelFor(rangeCount, [&](TU32 iRange)
+    {
+      TU32 count = 0;
+      for (std::size_t i = cornerBases[iRange]; i < cornerBases[iRange + 1]; ++i)
+      {
+        count += this->mCorners[i].mIsFirst == true ? 1 : 0;
+      }
+      newCounts[iRange + 1] = count;
+    });
+    for (TU32 range = 0; range < rangeCount; ++range) { newCounts[range + 1] += newCounts[range]; }
+
+    const auto vertexBase = static_cast<TU32>(this->mVertexCount);
+    this->mNewVertices.resize(newCounts[rangeCount]);
+    ParallelFor(rangeCount, [&](TU32 iRange)
+    {
+      TU32 rank = newCounts[iRange];
+      for (std::size_t i = cornerBases[iRange]; i < cornerBases[iRange + 1]; ++i)
+      {
+        const DObjCorner& corner = this->mCorners[i];
+        if (corner.mIsFirst == false) { continue; }
+        this->mShards[corner.mShard].mVertices[corner.mItem] = vertexBase + rank;
+        const auto uv = static_cast<TU32>(corner.mKey >> 32);
+        this->mNewVertices[rank++] = dy::DObjVertex{
+            this->mPositions[static_cast<TU32>(corner.mKey)], uv == kNoUv ? dy::DVector2{0.0f, 0.0f} : this->mUvs[uv]};
+      }
+    });
+
+    // (6) Triangulate polygons of each range as fan from first corner.
+    this->mIndices.resize(indexBases[rangeCount]);
+    ParallelFor(rangeCount, [&](TU32 iRange)
+    {
+      const DObjCorner* corner = this->mCorners.data() + cornerBases[iRange];
+      TU32* index = this->mIndices.data() + indexBases[iRange];
+      for (const auto& face : iRecords[iRange].mFaces)
+      {
+        const TU32 first = this->GetVertex(corner[0]);
+        TU32 previous = this->GetVertex(corner[1]);
+        for (TU32 i = 2; i < face.mCornerCount; ++i)
+        {
+          const TU32 current = this->GetVertex(corner[i]);
+          *index++ = first;
+          *index++ = previous;
+          *index++ = current;
+          previous = current;
+        }
+        corner += face.mCornerCount;
+      }
+    });
+
+    // (7) Write new vertices first, because indices of chunk reference them.
+    for (std::size_t i = 0; i < this->mNewVertices.size(); i += this->mVertexBatchCount)
+    {
+      const std::size_t count = std::min(this->mVertexBatchCount, this->mNewVertices.size() - i);
+      if (this->mSink.WriteVertices(this->mNewVertices.data() + i, count) == false)
+      {
+        return this->Fail("Sink stopped reading vertices.");
+      }
+    }
+    for (std::size_t i = 0; i < this->mIndices.size(); i += this->mIndexBatchCount)
+    {
+      const std::size_t count = std::min(this->mIndexBatchCount, this->mIndices.size() - i);
+      if (this->mSink.WriteIndices(this->mIndices.data() + i, count) == false)
+      {
+        return this->Fail("Sink stopped reading indices.");
+      }
+    }
+    this->mVertexCount += this->mNewVertices.size();
+    this->mCornerCount += cornerCount;
+    this->mIndexCount  += this->mIndices.size();
+    return true;
+  }
+
+  /// @brief Every chunk is written by StitchRanges, so there is nothing to write.
+  bool Flush() { return true; }
+
+  /// @brief Get byte size of memory held by stitcher.
+  [[nodiscard]] std::size_t GetMemorySize() const noexcept
+  {
+    std::size_t size = this->mPositions.capacity() * sizeof(dy::DVector3)
+        + this->mUvs.capacity() * sizeof(dy::DVector2)
+        + this->mCorners.capacity() * sizeof(DObjCorner)
+        + this->mShardCorners.capacity() * sizeof(TU32)
+        + this->mNewVertices.capacity() * sizeof(dy::DObjVertex)
+        + this->mIndices.capacity() * sizeof(TU32);
+    for (const auto& shard : this->mShards)
+    {
+      size += shard.mKeys.capacity() * sizeof(TU64)
+          + shard.mVertices.capacity() * sizeof(TU32)
+          + shard.mTable.GetStats().mCapacity * sizeof(TU64);
+    }
+    return size;
+  }
+
+  /// @brief Fill statistics except memory size.
+  void GetStats(dy::DObjStreamStats& outStats) const noexcept
+  {
+    outStats.mPositionCount = this->mPositions.size();
+    outStats.mUvCount       = this->mUvs.size();
+    outStats.mCornerCount   = this->mCornerCount;
+    outStats.mVertexCount   = this->mVertexCount;
+    outStats.mIndexCount    = this->mIndexCount;
+    outStats.mBounds        = dy::ComputeBounds(this->mPositions.data(), this->mPositions.size());
+  }
+
+  bool Fail(const char* iError)
+  {
+    this->mError = iError;
+    return false;
+  }
+
+  std::string mError;
+
+private:
+  /// @struct DObjCorner
+  /// @brief Resolved corner of chunk, and its item in shard.
+  struct DObjCorner final
+  {
+    /// (texture coordinate, position) index pair.
+    TU64 mKey;
+    TU64 mHash;
+    TU32 mItem;
+    TU08 mShard;
+    bool mIsFirst;
+  };
+
+  /// @struct DObjShard
+  /// @brief Vertices of keys whose hash is in shard. Item is index of key in mKeys.
+  struct DObjShard final
+  {
+    std::vector<TU64>           mKeys;
+    /// Vertex index of each item.
+    std::vector<TU32>           mVertices;
+    dy::FVertexHashTable<TU64>  mTable;
+  };
+
+  /// @brief Call `iFunction(i)` for i < `iCount`, each on its own thread, and join.
+  template <typename TFunctor>
+  static void ParallelFor(TU32 iCount, const TFunctor& iFunction)
+  {
+    std::vector<std::thread> threads;
+    threads.reserve(iCount);
+    for (TU32 i = 1; i < iCount; ++i) { threads.emplace_back([&iFunction, i] { iFunction(i); }); }
+    if (iCount > 0) { iFunction(0); }
+    for (auto& thread : threads) { thread.join(); }
+  }
+
+  TU32 GetVertex(const DObjCorner& iCorner) const noexcept
+  {
+    return this->mShards[iCorner.mShard].mVertices[iCorner.mItem];
+  }
+
+  dy::IObjStreamSink& mSink;
+  const std::size_t   mVertexBatchCount;
+  const std::size_t   mIndexBatchCount;
+
+  std::vector<dy::DVector3>   mPositions;
+  std::vector<dy::DVector2>   mUvs;
+  std::vector<DObjShard>      mShards;
+  /// Buffers of chunk, kept to reuse their capacity.
+  std::vector<DObjCorner>     mCorners;
+  std::vector<TU32>           mShardCorners;
+  std::vector<dy::DObjVertex> mNewVertices;
+  std::vector<TU32>           mIndices;
+  TU64 mVertexCount = 0;
+  TU64 mCornerCount = 0;
+  TU64 mIndexCount  = 0;
+};
+
+/// @brief Read file of `iPath` chunk by chunk. Each chunk is split into `iThreadCount` ranges which are parsed
+/// in parallel, and parsed ranges are stitched by `ioStitcher`.
+template <typename TStitcher>
+bool ReadObjChunks(
+    const std::string& iPath, TU32 iThreadCount, TStitcher& ioStitcher, const dy::DObjStreamOptions& iOptions,
+    dy::DObjStreamStats* outStats, std::string* outError)
+{
+  TU64 peakMemorySize = 0;
+  const auto finish = [&](bool iIsSucceeded)
+  {
+    if (outStats != nullptr)
+    {
+      ioStitcher.GetStats(*outStats);
+      outStats->mPeakMemorySize = peakMemorySize;
+    }
+    if (outError != nullptr) { *outError = iIsSucceeded == true ? std::string{} : iPath + " : " + ioStitcher.mError; }
+    return iIsSucceeded;
+  };
+
+  std::ifstream file{iPath, std::ios::binary};
+  if (file.is_open() == false) { return finish(ioStitcher.Fail("File can not be opened.")); }
+
+  // Chunk keeps incomplete last line of previous chunk at front, and one more byte to terminate file.
+  // Incomplete line is copied from previous chunk, so there are two chunks.
+  const std::size_t chunkSize = std::max<std::size_t>(iOptions.mChunkSize, 64) * iThreadCount;
+  std::vector<char> chunks[2] = {std::vector<char>(chunkSize + 1), std::vector<char>(chunkSize + 1)};
+  std::vector<DObjRangeRecords> records(iThreadCount);
+  const auto checkMemory = [&]()
+  {
+    TU64 memorySize = ioStitcher.GetMemorySize() + chunks[0].size() + chunks[1].size();
+    for (const auto& range : records) { memorySize += range.GetMemorySize(); }
+    peakMemorySize = std::max(peakMemorySize, memorySize);
+    return iOptions.mMaxMemorySize == 0 || memorySize <= iOptions.mMaxMemorySize || ioStitcher.Fail("Memory ceiling is exceeded.");
+  };
+
+  const char* tail = nullptr;
+  std::size_t tailCount = 0;
+  for (TU32 current = 0; ; current ^= 1)
+  {
+    auto& chunk = chunks[current];
+    if (tailCount > 0) { std::memcpy(chunk.data(), tail, tailCount); }
+    file.read(chunk.data() + tailCount, static_cast<std::streamsize>(chunkSize - tailCount));
+    const std::size_t chunkCount = tailCount + static_cast<std::size_t>(file.gcount());
+    const bool isEndOfFile = file.eof();
+    if (isEndOfFile == false && file.good() == false) { return finish(ioStitcher.Fail("File can not be read.")); }
+    chunk[chunkCount] = '\0';
+
+    // Lines after last newline are parsed with next chunk.
+    const char* const chunkBegin = chunk.data();
+    const char* chunkEnd = chunkBegin + chunkCount;
+    if (isEndOfFile == false)
+    {
+      const char* lastNewline = chunkEnd;
+      while (lastNewline > chunkBegin && lastNewline[-1] != '\n') { --lastNewline; }
+      if (lastNewline == chunkBegin) { return finish(ioStitcher.Fail("Line is longer than chunk.")); }
+      chunkEnd = lastNewline;
+    }
+    tail = chunkEnd;
+    tailCount = static_cast<std::size_t>(chunkBegin + chunkCount - chunkEnd);
+
+    // Split chunk into ranges of similar size at newlines.
+    std::vector<std::thread> workers;
+    const char* rangeBegin = chunkBegin;
+    for (TU32 thread = 0; thread < iThreadCount; ++thread)
+    {
+      const char* rangeEnd = chunkEnd;
+      if (thread + 1 < iThreadCount)
+      {
+        rangeEnd = std::max(rangeBegin, chunkBegin + (chunkEnd - chunkBegin) * (thread + 1) / iThreadCount);
+        const auto* newline = static_cast<const char*>(std::memchr(rangeEnd, '\n', chunkEnd - rangeEnd));
+        rangeEnd = newline == nullptr ? chunkEnd : newline + 1;
+      }
+      if (thread + 1 == iThreadCount) { ParseRange(rangeBegin, rangeEnd, records[thread]); }
+      else { workers.emplace_back(ParseRange, rangeBegin, rangeEnd, std::ref(records[thread])); }
+      rangeBegin = rangeEnd;
+    }
+    for (auto& worker : workers) { worker.join(); }
+
+    if (ioStitcher.StitchRanges(records) == false || checkMemory() == false) { return finish(false); }
+    if (isEndOfFile == true) { return finish(ioStitcher.Flush()); }
+  }
+}
+
+} /// anonymous namespace
+
+namespace dy
+{
+
+bool ReadObjStream(
+    const std::string& iPath, IObjStreamSink& ioSink, const DObjStreamOptions& iOptions,
+    DObjStreamStats* outStats, std::string* outError)
+{
+  return ReadObjStreamParallel(iPath, 1, ioSink, iOptions, outStats, outError);
+}
+
+bool ReadObjStreamParallel(
+    const std::string& iPath, TU32 iThreadCount, IObjStreamSink& ioSink, const DObjStreamOptions& iOptions,
+    DObjStreamStats* outStats, std::string* outError)
+{
+  // Sequential stitcher has no step to join, so it is used for one thread.
+  if (iThreadCount <= 1)
+  {
+    FObjStitcher stitcher{ioSink, iOptions};
+    return ReadObjChunks(iPath, 1, stitcher, iOptions, outStats, outError);
+  }
+  FObjParallelStitcher stitcher{ioSink, iOptions, iThreadCount};
+  return ReadObjChunks(iPath, iThreadCount, stitcher, iOptions, outStats, outError);
+}
+
+} /// ::dy namespace
@@ -0,0 +1,109 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include "Type/FHelperQuantizeVertex.h"
+
+#include <algorithm>
+#include <cstring>
+#include "Type/FHelperQuantize.h"
+
+namespace
+{
+
+/// @brief Read `TCount` floats of vertex `iVertex` from strided attribute `iAttribute`.
+template <std::size_t TCount>
+std::array<float, TCount> ReadAttribute(const float* iAttribute, std::size_t iVertexStride, TU32 iVertex) noexcept
+{
+  std::array<float, TCount> result;
+  std::memcpy(result.data(),
+      reinterpret_cast<const unsigned char*>(iAttribute) + iVertexStride * iVertex, sizeof(float) * TCount);
+  return result;
+}
+
+} /// anonymous namespace
+
+namespace dy
+{
+
+DMatrix3x4 DCompactVertexDequantization::GetPositionMatrix() const noexcept
+{
+  return DMatrix3x4{
+      this->mPositionScale.X, 0, 0, this->mPositionOffset.X,
+      0, this->mPositionScale.Y, 0, this->mPositionOffset.Y,
+      0, 0, this->mPositionScale.Z, this->mPositionOffset.Z};
+}
+
+DVector4 DCompactVertexDequantization::GetUvTransform() const noexcept
+{
+  return DVector4{this->mUvScale.X, this->mUvScale.Y, this->mUvOffset.X, this->mUvOffset.Y};
+}
+
+DCompactVertexDequantization QuantizeVertices(
+    const float* iPositions, const float* iBaseColors, const float* iUvs, std::size_t iVertexStride,
+    TU32 iVertexCount, DCompactVertex* outVertices)
+{
+  DCompactVertexDequantization result;
+  if (iVertexCount == 0) { return result; }
+
+  // Bounds of position and texture coordinate.
+  auto minPosition = ReadAttribute<3>(iPositions, iVertexStride, 0), maxPosition = minPosition;
+  auto minUv = ReadAttribute<2>(iUvs, iVertexStride, 0), maxUv = minUv;
+  for (TU32 i = 1; i < iVertexCount; ++i)
+  {
+    const auto position = ReadAttribute<3>(iPositions, iVertexStride, i);
+    const auto uv = ReadAttribute<2>(iUvs, iVertexStride, i);
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+      minPosition[axis] = std::min(minPosition[axis], position[axis]);
+      maxPosition[axis] = std::max(maxPosition[axis], position[axis]);
+    }
+    for (std::size_t axis = 0; axis < 2; ++axis)
+    {
+      minUv[axis] = std::min(minUv[axis], uv[axis]);
+      maxUv[axis] = std::max(maxUv[axis], uv[axis]);
+    }
+  }
+
+  result.mPositionOffset = DVector3{minPosition[0], minPosition[1], minPosition[2]};
+  result.mPositionScale  = DVector3{
+      GetQuantizationExtent(minPosition[0], maxPosition[0]),
+      GetQuantizationExtent(minPosition[1], maxPosition[1]),
+      GetQuantizationExtent(minPosition[2], maxPosition[2])};
+  result.mUvOffset = DVector2{minUv[0], minUv[1]};
+  result.mUvScale  = DVector2{
+      GetQuantizationExtent(minUv[0], maxUv[0]),
+      GetQuantizationExtent(minUv[1], maxUv[1])};
+
+  const auto& positionScale = result.mPositionScale;
+  const auto& uvScale = result.mUvScale;
+  for (TU32 i = 0; i < iVertexCount; ++i)
+  {
+    const auto position = ReadAttribute<3>(iPositions, iVertexStride, i);
+    const auto color = ReadAttribute<3>(iBaseColors, iVertexStride, i);
+    const auto uv = ReadAttribute<2>(iUvs, iVertexStride, i);
+    DCompactVertex compact;
+    compact.mPosition = {
+        QuantizeUnorm16((position[0] - minPosition[0]) / positionScale.X),
+        QuantizeUnorm16((position[1] - minPosition[1]) / positionScale.Y),
+        QuantizeUnorm16((position[2] - minPosition[2]) / positionScale.Z),
+        0};
+    compact.mTextureUv0 = {
+        QuantizeUnorm16((uv[0] - minUv[0]) / uvScale.X),
+        QuantizeUnorm16((uv[1] - minUv[1]) / uvScale.Y)};
+    compact.mBaseColor = {QuantizeUnorm8(color[0]), QuantizeUnorm8(color[1]), QuantizeUnorm8(color[2]), 0xFF};
+    outVertices[i] = compact;
+  }
+  return result;
+}
+
+} /// ::dy namespace
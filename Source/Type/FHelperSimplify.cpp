@@ -0,0 +1,372 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+#include "Type/FHelperSimplify.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include "Type/DVector3.h"
+#include "Type/FHelperMeshOptimize.h"
+
+namespace
+{
+
+/// Position (x, y, z) and weighted texture coordinate (u, v).
+constexpr std::size_t kQuadricDimension = 5;
+/// Element count of upper triangle of symmetric matrix.
+constexpr std::size_t kQuadricMatrixSize = kQuadricDimension * (kQuadricDimension + 1) / 2;
+
+/// Collapse is rejected when normal of remaining triangle turns more than acos(0.25) ~= 75 degrees.
+constexpr float kMinNormalDot = 0.25f;
+
+using TQuadricPoint = std::array<double, kQuadricDimension>;
+
+/// @brief Get index of (iRow, iColumn) in row-major upper triangle, where iRow <= iColumn.
+constexpr std::size_t GetMatrixIndex(std::size_t iRow, std::size_t iColumn) noexcept
+{
+  return iRow * kQuadricDimension - iRow * (iRow + 1) / 2 + iColumn;
+}
+
+double Dot(const TQuadricPoint& iLhs, const TQuadricPoint& iRhs) noexcept
+{
+  double result = 0.0;
+  for (std::size_t i = 0; i < kQuadricDimension; ++i) { result += iLhs[i] * iRhs[i]; }
+  return result;
+}
+
+/// @struct DQuadric
+/// @brief Area weighted sum of squared distances to triangle planes, p^T A p + 2 b.p + c.
+struct DQuadric final
+{
+  std::array<double, kQuadricMatrixSize> mA = {};
+  TQuadricPoint mB = {};
+  double mC      = 0.0;
+  /// Sum of triangle areas, to get mean squared distance.
+  double mWeight = 0.0;
+
+  DQuadric& operator+=(const DQuadric& iOther) noexcept
+  {
+    for (std::size_t i = 0; i < kQuadricMatrixSize; ++i) { this->mA[i] += iOther.mA[i]; }
+    for (std::size_t i = 0; i < kQuadricDimension; ++i) { this->mB[i] += iOther.mB[i]; }
+    this->mC += iOther.mC;
+    this->mWeight += iOther.mWeight;
+    return *this;
+  }
+
+  /// @brief Get area weighted mean of squared distances from `iPoint` to planes.
+  double Evaluate(const TQuadricPoint& iPoint) const noexcept
+  {
+    if (this->mWeight <= 0.0) { return 0.0; }
+
+    double result = this->mC + 2.0 * Dot(this->mB, iPoint);
+    for (std::size_t row = 0; row < kQuadricDimension; ++row)
+    {
+      result += this->mA[GetMatrixIndex(row, row)] * iPoint[row] * iPoint[row];
+      for (std::size_t column = row + 1; column < kQuadricDimension; ++column)
+      {
+        result += 2.0 * this->mA[GetMatrixIndex(row, column)] * iPoint[row] * iPoint[column];
+      }
+    }
+    return std::max(result / this->mWeight, 0.0);
+  }
+};
+
+/// @brief Create quadric of squared distance to plane of triangle in 5D, weighted by `iWeight`.
+/// A = I - e1 e1^T - e2 e2^T, b = (p0.e1) e1 + (p0.e2) e2 - p0, c = p0.p0 - (p0.e1)^2 - (p0.e2)^2.
+DQuadric CreateTriangleQuadric(
+    const TQuadricPoint& iP0, const TQuadricPoint& iP1, const TQuadricPoint& iP2, double iWeight) noexcept
+{
+  TQuadricPoint e1, e2;
+  for (std::size_t i = 0; i < kQuadricDimension; ++i) { e1[i] = iP1[i] - iP0[i]; e2[i] = iP2[i] - iP0[i]; }
+  const double length1 = std::sqrt(Dot(e1, e1));
+  if (length1 <= 0.0) { return DQuadric{}; }
+  for (auto& value : e1) { value /= length1; }
+
+  const double projection = Dot(e2, e1);
+  for (std::size_t i = 0; i < kQuadricDimension; ++i) { e2[i] -= projection * e1[i]; }
+  const double length2 = std::sqrt(Dot(e2, e2));
+  if (length2 <= 0.0) { return DQuadric{}; }
+  for (auto& value : e2) { value /= length2; }
+
+  DQuadric result;
+  for (std::size_t row = 0; row < kQuadricDimension; ++row)
+  {
+    for (std::size_t column = row; column < kQuadricDimension; ++column)
+    {
+      const double identity = row == column ? 1.0 : 0.0;
+      result.mA[GetMatrixIndex(row, column)] = iWeight * (identity - e1[row] * e1[column] - e2[row] * e2[column]);
+    }
+  }
+  const double p0e1 = Dot(iP0, e1);
+  const double p0e2 = Dot(iP0, e2);
+  for (std::size_t i = 0; i < kQuadricDimension; ++i)
+  {
+    result.mB[i] = iWeight * (p0e1 * e1[i] + p0e2 * e2[i] - iP0[i]);
+  }
+  result.mC = iWeight * (Dot(iP0, iP0) - p0e1 * p0e1 - p0e2 * p0e2);
+  result.mWeight = iWeight;
+  return result;
+}
+
+/// @struct DCollapse
+/// @brief Candidate of collapse which moves `mFrom` onto `mTo`.
+struct DCollapse final
+{
+  double mCost = 0.0;
+  TU32   mFrom = 0;
+  TU32   mTo   = 0;
+};
+
+dy::DVector3 ReadPosition(const float* iPositions, std::size_t iVertexStride, TU32 iVertex) noexcept
+{
+  dy::DVector3 position;
+  std::memcpy(position.Data(),
+      reinterpret_cast<const unsigned char*>(iPositions) + iVertexStride * iVertex, sizeof(float) * 3);
+  return position;
+}
+
+/// @brief Find vertices which must not be removed. Vertices of same position are welded,
+/// and vertices on UV seams, open borders and non-manifold edges of welded mesh are locked.
+std::vector<bool> FindLockedVertices(
+    const TU32* iIndices, std::size_t iIndexCount, const float* iPositions, std::size_t iVertexStride, TU32 iVertexCount)
+{
+  // (1) Weld vertices of same position. Vertex which shares position with other one is on UV seam.
+  std::vector<dy::DVector3> positions(iVertexCount);
+  for (TU32 vertex = 0; vertex < iVertexCount; ++vertex) { positions[vertex] = ReadPosition(iPositions, iVertexStride, vertex); }
+  std::vector<TU32> order(iVertexCount);
+  std::iota(order.begin(), order.end(), 0);
+  const auto isLess = [&positions](TU32 iLhs, TU32 iRhs)
+  {
+    const auto& lhs = positions[iLhs];
+    const auto& rhs = positions[iRhs];
+    if (lhs.X != rhs.X) { return lhs.X < rhs.X; }
+    if (lhs.Y != rhs.Y) { return lhs.Y < rhs.Y; }
+    return lhs.Z < rhs.Z;
+  };
+  std::sort(order.begin(), order.end(), isLess);
+
+  std::vector<TU32> welded(iVertexCount);
+  std::vector<bool> isLockedWeld(iVertexCount, false);
+  for (std::size_t first = 0; first < order.size();)
+  {
+    std::size_t last = first + 1;
+    while (last < order.size() && isLess(order[first], order[last]) == false) { ++last; }
+    for (std::size_t i = first; i < last; ++i) { welded[order[i]] = order[first]; }
+    isLockedWeld[order[first]] = last - first > 1;
+    first = last;
+  }
+
+  // (2) Edge of manifold surface is shared by exactly two triangles.
+  std::vector<TU64> edges;
+  edges.reserve(iIndexCount);
+  for (std::size_t i = 0; i < iIndexCount; i += 3)
+  {
+    for (std::size_t corner = 0; corner < 3; ++corner)
+    {
+      const TU32 a = welded[iIndices[i + corner]];
+      const TU32 b = welded[iIndices[i + (corner + 1) % 3]];
+      if (a == b) { continue; }
+      edges.push_back((TU64{std::min(a, b)} << 32) | std::max(a, b));
+    }
+  }
+  std::sort(edges.begin(), edges.end());
+  for (std::size_t first = 0; first < edges.size();)
+  {
+    std::size_t last = first + 1;
+    while (last < edges.size() && edges[last] == edges[first]) { ++last; }
+    if (last - first != 2)
+    {
+      isLockedWeld[static_cast<TU32>(edges[first] >> 32)] = true;
+      isLockedWeld[static_cast<TU32>(edges[first])] = true;
+    }
+    first = last;
+  }
+
+  std::vector<bool> result(iVertexCount);
+  for (TU32 vertex = 0; vertex < iVertexCount; ++vertex) { result[vertex] = isLockedWeld[welded[vertex]]; }
+  return result;
+}
+
+/// @brief Build triangles around each vertex, as `outTriangles` range from `outOffsets[v]` to `outOffsets[v + 1]`.
+void BuildVertexTriangles(
+    const std::vector<TU32>& iIndices, TU32 iVertexCount, std::vector<TU32>& outOffsets, std::vector<TU32>& outTriangles)
+{
+  outOffsets.assign(std::size_t{iVertexCount} + 1, 0);
+  for (const TU32 index : iIndices) { ++outOffsets[index + 1]; }
+  std::partial_sum(outOffsets.begin(), outOffsets.end(), outOffsets.begin());
+
+  outTriangles.resize(iIndices.size());
+  std::vector<TU32> cursors(outOffsets.begin(), outOffsets.end() - 1);
+  for (std::size_t i = 0; i < iIndices.size(); ++i)
+  {
+    outTriangles[cursors[iIndices[i]]++] = static_cast<TU32>(i / 3);
+  }
+}
+
+} /// anonymous namespace
+
+namespace dy
+{
+
+std::vector<TU32> SimplifyMesh(
+    const TU32* iIndices, std::size_t iIndexCount,
+    const float* iPositions, const float* iUvs, std::size_t iVertexStride, TU32 iVertexCount,
+    std::size_t iTargetIndexCount, float iTargetError, float iUvWeight, float* outError)
+{
+  std::vector<TU32> result(iIndices, iIndices + iIndexCount);
+  if (outError != nullptr) { *outError = 0.0f; }
+  if (iIndexCount <= iTargetIndexCount) { return result; }
+
+  // (1) Sum quadrics of triangles around each vertex.
+  std::vector<TQuadricPoint> points(iVertexCount);
+  for (TU32 vertex = 0; vertex < iVertexCount; ++vertex)
+  {
+    const auto position = ReadPosition(iPositions, iVertexStride, vertex);
+    float uv[2];
+    std::memcpy(uv, reinterpret_cast<const unsigned char*>(iUvs) + iVertexStride * vertex, sizeof(uv));
+    points[vertex] = TQuadricPoint{position.X, position.Y, position.Z, uv[0] * iUvWeight, uv[1] * iUvWeight};
+  }
+  std::vector<DQuadric> quadrics(iVertexCount);
+  for (std::size_t i = 0; i < iIndexCount; i += 3)
+  {
+    const auto p0 = ReadPosition(iPositions, iVertexStride, iIndices[i + 0]);
+    const auto p1 = ReadPosition(iPositions, iVertexStride, iIndices[i + 1]);
+    const auto p2 = ReadPosition(iPositions, iVertexStride, iIndices[i + 2]);
+    const double area = 0.5 * DVector3::Cross(p1 - p0, p2 - p0).GetLength();
+    const auto quadric = CreateTriangleQuadric(points[iIndices[i + 0]], points[iIndices[i + 1]], points[iIndices[i + 2]], area);
+    for (std::size_t corner = 0; corner < 3; ++corner) { quadrics[iIndices[i + corner]] += quadric; }
+  }
+  const auto lockedVertices = FindLockedVertices(iIndices, iIndexCount, iPositions, iVertexStride, iVertexCount);
+
+  // (2) Each pass collapses cheapest edges of which vertices are not touched by other collapse in same pass.
+  const double maxCost = double{iTargetError} * double{iTargetError};
+  double resultCost = 0.0;
+  std::vector<TU32> offsets, triangles, remap(iVertexCount);
+  std::vector<bool> touchedVertices;
+  std::vector<DCollapse> collapses;
+  while (result.size() > iTargetIndexCount)
+  {
+    BuildVertexTriangles(result, iVertexCount, offsets, triangles);
+    collapses.clear();
+    for (std::size_t i = 0; i < result.size(); i += 3)
+    {
+      for (std::size_t corner = 0; corner < 3; ++corner)
+      {
+        const TU32 a = result[i + corner];
+        const TU32 b = result[i + (corner + 1) % 3];
+        const double costAb = lockedVertices[a] == false ? quadrics[a].Evaluate(points[b]) : NumericalMax<double>;
+        const double costBa = lockedVertices[b] == false ? quadrics[b].Evaluate(points[a]) : NumericalMax<double>;
+        if (costAb == NumericalMax<double> && costBa == NumericalMax<double>) { continue; }
+        collapses.push_back(costAb <= costBa ? DCollapse{costAb, a, b} : DCollapse{costBa, b, a});
+      }
+    }
+    std::sort(collapses.begin(), collapses.end(),
+        [](const DCollapse& iLhs, const DCollapse& iRhs) { return iLhs.mCost < iRhs.mCost; });
+
+    std::iota(remap.begin(), remap.end(), 0);
+    touchedVertices.assign(iVertexCount, false);
+    std::size_t triangleCount = result.size() / 3;
+    std::size_t collapseCount = 0;
+    for (const auto& collapse : collapses)
+    {
+      if (collapse.mCost > maxCost || triangleCount * 3 <= iTargetIndexCount) { break; }
+      if (touchedVertices[collapse.mFrom] == true || touchedVertices[collapse.mTo] == true) { continue; }
+
+      // Reject collapse which flips any remaining triangle around `mFrom`.
+      bool isFlipped = false;
+      std::size_t removedCount = 0;
+      for (TU32 i = offsets[collapse.mFrom]; i < offsets[collapse.mFrom + 1] && isFlipped == false; ++i)
+      {
+        std::array<TU32, 3> corners;
+        for (std::size_t corner = 0; corner < 3; ++corner) { corners[corner] = remap[result[triangles[i] * 3 + corner]]; }
+        if (corners[0] == corners[1] || corners[1] == corners[2] || corners[2] == corners[0]) { continue; }
+        if (std::find(corners.begin(), corners.end(), collapse.mTo) != corners.end()) { ++removedCount; continue; }
+
+        std::array<DVector3, 3> positions;
+        for (std::size_t corner = 0; corner < 3; ++corner) { positions[corner] = ReadPosition(iPositions, iVertexStride, corners[corner]); }
+        const auto before = DVector3::Cross(positions[1] - positions[0], positions[2] - positions[0]);
+        *std::find(corners.begin(), corners.end(), collapse.mFrom) = collapse.mTo;
+        for (std::size_t corner = 0; corner < 3; ++corner) { positions[corner] = ReadPosition(iPositions, iVertexStride, corners[corner]); }
+        const auto after = DVector3::Cross(positions[1] - positions[0], positions[2] - positions[0]);
+        isFlipped = DVector3::Dot(before, after) <= kMinNormalDot * before.GetLength() * after.GetLength();
+      }
+      if (isFlipped == true) { continue; }
+
+      remap[collapse.mFrom] = collapse.mTo;
+      quadrics[collapse.mTo] += quadrics[collapse.mFrom];
+      touchedVertices[collapse.mFrom] = true;
+      touchedVertices[collapse.mTo] = true;
+      resultCost = std::max(resultCost, collapse.mCost);
+      triangleCount -= removedCount;
+      ++collapseCount;
+    }
+    if (collapseCount == 0) { break; }
+
+    // (3) Apply collapses and remove degenerate triangles.
+    std::size_t writeCount = 0;
+    for (std::size_t i = 0; i < result.size(); i += 3)
+    {
+      const TU32 a = remap[result[i + 0]], b = remap[result[i + 1]], c = remap[result[i + 2]];
+      if (a == b || b == c || c == a) { continue; }
+      result[writeCount + 0] = a;
+      result[writeCount + 1] = b;
+      result[writeCount + 2] = c;
+      writeCount += 3;
+    }
+    result.resize(writeCount);
+  }
+
+  if (outError != nullptr) { *outError = static_cast<float>(std::sqrt(resultCost)); }
+  return result;
+}
+
+void BuildLodChain(
+    const TU32* iIndices, std::size_t iIndexCount,
+    const float* iPositions, const float* iUvs, std::size_t iVertexStride, TU32 iVertexCount, float iUvWeight,
+    std::vector<TU32>& outIndices, std::vector<DMeshLod>& outLods,
+    TU32 iMaxLodCount, float iReduction)
+{
+  outIndices.assign(iIndices, iIndices + iIndexCount);
+  outLods.assign(1, DMeshLod{0, static_cast<TU32>(iIndexCount), 0, 0, 0.0f});
+  while (outLods.size() < iMaxLodCount)
+  {
+    const std::size_t previousIndexCount = outLods.back().mIndexCount;
+    const float previousError = outLods.back().mError;
+    const auto targetIndexCount = static_cast<std::size_t>(TF64(previousIndexCount / 3) * iReduction) * 3;
+    if (targetIndexCount == 0) { break; }
+
+    float error = 0.0f;
+    auto indices = SimplifyMesh(iIndices, iIndexCount, iPositions, iUvs, iVertexStride, iVertexCount,
+        targetIndexCount, NumericalMax<float>, iUvWeight, &error);
+    // Stop when locked vertices or flips keep most of triangles.
+    if (indices.empty() == true || indices.size() * 10 > previousIndexCount * 9) { break; }
+
+    OptimizeVertexCache(indices.data(), indices.size(), iVertexCount, indices.data());
+    outLods.push_back(DMeshLod{
+        static_cast<TU32>(outIndices.size()), static_cast<TU32>(indices.size()), 0, 0, std::max(error, previousError)});
+    outIndices.insert(outIndices.end(), indices.begin(), indices.end());
+  }
+}
+
+TU32 SelectLod(const DMeshLod* iLods, std::size_t iLodCount, float iMaxError) noexcept
+{
+  TU32 result = 0;
+  while (result + 1 < iLodCount && iLods[result + 1].mError <= iMaxError) { ++result; }
+  return result;
+}
+
+} /// ::dy namespace
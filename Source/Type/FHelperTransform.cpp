@@ -0,0 +1,318 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+/// Header file
+#include "Type/FHelperTransform.h"
+
+#include "Type/FHelperSimd.h"
+
+namespace
+{
+
+/// @struct DTransformKernel
+/// @brief Broadcasted matrix elements for transforming (x, y, z) streams. \n
+/// Translation column is multiplied by w, which is 1 if `TIsPoint` is true or 0 if false.
+template <typename TRegister, bool TIsPoint>
+struct DTransformKernel final
+{
+  /// Broadcasted column c, row r. Column 3 is already multiplied by w.
+  TRegister m[4][3];
+
+  void Transform(
+      const TRegister& x, const TRegister& y, const TRegister& z,
+      TRegister& outX, TRegister& outY, TRegister& outZ) const noexcept
+  {
+    using dy::simd::MulAdd;
+    TRegister result[3];
+    for (int r = 0; r < 3; ++r)
+    {
+      // Same pairwise summation (c0x + c1y) + (c2z + c3w) and rounding to DMatrix4::MultiplyVector,
+      // so result is bit-exact to it. c3 * w is rounded once with or without FMA, because w is 0 or 1.
+      const TRegister lower = MulAdd(m[1][r], y, Mul(m[0][r], x));
+      const TRegister upper = Add(Mul(m[2][r], z), m[3][r]);
+      result[r] = Add(lower, upper);
+    }
+    outX = result[0]; outY = result[1]; outZ = result[2];
+  }
+
+private:
+  static __m128 Mul(const __m128& a, const __m128& b) noexcept { return _mm_mul_ps(a, b); }
+  static __m128 Add(const __m128& a, const __m128& b) noexcept { return _mm_add_ps(a, b); }
+#if defined(MDY_SIMD_AVX)
+  static __m256 Mul(const __m256& a, const __m256& b) noexcept { return _mm256_mul_ps(a, b); }
+  static __m256 Add(const __m256& a, const __m256& b) noexcept { return _mm256_add_ps(a, b); }
+#endif
+};
+
+/// @brief Create kernel from matrix.
+template <typename TRegister, bool TIsPoint>
+DTransformKernel<TRegister, TIsPoint> CreateKernel(const dy::DMatrix4& iMatrix) noexcept
+{
+  DTransformKernel<TRegister, TIsPoint> kernel;
+  for (std::size_t c = 0; c < 4; ++c)
+  {
+    for (std::size_t r = 0; r < 3; ++r)
+    {
+      // Translation of direction is 0 * c3, which keeps sign of zero and NaN same to MultiplyVector.
+      const float value = c == 3 ? iMatrix[c][r] * (TIsPoint == true ? 1.0f : 0.0f) : iMatrix[c][r];
+      if constexpr (sizeof(TRegister) == sizeof(__m128)) { kernel.m[c][r] = _mm_set1_ps(value); }
+#if defined(MDY_SIMD_AVX)
+      else                                                 { kernel.m[c][r] = _mm256_set1_ps(value); }
+#endif
+    }
+  }
+  return kernel;
+}
+
+/// @brief Transform remainder of less than 4 points in place with `iKernel` of __m128. \n
+/// Remainder is not transformed as scalar, because compiler may contract scalar expression differently.
+template <typename TKernel>
+void TransformRemainder(const TKernel& iKernel, float (&ioX)[4], float (&ioY)[4], float (&ioZ)[4]) noexcept
+{
+  __m128 x, y, z;
+  iKernel.Transform(_mm_loadu_ps(ioX), _mm_loadu_ps(ioY), _mm_loadu_ps(ioZ), x, y, z);
+  _mm_storeu_ps(ioX, x);
+  _mm_storeu_ps(ioY, y);
+  _mm_storeu_ps(ioZ, z);
+}
+
+template <bool TIsPoint>
+void TransformStream(
+    const dy::DMatrix4& iMatrix,
+    const dy::DConstVector3Stream& iInput, std::size_t iCount, const dy::DVector3Stream& outResult) noexcept
+{
+  std::size_t i = 0;
+#if defined(MDY_SIMD_AVX)
+  const auto kernel8 = CreateKernel<__m256, TIsPoint>(iMatrix);
+  for (; i + 8 <= iCount; i += 8)
+  {
+    __m256 x, y, z;
+    kernel8.Transform(
+        _mm256_loadu_ps(iInput.mX + i), _mm256_loadu_ps(iInput.mY + i), _mm256_loadu_ps(iInput.mZ + i),
+        x, y, z);
+    _mm256_storeu_ps(outResult.mX + i, x);
+    _mm256_storeu_ps(outResult.mY + i, y);
+    _mm256_storeu_ps(outResult.mZ + i, z);
+  }
+#endif
+  const auto kernel4 = CreateKernel<__m128, TIsPoint>(iMatrix);
+  for (; i + 4 <= iCount; i += 4)
+  {
+    __m128 x, y, z;
+    kernel4.Transform(
+        _mm_loadu_ps(iInput.mX + i), _mm_loadu_ps(iInput.mY + i), _mm_loadu_ps(iInput.mZ + i),
+        x, y, z);
+    _mm_storeu_ps(outResult.mX + i, x);
+    _mm_storeu_ps(outResult.mY + i, y);
+    _mm_storeu_ps(outResult.mZ + i, z);
+  }
+  if (i < iCount)
+  {
+    float x[4] = {}, y[4] = {}, z[4] = {};
+    const std::size_t count = iCount - i;
+    for (std::size_t j = 0; j < count; ++j) { x[j] = iInput.mX[i + j]; y[j] = iInput.mY[i + j]; z[j] = iInput.mZ[i + j]; }
+    TransformRemainder(kernel4, x, y, z);
+    for (std::size_t j = 0; j < count; ++j) { outResult.mX[i + j] = x[j]; outResult.mY[i + j] = y[j]; outResult.mZ[i + j] = z[j]; }
+  }
+}
+
+template <bool TIsPoint>
+void TransformPacked(
+    const dy::DMatrix4& iMatrix,
+    const dy::DVector3* iInput, std::size_t iCount, dy::DVector3* outResult) noexcept
+{
+  static_assert(sizeof(dy::DVector3) == 12, "DVector3 must be packed.");
+  using dy::simd::TransposeAosToSoa3;
+  using dy::simd::TransposeSoaToAos3;
+
+  const auto kernel4 = CreateKernel<__m128, TIsPoint>(iMatrix);
+  std::size_t i = 0;
+  // Four DVector3 are 12 floats which are three __m128.
+  for (; i + 4 <= iCount; i += 4)
+  {
+    const float* source = iInput[i].Data();
+    __m128 x, y, z;
+    TransposeAosToSoa3(_mm_loadu_ps(source), _mm_loadu_ps(source + 4), _mm_loadu_ps(source + 8), x, y, z);
+    kernel4.Transform(x, y, z, x, y, z);
+
+    __m128 v0, v1, v2;
+    TransposeSoaToAos3(x, y, z, v0, v1, v2);
+    float* destination = outResult[i].Data();
+    _mm_storeu_ps(destination, v0);
+    _mm_storeu_ps(destination + 4, v1);
+    _mm_storeu_ps(destination + 8, v2);
+  }
+  if (i < iCount)
+  {
+    float x[4] = {}, y[4] = {}, z[4] = {};
+    const std::size_t count = iCount - i;
+    for (std::size_t j = 0; j < count; ++j) { x[j] = iInput[i + j].X; y[j] = iInput[i + j].Y; z[j] = iInput[i + j].Z; }
+    TransformRemainder(kernel4, x, y, z);
+    for (std::size_t j = 0; j < count; ++j) { outResult[i + j] = dy::DVector3{x[j], y[j], z[j]}; }
+  }
+}
+
+/// @brief Upper 3x3 of T * R * S for 4 instances. mColumnRow[c][r] has 4 instances of column c, row r.
+struct DRotationScale4 final
+{
+  __m128 mColumnRow[3][3];
+};
+
+/// @brief Same expressions to DQuaternion::GetRotationMatrix4x4, then scaled per column.
+DRotationScale4 ComposeRotationScale(
+    const __m128& x, const __m128& y, const __m128& z, const __m128& w,
+    const __m128& sx, const __m128& sy, const __m128& sz) noexcept
+{
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 two = _mm_set1_ps(2.0f);
+  const __m128 xx = _mm_mul_ps(x, x), yy = _mm_mul_ps(y, y), zz = _mm_mul_ps(z, z);
+  const __m128 xy = _mm_mul_ps(x, y), xz = _mm_mul_ps(x, z), yz = _mm_mul_ps(y, z);
+  const __m128 wx = _mm_mul_ps(w, x), wy = _mm_mul_ps(w, y), wz = _mm_mul_ps(w, z);
+
+  DRotationScale4 result;
+  auto& m = result.mColumnRow;
+  m[0][0] = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx);
+  m[0][1] = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx);
+  m[0][2] = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx);
+  m[1][0] = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy);
+  m[1][1] = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy);
+  m[1][2] = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy);
+  m[2][0] = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz);
+  m[2][1] = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz);
+  m[2][2] = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz);
+  return result;
+}
+
+/// @brief Load 4 instances of position, rotation and scale as structure-of-arrays,
+/// then compose upper 3x3 of T * R * S. Translation is returned as `outX`, `outY` and `outZ`.
+DRotationScale4 ComposeRotationScale(
+    const dy::DVector3* iPositions, const dy::DQuaternion* iRotations, const dy::DVector3* iScales,
+    __m128& outX, __m128& outY, __m128& outZ) noexcept
+{
+  using dy::simd::TransposeAosToSoa3;
+
+  __m128 x = iRotations[0].__Simd,  y = iRotations[1].__Simd;
+  __m128 z = iRotations[2].__Simd,  w = iRotations[3].__Simd;
+  _MM_TRANSPOSE4_PS(x, y, z, w);
+
+  const float* scale = iScales[0].Data();
+  __m128 sx, sy, sz;
+  TransposeAosToSoa3(_mm_loadu_ps(scale), _mm_loadu_ps(scale + 4), _mm_loadu_ps(scale + 8), sx, sy, sz);
+  const float* position = iPositions[0].Data();
+  TransposeAosToSoa3(_mm_loadu_ps(position), _mm_loadu_ps(position + 4), _mm_loadu_ps(position + 8), outX, outY, outZ);
+
+  return ComposeRotationScale(x, y, z, w, sx, sy, sz);
+}
+
+/// @brief Transpose 4 instances of (r0, r1, r2, r3) rows into column `iColumn` of 4 matrices.
+void StoreColumn4(__m128 r0, __m128 r1, __m128 r2, __m128 r3, std::size_t iColumn, dy::DMatrix4* outMatrices) noexcept
+{
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+  _mm_storeu_ps(outMatrices[0][iColumn].Data(), r0);
+  _mm_storeu_ps(outMatrices[1][iColumn].Data(), r1);
+  _mm_storeu_ps(outMatrices[2][iColumn].Data(), r2);
+  _mm_storeu_ps(outMatrices[3][iColumn].Data(), r3);
+}
+
+/// @brief Transpose 4 instances of row elements and store them to row `iRow` of 4 matrices.
+void StoreRow4(__m128 c0, __m128 c1, __m128 c2, __m128 c3, std::size_t iRow, dy::DMatrix3x4* outMatrices) noexcept
+{
+  _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+  _mm_storeu_ps(outMatrices[0].Data() + 4 * iRow, c0);
+  _mm_storeu_ps(outMatrices[1].Data() + 4 * iRow, c1);
+  _mm_storeu_ps(outMatrices[2].Data() + 4 * iRow, c2);
+  _mm_storeu_ps(outMatrices[3].Data() + 4 * iRow, c3);
+}
+
+} /// anonymous namespace
+
+namespace dy
+{
+
+void TransformPoints(
+    const DMatrix4& iMatrix,
+    const DConstVector3Stream& iPoints, std::size_t iCount, const DVector3Stream& outPoints) noexcept
+{
+  TransformStream<true>(iMatrix, iPoints, iCount, outPoints);
+}
+
+void TransformDirections(
+    const DMatrix4& iMatrix,
+    const DConstVector3Stream& iDirections, std::size_t iCount, const DVector3Stream& outDirections) noexcept
+{
+  TransformStream<false>(iMatrix, iDirections, iCount, outDirections);
+}
+
+void TransformPoints(
+    const DMatrix4& iMatrix,
+    const DVector3* iPoints, std::size_t iCount, DVector3* outPoints) noexcept
+{
+  TransformPacked<true>(iMatrix, iPoints, iCount, outPoints);
+}
+
+void TransformDirections(
+    const DMatrix4& iMatrix,
+    const DVector3* iDirections, std::size_t iCount, DVector3* outDirections) noexcept
+{
+  TransformPacked<false>(iMatrix, iDirections, iCount, outDirections);
+}
+
+void ComposeTransforms(
+    const DVector3* iPositions, const DQuaternion* iRotations, const DVector3* iScales,
+    std::size_t iCount, DMatrix4* outMatrices) noexcept
+{
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 one = _mm_set1_ps(1.0f);
+  std::size_t i = 0;
+  for (; i + 4 <= iCount; i += 4)
+  {
+    __m128 px, py, pz;
+    const auto rotationScale = ComposeRotationScale(iPositions + i, iRotations + i, iScales + i, px, py, pz);
+    const auto& m = rotationScale.mColumnRow;
+    StoreColumn4(m[0][0], m[0][1], m[0][2], zero, 0, outMatrices + i);
+    StoreColumn4(m[1][0], m[1][1], m[1][2], zero, 1, outMatrices + i);
+    StoreColumn4(m[2][0], m[2][1], m[2][2], zero, 2, outMatrices + i);
+    StoreColumn4(px, py, pz, one, 3, outMatrices + i);
+  }
+  for (; i < iCount; ++i)
+  {
+    auto& matrix = outMatrices[i];
+    matrix = iRotations[i].GetRotationMatrix4x4();
+    matrix[0] = matrix[0] * iScales[i].X;
+    matrix[1] = matrix[1] * iScales[i].Y;
+    matrix[2] = matrix[2] * iScales[i].Z;
+    matrix[3] = DVector4{iPositions[i].X, iPositions[i].Y, iPositions[i].Z, 1.0f};
+  }
+}
+
+void ComposeTransforms(
+    const DVector3* iPositions, const DQuaternion* iRotations, const DVector3* iScales,
+    std::size_t iCount, DMatrix3x4* outMatrices) noexcept
+{
+  std::size_t i = 0;
+  for (; i + 4 <= iCount; i += 4)
+  {
+    __m128 px, py, pz;
+    const auto rotationScale = ComposeRotationScale(iPositions + i, iRotations + i, iScales + i, px, py, pz);
+    const auto& m = rotationScale.mColumnRow;
+    StoreRow4(m[0][0], m[1][0], m[2][0], px, 0, outMatrices + i);
+    StoreRow4(m[0][1], m[1][1], m[2][1], py, 1, outMatrices + i);
+    StoreRow4(m[0][2], m[1][2], m[2][2], pz, 2, outMatrices + i);
+  }
+  for (; i < iCount; ++i)
+  {
+    outMatrices[i] = DMatrix3x4::CreateWithTransform(iPositions[i], iRotations[i], iScales[i]);
+  }
+}
+
+} /// ::dy namespace
@@ -0,0 +1,108 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+/// Header file
+#include "Type/FHelperVectorSpan.h"
+
+#include <atomic>
+#include "FHelperVectorSpanKernel.h"
+
+namespace
+{
+
+/// @brief DVector3 array is packed float array. Cast without dereference, so null pointer with 0 count is fine.
+const float* ToFloats(const dy::DVector3* iVectors) noexcept { return reinterpret_cast<const float*>(iVectors); }
+float* ToFloats(dy::DVector3* iVectors) noexcept { return reinterpret_cast<float*>(iVectors); }
+
+const dy::DVectorSpanKernelTable& GetKernelOfLevel(dy::ESimdLevel iLevel) noexcept
+{
+  switch (iLevel)
+  {
+  case dy::ESimdLevel::Avx512: return dy::GetVectorSpanKernelAvx512();
+  case dy::ESimdLevel::Avx2:   return dy::GetVectorSpanKernelAvx2();
+  default:                     return dy::GetVectorSpanKernelSse();
+  }
+}
+
+/// Selected kernel table. Null until first call, then selected from CPUID.
+std::atomic<const dy::DVectorSpanKernelTable*> sKernel = nullptr;
+
+const dy::DVectorSpanKernelTable& GetKernel() noexcept
+{
+  auto* pKernel = sKernel.load(std::memory_order_acquire);
+  if (pKernel == nullptr)
+  {
+    // Racing threads select same table, so just overwrite.
+    pKernel = &GetKernelOfLevel(dy::GetSupportedSimdLevel());
+    sKernel.store(pKernel, std::memory_order_release);
+  }
+  return *pKernel;
+}
+
+} /// anonymous namespace
+
+namespace dy
+{
+
+void AddVectors(const DVector3* iLhs, const DVector3* iRhs, std::size_t iCount, DVector3* outResult) noexcept
+{
+  GetKernel().mAdd(ToFloats(iLhs), ToFloats(iRhs), iCount * 3, ToFloats(outResult));
+}
+
+void ScaleVectors(const DVector3* iVectors, float iScale, std::size_t iCount, DVector3* outResult) noexcept
+{
+  GetKernel().mScale(ToFloats(iVectors), iScale, iCount * 3, ToFloats(outResult));
+}
+
+void LerpVectors(const DVector3* iLhs, const DVector3* iRhs, float iOffset, std::size_t iCount, DVector3* outResult) noexcept
+{
+  GetKernel().mLerp(ToFloats(iLhs), ToFloats(iRhs), iOffset, iCount * 3, ToFloats(outResult));
+}
+
+void DotVectors(const DVector3* iLhs, const DVector3* iRhs, std::size_t iCount, float* outResult) noexcept
+{
+  GetKernel().mDot(ToFloats(iLhs), ToFloats(iRhs), iCount, outResult);
+}
+
+void CrossVectors(const DVector3* iLhs, const DVector3* iRhs, std::size_t iCount, DVector3* outResult) noexcept
+{
+  GetKernel().mCross(ToFloats(iLhs), ToFloats(iRhs), iCount, ToFloats(outResult));
+}
+
+void NormalizeVectors(const DVector3* iVectors, std::size_t iCount, DVector3* outResult) noexcept
+{
+  GetKernel().mNormalize(ToFloats(iVectors), iCount, ToFloats(outResult));
+}
+
+DAabb ComputeBounds(const DVector3* iPoints, std::size_t iCount) noexcept
+{
+  if (iCount == 0) { return DAabb{}; }
+
+  DAabb result;
+  GetKernel().mBounds(ToFloats(iPoints), iCount, result.mMin.Data(), result.mMax.Data());
+  return result;
+}
+
+ESimdLevel GetVectorSpanSimdLevel() noexcept
+{
+  return GetKernel().mLevel;
+}
+
+void SetVectorSpanSimdLevel(ESimdLevel iLevel) noexcept
+{
+  const auto supportedLevel = GetSupportedSimdLevel();
+  const auto level = (iLevel < supportedLevel) ? iLevel : supportedLevel;
+  sKernel.store(&GetKernelOfLevel(level), std::memory_order_release);
+}
+
+} /// ::dy namespace
@@ -0,0 +1,73 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+//!
+//! AVX2 kernels, 8 vectors per iteration. Only this file is built with AVX2 flags.
+//!
+
+#include <immintrin.h>
+#include "FHelperVectorSpanKernel.h"
+
+namespace
+{
+
+struct DIsaAvx2 final
+{
+  using TRegister = __m256;
+  static constexpr std::size_t kWidth = 8;
+
+  static TRegister Load(const float* p) noexcept { return _mm256_loadu_ps(p); }
+  static void Store(float* p, const TRegister& v) noexcept { _mm256_storeu_ps(p, v); }
+  static TRegister Set1(float v) noexcept { return _mm256_set1_ps(v); }
+  static TRegister Add(const TRegister& a, const TRegister& b) noexcept { return _mm256_add_ps(a, b); }
+  static TRegister Sub(const TRegister& a, const TRegister& b) noexcept { return _mm256_sub_ps(a, b); }
+  static TRegister Mul(const TRegister& a, const TRegister& b) noexcept { return _mm256_mul_ps(a, b); }
+  static TRegister Div(const TRegister& a, const TRegister& b) noexcept { return _mm256_div_ps(a, b); }
+  static TRegister Min(const TRegister& a, const TRegister& b) noexcept { return _mm256_min_ps(a, b); }
+  static TRegister Max(const TRegister& a, const TRegister& b) noexcept { return _mm256_max_ps(a, b); }
+  static TRegister Sqrt(const TRegister& a) noexcept { return _mm256_sqrt_ps(a); }
+  static float SqrtScalar(float v) noexcept { return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(v))); }
+
+  template <int TX, int TY, int TZ, int TW>
+  static TRegister Shuffle(const TRegister& a, const TRegister& b) noexcept
+  {
+    return _mm256_shuffle_ps(a, b, _MM_SHUFFLE(TW, TZ, TY, TX));
+  }
+
+  /// Lane 0 is vector 0..3, lane 1 is vector 4..7.
+  static TRegister LoadLanes(const float* p, std::size_t iOffset) noexcept
+  {
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + iOffset)), _mm_loadu_ps(p + 12 + iOffset), 1);
+  }
+
+  static void StoreLanes(float* p, std::size_t iOffset, const TRegister& v) noexcept
+  {
+    _mm_storeu_ps(p + iOffset, _mm256_castps256_ps128(v));
+    _mm_storeu_ps(p + 12 + iOffset, _mm256_extractf128_ps(v, 1));
+  }
+};
+
+} /// anonymous namespace
+
+#include "FHelperVectorSpanKernel.inl"
+
+namespace dy
+{
+
+const DVectorSpanKernelTable& GetVectorSpanKernelAvx2() noexcept
+{
+  static constexpr DVectorSpanKernelTable kTable = CreateKernelTable<DIsaAvx2>(ESimdLevel::Avx2);
+  return kTable;
+}
+
+} /// ::dy namespace
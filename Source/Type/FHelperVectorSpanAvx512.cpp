@@ -0,0 +1,78 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+//!
+//! AVX-512 Foundation kernels, 16 vectors per iteration. Only this file is built with AVX-512 flags.
+//!
+
+#include <immintrin.h>
+#include "FHelperVectorSpanKernel.h"
+
+namespace
+{
+
+struct DIsaAvx512 final
+{
+  using TRegister = __m512;
+  static constexpr std::size_t kWidth = 16;
+
+  static TRegister Load(const float* p) noexcept { return _mm512_loadu_ps(p); }
+  static void Store(float* p, const TRegister& v) noexcept { _mm512_storeu_ps(p, v); }
+  static TRegister Set1(float v) noexcept { return _mm512_set1_ps(v); }
+  static TRegister Add(const TRegister& a, const TRegister& b) noexcept { return _mm512_add_ps(a, b); }
+  static TRegister Sub(const TRegister& a, const TRegister& b) noexcept { return _mm512_sub_ps(a, b); }
+  static TRegister Mul(const TRegister& a, const TRegister& b) noexcept { return _mm512_mul_ps(a, b); }
+  static TRegister Div(const TRegister& a, const TRegister& b) noexcept { return _mm512_div_ps(a, b); }
+  static TRegister Min(const TRegister& a, const TRegister& b) noexcept { return _mm512_min_ps(a, b); }
+  static TRegister Max(const TRegister& a, const TRegister& b) noexcept { return _mm512_max_ps(a, b); }
+  static TRegister Sqrt(const TRegister& a) noexcept { return _mm512_sqrt_ps(a); }
+  static float SqrtScalar(float v) noexcept { return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(v))); }
+
+  template <int TX, int TY, int TZ, int TW>
+  static TRegister Shuffle(const TRegister& a, const TRegister& b) noexcept
+  {
+    return _mm512_shuffle_ps(a, b, _MM_SHUFFLE(TW, TZ, TY, TX));
+  }
+
+  /// Lane k is vector 4k..4k+3.
+  static TRegister LoadLanes(const float* p, std::size_t iOffset) noexcept
+  {
+    TRegister result = _mm512_castps128_ps512(_mm_loadu_ps(p + iOffset));
+    result = _mm512_insertf32x4(result, _mm_loadu_ps(p + 12 + iOffset), 1);
+    result = _mm512_insertf32x4(result, _mm_loadu_ps(p + 24 + iOffset), 2);
+    return _mm512_insertf32x4(result, _mm_loadu_ps(p + 36 + iOffset), 3);
+  }
+
+  static void StoreLanes(float* p, std::size_t iOffset, const TRegister& v) noexcept
+  {
+    _mm_storeu_ps(p + iOffset,      _mm512_castps512_ps128(v));
+    _mm_storeu_ps(p + 12 + iOffset, _mm512_extractf32x4_ps(v, 1));
+    _mm_storeu_ps(p + 24 + iOffset, _mm512_extractf32x4_ps(v, 2));
+    _mm_storeu_ps(p + 36 + iOffset, _mm512_extractf32x4_ps(v, 3));
+  }
+};
+
+} /// anonymous namespace
+
+#include "FHelperVectorSpanKernel.inl"
+
+namespace dy
+{
+
+const DVectorSpanKernelTable& GetVectorSpanKernelAvx512() noexcept
+{
+  static constexpr DVectorSpanKernelTable kTable = CreateKernelTable<DIsaAvx512>(ESimdLevel::Avx512);
+  return kTable;
+}
+
+} /// ::dy namespace
@@ -0,0 +1,48 @@
+#pragma once
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+//!
+//! Private header of FHelperVectorSpan.
+//! Kernel files are compiled with wider instruction set flags, so they must not include headers
+//! which have inline functions (DVector3 etc). Linker can pick AVX version of same inline function
+//! for baseline callers. Every kernel works on raw float arrays and is in anonymous namespace.
+//!
+
+#include <cstddef>
+#include "Type/FHelperCpuFeature.h"
+
+namespace dy
+{
+
+/// @struct DVectorSpanKernelTable
+/// @brief Kernel function table of one instruction set. Vectors are packed (x, y, z) floats.
+struct DVectorSpanKernelTable final
+{
+  ESimdLevel mLevel;
+  /// Element-wise kernels take float count, not vector count.
+  void (*mAdd)(const float* iLhs, const float* iRhs, std::size_t iFloatCount, float* outResult);
+  void (*mScale)(const float* iVectors, float iScale, std::size_t iFloatCount, float* outResult);
+  void (*mLerp)(const float* iLhs, const float* iRhs, float iOffset, std::size_t iFloatCount, float* outResult);
+  void (*mDot)(const float* iLhs, const float* iRhs, std::size_t iCount, float* outResult);
+  void (*mCross)(const float* iLhs, const float* iRhs, std::size_t iCount, float* outResult);
+  void (*mNormalize)(const float* iVectors, std::size_t iCount, float* outResult);
+  /// `iCount` must be bigger than 0.
+  void (*mBounds)(const float* iPoints, std::size_t iCount, float* outMin, float* outMax);
+};
+
+const DVectorSpanKernelTable& GetVectorSpanKernelSse() noexcept;
+const DVectorSpanKernelTable& GetVectorSpanKernelAvx2() noexcept;
+const DVectorSpanKernelTable& GetVectorSpanKernelAvx512() noexcept;
+
+} /// ::dy namespace
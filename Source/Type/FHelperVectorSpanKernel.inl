@@ -0,0 +1,213 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+//!
+//! Kernel templates of FHelperVectorSpan. Included by each kernel file after `TIsa` traits are defined.
+//! `TIsa` provides TRegister, kWidth (floats per register) and static functions
+//! Load, Store, Set1, Add, Sub, Mul, Div, Min, Max, Sqrt, SqrtScalar, Shuffle<X, Y, Z, W>,
+//! LoadLanes and StoreLanes. LoadLanes(p, offset) loads 128-bit lane k from p + 12k + offset.
+//! Everything is in anonymous namespace, so kernels never collide between instruction sets.
+//!
+
+#include "FHelperVectorSpanKernel.h"
+
+namespace
+{
+
+/// @brief Load kWidth packed (x, y, z) vectors as x, y, z registers.
+/// Each 128-bit lane transposes 4 vectors, same to dy::simd::TransposeAosToSoa3.
+template <typename TIsa>
+inline void LoadSoa3(const float* iVectors,
+    typename TIsa::TRegister& outX, typename TIsa::TRegister& outY, typename TIsa::TRegister& outZ) noexcept
+{
+  const auto v0 = TIsa::LoadLanes(iVectors, 0);
+  const auto v1 = TIsa::LoadLanes(iVectors, 4);
+  const auto v2 = TIsa::LoadLanes(iVectors, 8);
+  outX = TIsa::template Shuffle<0, 3, 0, 2>(v0, TIsa::template Shuffle<2, 2, 1, 1>(v1, v2));
+  outY = TIsa::template Shuffle<0, 2, 0, 2>(
+      TIsa::template Shuffle<1, 1, 0, 0>(v0, v1), TIsa::template Shuffle<3, 3, 2, 2>(v1, v2));
+  outZ = TIsa::template Shuffle<0, 2, 0, 3>(TIsa::template Shuffle<2, 2, 1, 1>(v0, v1), v2);
+}
+
+/// @brief Inverse of `LoadSoa3`.
+template <typename TIsa>
+inline void StoreSoa3(float* outVectors,
+    const typename TIsa::TRegister& x, const typename TIsa::TRegister& y, const typename TIsa::TRegister& z) noexcept
+{
+  TIsa::StoreLanes(outVectors, 0, TIsa::template Shuffle<0, 2, 0, 2>(
+      TIsa::template Shuffle<0, 0, 0, 0>(x, y), TIsa::template Shuffle<0, 0, 1, 1>(z, x)));
+  TIsa::StoreLanes(outVectors, 4, TIsa::template Shuffle<0, 2, 0, 2>(
+      TIsa::template Shuffle<1, 1, 1, 1>(y, z), TIsa::template Shuffle<2, 2, 2, 2>(x, y)));
+  TIsa::StoreLanes(outVectors, 8, TIsa::template Shuffle<0, 2, 0, 2>(
+      TIsa::template Shuffle<2, 2, 3, 3>(z, x), TIsa::template Shuffle<3, 3, 3, 3>(y, z)));
+}
+
+template <typename TIsa>
+void AddKernel(const float* iLhs, const float* iRhs, std::size_t iFloatCount, float* outResult)
+{
+  std::size_t i = 0;
+  for (; i + TIsa::kWidth <= iFloatCount; i += TIsa::kWidth)
+  {
+    TIsa::Store(outResult + i, TIsa::Add(TIsa::Load(iLhs + i), TIsa::Load(iRhs + i)));
+  }
+  for (; i < iFloatCount; ++i) { outResult[i] = iLhs[i] + iRhs[i]; }
+}
+
+template <typename TIsa>
+void ScaleKernel(const float* iVectors, float iScale, std::size_t iFloatCount, float* outResult)
+{
+  const auto scale = TIsa::Set1(iScale);
+  std::size_t i = 0;
+  for (; i + TIsa::kWidth <= iFloatCount; i += TIsa::kWidth)
+  {
+    TIsa::Store(outResult + i, TIsa::Mul(TIsa::Load(iVectors + i), scale));
+  }
+  for (; i < iFloatCount; ++i) { outResult[i] = iVectors[i] * iScale; }
+}
+
+template <typename TIsa>
+void LerpKernel(const float* iLhs, const float* iRhs, float iOffset, std::size_t iFloatCount, float* outResult)
+{
+  // Same to DVector3::Lerp, lhs * (1 - t) + rhs * t.
+  const float inverseOffset = 1.0f - iOffset;
+  const auto lhsWeight = TIsa::Set1(inverseOffset);
+  const auto rhsWeight = TIsa::Set1(iOffset);
+  std::size_t i = 0;
+  for (; i + TIsa::kWidth <= iFloatCount; i += TIsa::kWidth)
+  {
+    TIsa::Store(outResult + i, TIsa::Add(
+        TIsa::Mul(TIsa::Load(iLhs + i), lhsWeight), TIsa::Mul(TIsa::Load(iRhs + i), rhsWeight)));
+  }
+  for (; i < iFloatCount; ++i) { outResult[i] = iLhs[i] * inverseOffset + iRhs[i] * iOffset; }
+}
+
+template <typename TIsa>
+void DotKernel(const float* iLhs, const float* iRhs, std::size_t iCount, float* outResult)
+{
+  std::size_t i = 0;
+  for (; i + TIsa::kWidth <= iCount; i += TIsa::kWidth)
+  {
+    typename TIsa::TRegister lx, ly, lz, rx, ry, rz;
+    LoadSoa3<TIsa>(iLhs + 3 * i, lx, ly, lz);
+    LoadSoa3<TIsa>(iRhs + 3 * i, rx, ry, rz);
+    TIsa::Store(outResult + i, TIsa::Add(TIsa::Add(TIsa::Mul(lx, rx), TIsa::Mul(ly, ry)), TIsa::Mul(lz, rz)));
+  }
+  for (; i < iCount; ++i)
+  {
+    const float* l = iLhs + 3 * i;
+    const float* r = iRhs + 3 * i;
+    outResult[i] = l[0] * r[0] + l[1] * r[1] + l[2] * r[2];
+  }
+}
+
+template <typename TIsa>
+void CrossKernel(const float* iLhs, const float* iRhs, std::size_t iCount, float* outResult)
+{
+  std::size_t i = 0;
+  for (; i + TIsa::kWidth <= iCount; i += TIsa::kWidth)
+  {
+    typename TIsa::TRegister lx, ly, lz, rx, ry, rz;
+    LoadSoa3<TIsa>(iLhs + 3 * i, lx, ly, lz);
+    LoadSoa3<TIsa>(iRhs + 3 * i, rx, ry, rz);
+    StoreSoa3<TIsa>(outResult + 3 * i,
+        TIsa::Sub(TIsa::Mul(ly, rz), TIsa::Mul(ry, lz)),
+        TIsa::Sub(TIsa::Mul(lz, rx), TIsa::Mul(rz, lx)),
+        TIsa::Sub(TIsa::Mul(lx, ry), TIsa::Mul(rx, ly)));
+  }
+  for (; i < iCount; ++i)
+  {
+    const float* l = iLhs + 3 * i;
+    const float* r = iRhs + 3 * i;
+    const float x = l[1] * r[2] - r[1] * l[2];
+    const float y = l[2] * r[0] - r[2] * l[0];
+    const float z = l[0] * r[1] - r[0] * l[1];
+    float* result = outResult + 3 * i;
+    result[0] = x; result[1] = y; result[2] = z;
+  }
+}
+
+template <typename TIsa>
+void NormalizeKernel(const float* iVectors, std::size_t iCount, float* outResult)
+{
+  std::size_t i = 0;
+  for (; i + TIsa::kWidth <= iCount; i += TIsa::kWidth)
+  {
+    typename TIsa::TRegister x, y, z;
+    LoadSoa3<TIsa>(iVectors + 3 * i, x, y, z);
+    const auto length = TIsa::Sqrt(TIsa::Add(TIsa::Add(TIsa::Mul(x, x), TIsa::Mul(y, y)), TIsa::Mul(z, z)));
+    StoreSoa3<TIsa>(outResult + 3 * i, TIsa::Div(x, length), TIsa::Div(y, length), TIsa::Div(z, length));
+  }
+  for (; i < iCount; ++i)
+  {
+    const float* v = iVectors + 3 * i;
+    const float length = TIsa::SqrtScalar(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    float* result = outResult + 3 * i;
+    result[0] = v[0] / length; result[1] = v[1] / length; result[2] = v[2] / length;
+  }
+}
+
+template <typename TIsa>
+void BoundsKernel(const float* iPoints, std::size_t iCount, float* outMin, float* outMax)
+{
+  for (std::size_t axis = 0; axis < 3; ++axis) { outMin[axis] = outMax[axis] = iPoints[axis]; }
+
+  std::size_t i = 0;
+  if (iCount >= TIsa::kWidth)
+  {
+    typename TIsa::TRegister minX, minY, minZ;
+    LoadSoa3<TIsa>(iPoints, minX, minY, minZ);
+    auto maxX = minX, maxY = minY, maxZ = minZ;
+    for (i = TIsa::kWidth; i + TIsa::kWidth <= iCount; i += TIsa::kWidth)
+    {
+      typename TIsa::TRegister x, y, z;
+      LoadSoa3<TIsa>(iPoints + 3 * i, x, y, z);
+      minX = TIsa::Min(minX, x); minY = TIsa::Min(minY, y); minZ = TIsa::Min(minZ, z);
+      maxX = TIsa::Max(maxX, x); maxY = TIsa::Max(maxY, y); maxZ = TIsa::Max(maxZ, z);
+    }
+
+    // Reduce lanes.
+    float lanes[6][TIsa::kWidth];
+    TIsa::Store(lanes[0], minX); TIsa::Store(lanes[1], minY); TIsa::Store(lanes[2], minZ);
+    TIsa::Store(lanes[3], maxX); TIsa::Store(lanes[4], maxY); TIsa::Store(lanes[5], maxZ);
+    for (std::size_t lane = 0; lane < TIsa::kWidth; ++lane)
+    {
+      for (std::size_t axis = 0; axis < 3; ++axis)
+      {
+        if (lanes[axis][lane] < outMin[axis])     { outMin[axis] = lanes[axis][lane]; }
+        if (lanes[axis + 3][lane] > outMax[axis]) { outMax[axis] = lanes[axis + 3][lane]; }
+      }
+    }
+  }
+  for (; i < iCount; ++i)
+  {
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+      const float value = iPoints[3 * i + axis];
+      if (value < outMin[axis]) { outMin[axis] = value; }
+      if (value > outMax[axis]) { outMax[axis] = value; }
+    }
+  }
+}
+
+/// @brief Create kernel table of `TIsa`.
+template <typename TIsa>
+constexpr dy::DVectorSpanKernelTable CreateKernelTable(dy::ESimdLevel iLevel) noexcept
+{
+  return dy::DVectorSpanKernelTable{
+      iLevel,
+      &AddKernel<TIsa>, &ScaleKernel<TIsa>, &LerpKernel<TIsa>,
+      &DotKernel<TIsa>, &CrossKernel<TIsa>, &NormalizeKernel<TIsa>,
+      &BoundsKernel<TIsa>};
+}
+
+} /// anonymous namespace
@@ -0,0 +1,65 @@
+///
+/// MIT License
+/// Copyright (c) 2018-2019 Jongmin Yun
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+///
+
+//!
+//! Baseline 128-bit kernels. Built without extra instruction set flags.
+//! Kernels work on transposed (x, y, z) registers, so they need no horizontal SSE4.1 instruction like dp.
+//!
+
+#include <immintrin.h>
+#include "FHelperVectorSpanKernel.h"
+
+namespace
+{
+
+struct DIsaSse final
+{
+  using TRegister = __m128;
+  static constexpr std::size_t kWidth = 4;
+
+  static TRegister Load(const float* p) noexcept { return _mm_loadu_ps(p); }
+  static void Store(float* p, const TRegister& v) noexcept { _mm_storeu_ps(p, v); }
+  static TRegister Set1(float v) noexcept { return _mm_set1_ps(v); }
+  static TRegister Add(const TRegister& a, const TRegister& b) noexcept { return _mm_add_ps(a, b); }
+  static TRegister Sub(const TRegister& a, const TRegister& b) noexcept { return _mm_sub_ps(a, b); }
+  static TRegister Mul(const TRegister& a, const TRegister& b) noexcept { return _mm_mul_ps(a, b); }
+  static TRegister Div(const TRegister& a, const TRegister& b) noexcept { return _mm_div_ps(a, b); }
+  static TRegister Min(const TRegister& a, const TRegister& b) noexcept { return _mm_min_ps(a, b); }
+  static TRegister Max(const TRegister& a, const TRegister& b) noexcept { return _mm_max_ps(a, b); }
+  static TRegister Sqrt(const TRegister& a) noexcept { return _mm_sqrt_ps(a); }
+  static float SqrtScalar(float v) noexcept { return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(v))); }
+
+  template <int TX, int TY, int TZ, int TW>
+  static TRegister Shuffle(const TRegister& a, const TRegister& b) noexcept
+  {
+    return _mm_shuffle_ps(a, b, _MM_SHUFFLE(TW, TZ, TY, TX));
+  }
+
+  static TRegister LoadLanes(const float* p, std::size_t iOffset) noexcept { return _mm_loadu_ps(p + iOffset); }
+  static void StoreLanes(float* p, std::size_t iOffset, const TRegister& v) noexcept { _mm_storeu_ps(p + iOffset, v); }
+};
+
+} /// anonymous namespace
+
+#include "FHelperVectorSpanKernel.inl"
+
+namespace dy
+{
+
+const DVectorSpanKernelTable& GetVectorSpanKernelSse() noexcept
+{
+  static constexpr DVectorSpanKernelTable kTable = CreateKernelTable<DIsaSse>(ESimdLevel::Sse2);
+  return kTable;
+}
+
+} /// ::dy namespace